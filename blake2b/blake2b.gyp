@@ -1,4 +1,9 @@
 {
+  'variables': {
+    # Fully unroll the rounds of the portable compress function. Set to 0 for
+    # the smaller looped version.
+    'unroll_rounds%': 1,
+  },
   'targets': [
     {
       'target_name': 'blake2b',
@@ -8,8 +13,89 @@
       ],
       'sources': [
         'src/blake2b.c',
+        'src/blake2b_batch.c',
+        'src/blake2b_cpu.c',
+        'src/blake2b_lanes.c',
+        'src/blake2b_mac.c',
+        'src/blake2b_merkle.c',
+        'src/blake2b_mgr.c',
+        'src/blake2b_node.c',
+        'src/blake2bp.c',
+        'src/blake2b_prefix.c',
+        'src/blake2b_tree.c',
+        'src/blake2xb.c',
         'src/test.c',
       ],
+      'conditions': [
+        ['OS!="win"', {
+          'link_settings': {
+            'libraries': [
+              '-lpthread',
+            ],
+          },
+        }],
+        ['unroll_rounds==1', {
+          'defines': [
+            'BLAKE2B_UNROLL',
+          ],
+        }],
+        # The vectorized kernels are picked at runtime, see blake2b_compress
+        ['target_arch=="x64" or target_arch=="ia32"', {
+          'dependencies': [
+            'blake2b_sse41',
+            'blake2b_avx2',
+            'blake2b_avx512',
+          ],
+        }],
+      ],
    }
       ],
+  'conditions': [
+    ['target_arch=="x64" or target_arch=="ia32"', {
+      'targets': [
+        {
+          'target_name': 'blake2b_sse41',
+          'type': 'static_library',
+          'include_dirs': [
+            'include/',
+          ],
+          'cflags': [
+            '-msse4.1',
+          ],
+          'sources': [
+            'src/blake2b_sse41.c',
+          ],
+        },
+        {
+          'target_name': 'blake2b_avx2',
+          'type': 'static_library',
+          'include_dirs': [
+            'include/',
+          ],
+          'cflags': [
+            '-mavx2',
+          ],
+          'sources': [
+            'src/blake2b_avx2.c',
+            'src/blake2b_x4_avx2.c',
+          ],
+        },
+        {
+          'target_name': 'blake2b_avx512',
+          'type': 'static_library',
+          'include_dirs': [
+            'include/',
+          ],
+          'cflags': [
+            '-mavx512f',
+            '-mavx512vl',
+          ],
+          'sources': [
+            'src/blake2b_avx512.c',
+            'src/blake2b_x8_avx512.c',
+          ],
+        },
+      ],
+    }],
+  ],
 }
@@ -47,7 +47,8 @@ typedef struct blake2b_param
   uint8_t fanout;                          /* 3 */
   uint8_t depth;                           /* 4 */
   uint32_t leaf_length;                    /* 8 */
-  uint64_t node_offset;                    /* 16 */
+  uint32_t node_offset;                    /* 12 */
+  uint32_t xof_length;                     /* 16 */
   uint8_t node_depth;                      /* 17 */
   uint8_t inner_length;                    /* 18 */
   uint8_t reserved[14];                    /* 32 */
@@ -63,8 +64,42 @@ typedef struct blake2b_state
   uint8_t buf[BLAKE2B_BLOCKBYTES]; /* input buffer */
   size_t buflen;                   /* size of buffer */
   size_t outlen;                   /* digest size */
+  uint8_t last_node;               /* last node of its level in a tree */
 } blake2b_state;
 
+/**
+ * Number of lanes a blake2b_lanes instance holds, enough for the widest
+ * multi-lane kernel
+ */
+#define BLAKE2B_MAX_LANES 8
+
+/**
+ * State of several independent blake2b instances in transposed form: word i
+ * of the chained state of lane j is h[i][j], so a multi-lane kernel loads the
+ * same word of consecutive lanes with one vector load
+ */
+typedef struct blake2b_lanes
+{
+  uint64_t h[8][BLAKE2B_MAX_LANES]; /* chained states */
+  uint64_t t[2][BLAKE2B_MAX_LANES]; /* total number of bytes */
+  uint64_t f[2][BLAKE2B_MAX_LANES]; /* last block flags */
+} blake2b_lanes;
+
+/**
+ * Position of one message in a lane of a blake2b_lanes instance. Each lane
+ * steps through its own message, so lanes may hold messages of different
+ * lengths and keys.
+ */
+typedef struct blake2b_lane_msg
+{
+  const uint8_t* in;               /* rest of the message */
+  size_t inlen;                    /* bytes left in in */
+  const uint8_t* key;              /* key to absorb first, NULL once done */
+  size_t keylen;                   /* key length */
+  int final;                       /* last block has been handed out */
+  uint8_t buf[BLAKE2B_BLOCKBYTES]; /* padded key or padded last block */
+} blake2b_lane_msg;
+
 extern void blake2b_init(blake2b_state* state, size_t outlen, const void* key,
                  size_t keylen);
 extern void blake2b_update(blake2b_state* state, const unsigned char* in, size_t inlen);
@@ -72,4 +107,231 @@ extern void blake2b_final(blake2b_state* state, void* out, size_t outlen);
 extern void blake2b(void* out, size_t outlen, const void* in, size_t inlen,
             const void* key, size_t keylen);
 
+/* Parameter block API */
+extern void blake2b_init_param(blake2b_state* state, const blake2b_param* P);
+extern void blake2b_init_param_key(blake2b_state* state,
+                                   const blake2b_param* P, const void* key);
+extern void blake2b_init_salt_personal(blake2b_state* state, size_t outlen,
+                                       const void* key, size_t keylen,
+                                       const void* salt,
+                                       const void* personal);
+extern void blake2b_param_hash(void* out, const void* in, size_t inlen,
+                               const void* key, const blake2b_param* P);
+extern void blake2b_salt_personal(void* out, size_t outlen, const void* in,
+                                  size_t inlen, const void* key,
+                                  size_t keylen, const void* salt,
+                                  const void* personal);
+
+/**
+ * Keyed hashing context: the state after the key block, computed once and
+ * shared read-only by any number of messages and threads
+ */
+typedef struct blake2b_mac_ctx
+{
+  uint64_t h[8];                   /* chained state after the key block */
+  uint64_t t;                      /* bytes absorbed, the key block or 0 */
+  size_t outlen;                   /* digest size */
+  uint8_t empty[BLAKE2B_OUTBYTES]; /* digest of the empty message */
+} blake2b_mac_ctx;
+
+/**
+ * Midstates of a fixed prefix, at every block boundary of it, so that
+ * messages starting with all or part of the prefix only pay for the rest
+ */
+typedef struct blake2b_prefix
+{
+  blake2b_mac_ctx mac;             /* state after the key block, if any */
+  uint8_t* prefix;                 /* copy of the prefix */
+  size_t prefixlen;                /* prefix length */
+  size_t blocks;                   /* whole blocks in the prefix */
+  uint64_t (*h)[8];                /* h[j]: chained state after j blocks */
+} blake2b_prefix;
+
+/* Keyed hashing API */
+extern void blake2b_mac_init(blake2b_mac_ctx* ctx, size_t outlen,
+                             const void* key, size_t keylen);
+extern void blake2b_mac_start(const blake2b_mac_ctx* ctx,
+                              blake2b_state* state);
+extern void blake2b_mac_final(const blake2b_mac_ctx* ctx,
+                              blake2b_state* state, void* out);
+extern void blake2b_mac(const blake2b_mac_ctx* ctx, void* out, const void* in,
+                        size_t inlen);
+
+/* State cloning and prefix cache API */
+extern void blake2b_clone(blake2b_state* dst, const blake2b_state* src);
+extern int blake2b_prefix_init(blake2b_prefix* cache, size_t outlen,
+                               const void* key, size_t keylen,
+                               const void* prefix, size_t prefixlen);
+extern void blake2b_prefix_free(blake2b_prefix* cache);
+extern size_t blake2b_prefix_start(const blake2b_prefix* cache,
+                                   blake2b_state* state, const void* in,
+                                   size_t inlen);
+extern void blake2b_prefix_hash(const blake2b_prefix* cache, void* out,
+                                const void* in, size_t inlen);
+extern void blake2b_prefix_tail(const blake2b_prefix* cache, void* out,
+                                const void* tail, size_t taillen);
+
+/**
+ * One message of a blake2b_batch call
+ */
+typedef struct blake2b_desc
+{
+  const void* in;                  /* message */
+  size_t inlen;                    /* message length */
+  const void* key;                 /* key, NULL for unkeyed hashing */
+  size_t keylen;                   /* key length */
+  void* out;                       /* digest output */
+  size_t outlen;                   /* digest size */
+} blake2b_desc;
+
+/**
+ * Number of levels a blake2b_merkle can hold, enough for any leaf count
+ */
+#define BLAKE2B_MERKLE_MAX_LEVELS 64
+
+/**
+ * Binary Merkle tree over 32-byte digests with every level kept. Node i of
+ * level k + 1 is blake2b_256_node of nodes 2i and 2i + 1 of level k; the last
+ * node of a level with an odd count moves up unchanged.
+ */
+typedef struct blake2b_merkle
+{
+  uint8_t* arena;                      /* one allocation for the levels */
+  const uint8_t* level[BLAKE2B_MERKLE_MAX_LEVELS]; /* 32-byte nodes of each
+                                                      level, leaves first */
+  size_t count[BLAKE2B_MERKLE_MAX_LEVELS]; /* nodes on each level */
+  size_t levels;                       /* levels, the root alone on the last */
+} blake2b_merkle;
+
+/* Merkle node API */
+extern void blake2b_256_node(void* out, const void* left, const void* right);
+extern void blake2b_256_node_x4(void* const out[4], const void* const left[4],
+                                const void* const right[4]);
+extern void blake2b_256_node_x8(void* const out[8], const void* const left[8],
+                                const void* const right[8]);
+
+/* Merkle tree API */
+extern int blake2b_merkle_build(blake2b_merkle* tree, const void* leaves,
+                                size_t n, size_t threads);
+extern int blake2b_merkle_build_data(blake2b_merkle* tree, const void* data,
+                                     size_t leaflen, size_t n,
+                                     size_t threads);
+extern void blake2b_merkle_root(const blake2b_merkle* tree, void* out);
+extern void blake2b_merkle_free(blake2b_merkle* tree);
+
+/* Multi-message API */
+extern void blake2b_x4(void* out[4], size_t outlen, const void* const in[4],
+                       size_t inlen, const void* key, size_t keylen);
+extern void blake2b_x8(void* out[8], size_t outlen, const void* const in[8],
+                       size_t inlen, const void* key, size_t keylen);
+extern void blake2b_batch(const blake2b_desc* descs, size_t n);
+
+/**
+ * Number of leaves of BLAKE2bp, each hashing every fourth block of the input
+ */
+#define BLAKE2BP_LEAVES 4
+
+/**
+ * BLAKE2bp state: the four leaves live in lanes 0 to 3 so that one stripe of
+ * four blocks is a single multi-lane compression
+ */
+typedef struct blake2bp_state
+{
+  blake2b_lanes leaves;                                  /* leaf states */
+  uint8_t buf[2 * BLAKE2BP_LEAVES * BLAKE2B_BLOCKBYTES]; /* input buffer */
+  size_t buflen;                                         /* size of buffer */
+  uint8_t key[BLAKE2B_KEYBYTES];                         /* key */
+  size_t keylen;                                         /* key length */
+  int key_pending;                   /* leaves have not absorbed the key */
+  size_t outlen;                                         /* digest size */
+} blake2bp_state;
+
+/* BLAKE2bp API */
+extern void blake2bp_init(blake2bp_state* state, size_t outlen,
+                          const void* key, size_t keylen);
+extern void blake2bp_update(blake2bp_state* state, const void* in,
+                            size_t inlen);
+extern void blake2bp_final(blake2bp_state* state, void* out, size_t outlen);
+extern void blake2bp(void* out, size_t outlen, const void* in, size_t inlen,
+                     const void* key, size_t keylen);
+
+/**
+ * Output length that lets BLAKE2Xb produce any number of bytes, up to 2^32
+ * blocks of 64 bytes
+ */
+#define BLAKE2XB_LENGTH_UNKNOWN 0xFFFFFFFFUL
+
+/**
+ * BLAKE2Xb state: the root blake2b instance that absorbs the input, its
+ * parameter block, from which the output blocks derive theirs, and the
+ * position in the output stream of blake2xb_squeeze
+ */
+typedef struct blake2xb_state
+{
+  blake2b_state S;                   /* root hash state */
+  blake2b_param P;                   /* root parameter block */
+  uint8_t root[BLAKE2B_OUTBYTES];    /* root digest, once finalized */
+  int finalized;                     /* root digest has been computed */
+  uint64_t pos;                      /* output bytes squeezed so far */
+} blake2xb_state;
+
+/* BLAKE2Xb API */
+extern int blake2xb_init(blake2xb_state* state, size_t outlen,
+                         const void* key, size_t keylen);
+extern void blake2xb_update(blake2xb_state* state, const void* in,
+                            size_t inlen);
+extern void blake2xb_finalize(blake2xb_state* state);
+extern int blake2xb_final(blake2xb_state* state, void* out, size_t outlen);
+extern int blake2xb_squeeze(blake2xb_state* state, void* out, size_t outlen);
+extern int blake2xb_read(const blake2xb_state* state, uint64_t offset,
+                         void* out, size_t outlen, size_t threads);
+extern int blake2xb(void* out, size_t outlen, const void* in, size_t inlen,
+                    const void* key, size_t keylen);
+
+/* Tree hashing API */
+extern int blake2b_tree_hash(void* out, const void* in, size_t inlen,
+                             const void* key, const blake2b_param* P,
+                             size_t threads);
+extern uint64_t blake2b_tree_nodes(const blake2b_param* P, uint64_t total_len,
+                                   size_t level);
+extern int blake2b_tree_subtree(void* out, const void* in, size_t inlen,
+                                uint64_t total_len, const void* key,
+                                const blake2b_param* P, size_t threads);
+extern int blake2b_tree_merge(void* out, const void* digests, size_t count,
+                              uint64_t total_len, const blake2b_param* P);
+
+/**
+ * One message of a blake2b_mgr. The fields are those of blake2b_desc; next
+ * belongs to the manager while the job is submitted.
+ */
+typedef struct blake2b_job
+{
+  const void* in;                  /* message */
+  size_t inlen;                    /* message length */
+  const void* key;                 /* key, NULL for unkeyed hashing */
+  size_t keylen;                   /* key length */
+  void* out;                       /* digest output */
+  size_t outlen;                   /* digest size */
+  struct blake2b_job* next;        /* next completed job */
+} blake2b_job;
+
+/**
+ * Multi-buffer job manager: keeps one submitted job per lane and hands jobs
+ * back as they complete
+ */
+typedef struct blake2b_mgr
+{
+  blake2b_lanes lanes;                      /* states of the lanes */
+  blake2b_lane_msg msgs[BLAKE2B_MAX_LANES]; /* cursors of the lanes */
+  blake2b_job* jobs[BLAKE2B_MAX_LANES];     /* job of each lane */
+  size_t active;                            /* busy lanes, 0 .. active-1 */
+  blake2b_job* done;                        /* completed jobs, oldest first */
+  blake2b_job* done_tail;                   /* last completed job */
+} blake2b_mgr;
+
+/* Multi-buffer API */
+extern void blake2b_mgr_init(blake2b_mgr* mgr);
+extern blake2b_job* blake2b_mgr_submit(blake2b_mgr* mgr, blake2b_job* job);
+extern blake2b_job* blake2b_mgr_flush(blake2b_mgr* mgr);
+
 #endif /* BLAKE_H */
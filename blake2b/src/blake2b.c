@@ -1,9 +1,17 @@
 #include "blake2b.h"
+#include "blake2b_impl.h"
 #include <math.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <pthread.h>
+#endif
+
 /**
  * Helper macro to perform rotation in a 64 bit int
  *
@@ -12,25 +20,6 @@
  */
 #define ROTR64(w, c) ((w) >> (c)) | ((w) << (64 - (c)))
 
-/**
- * Helper macro to load into src 64 bytes at a time
- *
- * @param[in]  dest  the destination
- * @param[in]  src   the source
- */
-#if defined(NATIVE_LITTLE_ENDIAN)
-  #define LOAD64(dest, src) memcpy(&(dest), (src), sizeof (dest))
-#else
-  #define LOAD64(dest, src)                                          \
-    do {                                                             \
-    const uint8_t* load = (const uint8_t*)(src);                     \
-    dest = ((uint64_t)(load[0]) << 0) | ((uint64_t)(load[1]) << 8) | \
-    ((uint64_t)(load[2]) << 16) | ((uint64_t)(load[3]) << 24) |      \
-    ((uint64_t)(load[4]) << 32) | ((uint64_t)(load[5]) << 40) |      \
-    ((uint64_t)(load[6]) << 48) | ((uint64_t)(load[7]) << 56);       \
-    } while(0)
-#endif
-
 /**
  * Stores w into dst
  *
@@ -103,33 +92,81 @@ blake2b_increment_counter(blake2b_state* state, const uint64_t inc)
   b = ROTR64(b ^ c, 63);          \
   }while(0)
 
+#if defined(BLAKE2B_UNROLL)
 /**
- * The blake2b compress function which takes a full 128-byte chunk of the
- * input message and mixes it into the ongoing state array
+ * Message word k of round r
+ */
+#define M(r, k) m[blake2b_sigma[r][k]]
+
+/**
+ * One full round of the compress function. r must be a literal: every
+ * blake2b_sigma lookup then folds to a constant and each message word is a
+ * fixed register or stack slot instead of a dynamically indexed m[s[k]].
  *
- * @param      state  blake2b_state instance
- * @param      block  the input block
+ * @param[in]  r     the round number
  */
-static void
-F(blake2b_state* state, const uint8_t block[BLAKE2B_BLOCKBYTES])
+#define ROUND(r)                                              \
+  do {                                                        \
+  G(v[0], v[4], v[8], v[12], M(r, 0), M(r, 1));               \
+  G(v[1], v[5], v[9], v[13], M(r, 2), M(r, 3));               \
+  G(v[2], v[6], v[10], v[14], M(r, 4), M(r, 5));              \
+  G(v[3], v[7], v[11], v[15], M(r, 6), M(r, 7));              \
+  G(v[0], v[5], v[10], v[15], M(r, 8), M(r, 9));              \
+  G(v[1], v[6], v[11], v[12], M(r, 10), M(r, 11));            \
+  G(v[2], v[7], v[8], v[13], M(r, 12), M(r, 13));             \
+  G(v[3], v[4], v[9], v[14], M(r, 14), M(r, 15));             \
+  } while(0)
+#endif
+
+/**
+ * Mixes one full 128-byte block into a chaining value. It works on plain
+ * arrays rather than a blake2b_state so that, inlined into the loop of
+ * F_blocks, h and t stay in registers from one block to the next.
+ *
+ * @param      h      the chaining value
+ * @param[in]  t      the counter, including this block
+ * @param[in]  f      the finalization flags
+ * @param[in]  block  the input block
+ */
+BLAKE2B_INLINE void
+blake2b_block(uint64_t h[8], const uint64_t t[2], const uint64_t f[2],
+              const uint8_t block[BLAKE2B_BLOCKBYTES])
 {
-  size_t i, j;
-  uint64_t v[16], m[16], s[16];
+  size_t i;
+  uint64_t v[16], m[16];
+#if !defined(BLAKE2B_UNROLL)
+  size_t j;
+  uint64_t s[16];
+#endif
 
   for (i = 0; i < 16; ++i) {
     LOAD64(m[i], block + i * sizeof(m[i]));
   }
 
   for (i = 0; i < 8; ++i) {
-    v[i] = state->h[i];
+    v[i] = h[i];
     v[i + 8] = blake2b_IV[i];
   }
 
-  v[12] ^= state->t[0];
-  v[13] ^= state->t[1];
-  v[14] ^= state->f[0];
-  v[15] ^= state->f[1];
+  v[12] ^= t[0];
+  v[13] ^= t[1];
+  v[14] ^= f[0];
+  v[15] ^= f[1];
 
+#if defined(BLAKE2B_UNROLL)
+  ROUND(0);
+  ROUND(1);
+  ROUND(2);
+  ROUND(3);
+  ROUND(4);
+  ROUND(5);
+  ROUND(6);
+  ROUND(7);
+  ROUND(8);
+  ROUND(9);
+  ROUND(10);
+  ROUND(11);
+#else
   for (i = 0; i < 12; i++) {
     for (j = 0; j < 16; j++) {
       s[j] = blake2b_sigma[i][j];
@@ -143,59 +180,410 @@ F(blake2b_state* state, const uint8_t block[BLAKE2B_BLOCKBYTES])
     G(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
     G(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
   }
+#endif
 
   for (i = 0; i < 8; i++) {
-    state->h[i] = state->h[i] ^ v[i] ^ v[i + 8];
+    h[i] = h[i] ^ v[i] ^ v[i + 8];
   }
 }
 
 /**
- * Initializes blake2b state
+ * The blake2b compress function which takes a full 128-byte chunk of the
+ * input message and mixes it into the ongoing state array
  *
- * @param      state   blake2b_state instance passed by reference
- * @param[in]  outlen  the hash output length
+ * @param      state  blake2b_state instance
+ * @param      block  the input block
  */
-void
-blake2b_init(blake2b_state* state, size_t outlen, const void* key, size_t keylen)
+static void
+F(blake2b_state* state, const uint8_t block[BLAKE2B_BLOCKBYTES])
 {
-  blake2b_param P = {0};
-  const uint8_t* p;
+  blake2b_block(state->h, state->t, state->f, block);
+}
+
+/**
+ * Compresses consecutive full blocks that are not the last block of the
+ * message, advancing the counter by one block before each of them. The
+ * chaining value and counter are loaded once and stored once, instead of
+ * going through the state in memory for every block.
+ *
+ * @param      state    blake2b_state instance
+ * @param[in]  in       the input blocks
+ * @param[in]  nblocks  the number of blocks
+ */
+static void
+F_blocks(blake2b_state* state, const uint8_t* in, size_t nblocks)
+{
+  uint64_t h[8], t[2];
   size_t i;
-  uint64_t dest;
 
-  P.digest_length = (uint8_t)outlen;
-  if(keylen > 0) {
-    P.key_length = (uint8_t)keylen;
+  for (i = 0; i < 8; ++i) {
+    h[i] = state->h[i];
   }
-  P.fanout = 1;
-  P.depth = 1;
-  /*store32(&P.leaf_length, 0);
-  store64(&P.node_offset, 0);
-  P.node_depth = 0;
-  P.inner_length = 0;
-  memset(P.reserved, 0, sizeof(P.reserved));
-  memset(P.salt, 0, sizeof(P.salt));
-  memset(P.personal, 0, sizeof(P.personal));*/
-
-  dest = 0;
-  p = (const uint8_t*)(&P);
+  t[0] = state->t[0];
+  t[1] = state->t[1];
+
+  for (; nblocks > 0; --nblocks) {
+    t[0] += BLAKE2B_BLOCKBYTES;
+    t[1] += (t[0] < BLAKE2B_BLOCKBYTES);
+    blake2b_block(h, t, state->f, in);
+    in += BLAKE2B_BLOCKBYTES;
+  }
+
   for (i = 0; i < 8; ++i) {
-    state->h[i] = blake2b_IV[i];
+    state->h[i] = h[i];
+  }
+  state->t[0] = t[0];
+  state->t[1] = t[1];
+}
+
+/**
+ * The compress functions blake2b can pick from, best first. A kernel is only
+ * used when the CPU has all of its features.
+ */
+typedef struct blake2b_kernel
+{
+  const char* name;
+  int features;
+  blake2b_compress_fn compress;
+  blake2b_blocks_fn compress_blocks;
+  blake2b_lanes_fn compress_x4; /* NULL to compress lanes one by one */
+  blake2b_lanes_fn compress_x8; /* NULL to use compress_x4 */
+  blake2b_node_fn node_x4;      /* NULL to hash nodes one by one */
+  blake2b_node_fn node_x8;      /* NULL to use node_x4 */
+} blake2b_kernel;
+
+static const blake2b_kernel blake2b_kernels[] = {
+#if defined(BLAKE2B_X86)
+  /* the avx512 set also runs the AVX2 x4 kernels */
+  { "avx512", BLAKE2B_CPU_AVX512 | BLAKE2B_CPU_AVX2,
+    blake2b_compress_avx512, blake2b_compress_blocks_avx512,
+    blake2b_compress_x4_avx2, blake2b_compress_x8_avx512,
+    blake2b_node_x4_avx2, blake2b_node_x8_avx512 },
+  { "avx2", BLAKE2B_CPU_AVX2, blake2b_compress_avx2,
+    blake2b_compress_blocks_avx2, blake2b_compress_x4_avx2, NULL,
+    blake2b_node_x4_avx2, NULL },
+  { "sse41", BLAKE2B_CPU_SSE41, blake2b_compress_sse41,
+    blake2b_compress_blocks_sse41, NULL, NULL, NULL, NULL },
+#endif
+  { "ref", 0, F, F_blocks, NULL, NULL, NULL, NULL }
+};
+
+#define BLAKE2B_NKERNELS (sizeof(blake2b_kernels) / sizeof(blake2b_kernels[0]))
+
+/**
+ * Kernel set in use. Nothing reads these before blake2b_kernel_init, which
+ * picks the set exactly once, so threads making their first calls at the
+ * same time neither race on them nor see a half-written set.
+ */
+static blake2b_compress_fn blake2b_compress = F;
+static blake2b_blocks_fn blake2b_compress_blocks = F_blocks;
+static blake2b_lanes_fn blake2b_compress_x4 = NULL;
+static blake2b_lanes_fn blake2b_compress_x8 = NULL;
+static blake2b_node_fn blake2b_node_x4 = NULL;
+static blake2b_node_fn blake2b_node_x8 = NULL;
+static const char* blake2b_compress_name = NULL;
+
+/**
+ * Stores the pointers of a kernel set
+ *
+ * @param[in]  name  the name of the set, or NULL for the best one this CPU
+ *                   supports
+ *
+ * @return     0 on success, -1 if the kernel is unknown or unsupported
+ */
+static int
+blake2b_kernel_set(const char* name)
+{
+  int features = blake2b_cpu_features();
+  size_t i;
+
+  for (i = 0; i < BLAKE2B_NKERNELS; ++i) {
+    if ((blake2b_kernels[i].features & features) !=
+        blake2b_kernels[i].features) {
+      continue;
+    }
+    if (name == NULL || strcmp(name, blake2b_kernels[i].name) == 0) {
+      blake2b_compress_name = blake2b_kernels[i].name;
+      blake2b_compress = blake2b_kernels[i].compress;
+      blake2b_compress_blocks = blake2b_kernels[i].compress_blocks;
+      blake2b_compress_x4 = blake2b_kernels[i].compress_x4;
+      blake2b_compress_x8 = blake2b_kernels[i].compress_x8;
+      blake2b_node_x4 = blake2b_kernels[i].node_x4;
+      blake2b_node_x8 = blake2b_kernels[i].node_x8;
+      return 0;
+    }
   }
+  return -1;
+}
+
+/**
+ * Picks the kernel set on first use. The BLAKE2B_KERNEL environment variable
+ * forces a particular kernel, e.g. for benchmarking; unknown or unsupported
+ * names fall back to the best one available.
+ */
+static void
+blake2b_kernel_pick(void)
+{
+  const char* forced = getenv("BLAKE2B_KERNEL");
+
+  if (forced == NULL || blake2b_kernel_set(forced) != 0) {
+    blake2b_kernel_set(NULL);
+  }
+}
+
+#if defined(_WIN32)
+static INIT_ONCE blake2b_kernel_once = INIT_ONCE_STATIC_INIT;
+
+/**
+ * InitOnceExecuteOnce callback around blake2b_kernel_pick
+ */
+static BOOL CALLBACK
+blake2b_kernel_pick_once(PINIT_ONCE once, PVOID arg, PVOID* ctx)
+{
+  (void)once;
+  (void)arg;
+  (void)ctx;
+  blake2b_kernel_pick();
+  return TRUE;
+}
+#else
+static pthread_once_t blake2b_kernel_once = PTHREAD_ONCE_INIT;
+#endif
+
+/**
+ * Picks the kernel set unless that is already done. Every function reading
+ * the kernel pointers calls this first; the once-only initialization also
+ * makes the stores of the thread that picked visible to every other one.
+ */
+static void
+blake2b_kernel_init(void)
+{
+#if defined(_WIN32)
+  InitOnceExecuteOnce(&blake2b_kernel_once, blake2b_kernel_pick_once, NULL,
+                      NULL);
+#else
+  pthread_once(&blake2b_kernel_once, blake2b_kernel_pick);
+#endif
+}
+
+/**
+ * Selects the compress function used from now on. Must not be called while
+ * other threads are hashing.
+ *
+ * @param[in]  name  one of "avx512", "avx2", "sse41" or "ref", or NULL for
+ *                   the best kernel this CPU supports
+ *
+ * @return     0 on success, -1 if the kernel is unknown or unsupported
+ */
+int
+blake2b_select_kernel(const char* name)
+{
+  blake2b_kernel_init();
+  return blake2b_kernel_set(name);
+}
+
+/**
+ * Returns the name of the compress function in use, selecting it first if
+ * nothing has been hashed yet
+ */
+const char*
+blake2b_kernel_name(void)
+{
+  blake2b_kernel_init();
+  return blake2b_compress_name;
+}
+
+/**
+ * Compresses one full 128-byte block into each of the lanes 0 .. nlanes-1,
+ * eight or four at a time with the multi-lane kernels of the selected kernel
+ * set and the remaining ones with the single-stream compress function
+ *
+ * @param      lanes   the transposed states
+ * @param[in]  blocks  one input block per lane
+ * @param[in]  nlanes  the number of lanes to compress
+ */
+void
+blake2b_compress_lanes(blake2b_lanes* lanes, const uint8_t* const blocks[],
+                       size_t nlanes)
+{
+  blake2b_state state;
+  size_t lane = 0;
+  size_t i;
+
+  blake2b_kernel_init();
+
+  if (blake2b_compress_x8 != NULL) {
+    for (; lane + 8 <= nlanes; lane += 8) {
+      blake2b_compress_x8(lanes, lane, blocks + lane);
+    }
+  }
+  if (blake2b_compress_x4 != NULL) {
+    for (; lane + 4 <= nlanes; lane += 4) {
+      blake2b_compress_x4(lanes, lane, blocks + lane);
+    }
+  }
+
+  for (; lane < nlanes; ++lane) {
+    for (i = 0; i < 8; ++i) {
+      state.h[i] = lanes->h[i][lane];
+    }
+    state.t[0] = lanes->t[0][lane];
+    state.t[1] = lanes->t[1][lane];
+    state.f[0] = lanes->f[0][lane];
+    state.f[1] = lanes->f[1][lane];
+    blake2b_compress(&state, blocks[lane]);
+    for (i = 0; i < 8; ++i) {
+      lanes->h[i][lane] = state.h[i];
+    }
+  }
+}
+
+/**
+ * Hashes n pairs of 32-byte children, each into the 32-byte unkeyed blake2b
+ * digest of left || right: eight or four pairs at a time with the multi-lane
+ * node functions of the selected kernel set, the remaining ones with one
+ * compression each. Every pair is one fixed 64-byte block, so the chaining
+ * value, counter, flags and padding never depend on the input.
+ *
+ * @param      out    one 32-byte output per pair
+ * @param[in]  left   one 32-byte left child per pair
+ * @param[in]  right  one 32-byte right child per pair
+ * @param[in]  n      the number of pairs
+ */
+void
+blake2b_node_lanes(uint8_t* const out[], const uint8_t* const left[],
+                   const uint8_t* const right[], size_t n)
+{
+  uint8_t block[BLAKE2B_BLOCKBYTES] = { 0 };
+  blake2b_state state;
+  size_t lane = 0;
+  size_t i;
+
+  blake2b_kernel_init();
+
+  if (blake2b_node_x8 != NULL) {
+    for (; lane + 8 <= n; lane += 8) {
+      blake2b_node_x8(out + lane, left + lane, right + lane);
+    }
+  }
+  if (blake2b_node_x4 != NULL) {
+    for (; lane + 4 <= n; lane += 4) {
+      blake2b_node_x4(out + lane, left + lane, right + lane);
+    }
+  }
+
+  for (; lane < n; ++lane) {
+    /* digest length 32, fanout 1, depth 1 */
+    state.h[0] = blake2b_IV[0] ^ 0x01010020;
+    for (i = 1; i < 8; ++i) {
+      state.h[i] = blake2b_IV[i];
+    }
+    state.t[0] = 64;
+    state.t[1] = 0;
+    state.f[0] = UINT64_MAX;
+    state.f[1] = 0;
+    memcpy(block, left[lane], 32);
+    memcpy(block + 32, right[lane], 32);
+    blake2b_compress(&state, block);
+    for (i = 0; i < 4; ++i) {
+      store64(out[lane] + sizeof(state.h[i]) * i, state.h[i]);
+    }
+  }
+}
+
+/**
+ * Initializes blake2b state from a full parameter block, for the tree modes
+ * and any other use that needs more than the digest and key length
+ *
+ * @param      state  blake2b_state instance passed by reference
+ * @param[in]  P      the parameter block
+ */
+void
+blake2b_init_param(blake2b_state* state, const blake2b_param* P)
+{
+  const uint8_t* p = (const uint8_t*)P;
+  size_t i;
+  uint64_t dest;
+
   for (i = 0; i < 8; ++i) {
     LOAD64(dest, p + sizeof(state->h[i]) * i);
-    state->h[i] ^= dest;
+    state->h[i] = blake2b_IV[i] ^ dest;
   }
-  state->outlen = P.digest_length;
+  state->t[0] = 0;
+  state->t[1] = 0;
+  state->f[0] = 0;
+  state->f[1] = 0;
+  state->buflen = 0;
+  state->outlen = P->digest_length;
+  state->last_node = 0;
+}
 
-  if (keylen > 0) {
+/**
+ * Initializes blake2b state from a full parameter block and absorbs the key
+ *
+ * @param      state  blake2b_state instance passed by reference
+ * @param[in]  P      the parameter block
+ * @param[in]  key    the key, P->key_length bytes, may be NULL if that is 0
+ */
+void
+blake2b_init_param_key(blake2b_state* state, const blake2b_param* P,
+                       const void* key)
+{
+  blake2b_init_param(state, P);
+
+  if (P->key_length > 0) {
     uint8_t block[BLAKE2B_BLOCKBYTES] = {0};
-    memcpy(block, key, keylen);
+    memcpy(block, key, P->key_length);
     blake2b_update(state, block, BLAKE2B_BLOCKBYTES);
     memset(block, 0, BLAKE2B_BLOCKBYTES);
   }
 }
 
+/**
+ * Initializes blake2b state with a salt and a personalization string, which
+ * separate the digests of different uses of the same key at no cost
+ *
+ * @param      state     blake2b_state instance passed by reference
+ * @param[in]  outlen    the hash output length
+ * @param[in]  key       the key
+ * @param[in]  keylen    the key length
+ * @param[in]  salt      the 16-byte salt, or NULL for none
+ * @param[in]  personal  the 16-byte personalization string, or NULL for none
+ */
+void
+blake2b_init_salt_personal(blake2b_state* state, size_t outlen,
+                           const void* key, size_t keylen, const void* salt,
+                           const void* personal)
+{
+  blake2b_param P = {0};
+
+  P.digest_length = (uint8_t)outlen;
+  P.key_length = (uint8_t)keylen;
+  P.fanout = 1;
+  P.depth = 1;
+  if (salt != NULL) {
+    memcpy(P.salt, salt, BLAKE2B_SALTBYTES);
+  }
+  if (personal != NULL) {
+    memcpy(P.personal, personal, BLAKE2B_PERSONALBYTES);
+  }
+  blake2b_init_param_key(state, &P, key);
+}
+
+/**
+ * Initializes blake2b state
+ *
+ * @param      state   blake2b_state instance passed by reference
+ * @param[in]  outlen  the hash output length
+ * @param[in]  key     the key used
+ * @param[in]  keylen  the key length
+ */
+void
+blake2b_init(blake2b_state* state, size_t outlen, const void* key, size_t keylen)
+{
+  blake2b_init_salt_personal(state, outlen, key, keylen, NULL, NULL);
+}
+
 /**
  * Updates blake2b state
  *
@@ -211,24 +599,53 @@ blake2b_update(blake2b_state* state, const unsigned char* input_buffer,
   size_t left = state->buflen;
   size_t fill = BLAKE2B_BLOCKBYTES - left;
   if (inlen > fill) {
+    blake2b_kernel_init();
     state->buflen = 0;
     memcpy(state->buf + left, in, fill);
     blake2b_increment_counter(state, BLAKE2B_BLOCKBYTES);
-    F(state, state->buf);
+    blake2b_compress(state, state->buf);
     in += fill;
     inlen -= fill;
 
-    while (inlen > BLAKE2B_BLOCKBYTES) {
-      blake2b_increment_counter(state, BLAKE2B_BLOCKBYTES);
-      F(state, in);
-      in += BLAKE2B_BLOCKBYTES;
-      inlen -= BLAKE2B_BLOCKBYTES;
+    /* every full block but the last one, which may end the message */
+    if (inlen > BLAKE2B_BLOCKBYTES) {
+      size_t nblocks = (inlen - 1) / BLAKE2B_BLOCKBYTES;
+
+      blake2b_compress_blocks(state, in, nblocks);
+      in += nblocks * BLAKE2B_BLOCKBYTES;
+      inlen -= nblocks * BLAKE2B_BLOCKBYTES;
     }
   }
   memcpy(state->buf + state->buflen, in, inlen);
   state->buflen += inlen;
 }
 
+/**
+ * Copies a state, e.g. to fork the hash of a common prefix into the hashes
+ * of several messages that continue it differently. Only the buffered part
+ * of the input buffer is copied.
+ *
+ * @param[out] dst   the new state
+ * @param[in]  src   the state to copy
+ */
+void
+blake2b_clone(blake2b_state* dst, const blake2b_state* src)
+{
+  size_t i;
+
+  for (i = 0; i < 8; ++i) {
+    dst->h[i] = src->h[i];
+  }
+  dst->t[0] = src->t[0];
+  dst->t[1] = src->t[1];
+  dst->f[0] = src->f[0];
+  dst->f[1] = src->f[1];
+  memcpy(dst->buf, src->buf, src->buflen);
+  dst->buflen = src->buflen;
+  dst->outlen = src->outlen;
+  dst->last_node = src->last_node;
+}
+
 /**
  * Finalizes state, pads final block and stores hash
  *
@@ -247,10 +664,14 @@ blake2b_final(blake2b_state* state, void* out, size_t outlen)
 
   /* set last chunk = true */
   state->f[0] = UINT64_MAX;
+  if (state->last_node) {
+    state->f[1] = UINT64_MAX;
+  }
 
   /* padding */
   memset(state->buf + state->buflen, 0, BLAKE2B_BLOCKBYTES - state->buflen);
-  F(state, state->buf);
+  blake2b_kernel_init();
+  blake2b_compress(state, state->buf);
 
   /* Store back in little endian */
   for (i = 0; i < 8; ++i) {
@@ -261,6 +682,48 @@ blake2b_final(blake2b_state* state, void* out, size_t outlen)
   memcpy(out, buffer, state->outlen);
 }
 
+/**
+ * Unkeyed blake2b of a message that fits in one block, which is also the
+ * last block: a single compression. The default parameter block only has the
+ * digest length, fanout and depth in its first word, so the chaining value is
+ * the IV with that word folded in, the counter is the message length and the
+ * padded block is built straight from the input. None of the state set-up,
+ * buffering and padding of init, update and final is needed.
+ *
+ * @param[out] output  the hash output
+ * @param[in]  outlen  the hash length
+ * @param[in]  input   the message input
+ * @param[in]  inlen   the message length, at most BLAKE2B_BLOCKBYTES
+ */
+static void
+blake2b_short(void* output, size_t outlen, const void* input, size_t inlen)
+{
+  uint8_t block[BLAKE2B_BLOCKBYTES];
+  uint8_t buffer[BLAKE2B_OUTBYTES];
+  blake2b_state state;
+  size_t i;
+
+  /* digest length, key length 0, fanout 1, depth 1 */
+  state.h[0] = blake2b_IV[0] ^ 0x01010000 ^ (uint64_t)outlen;
+  for (i = 1; i < 8; ++i) {
+    state.h[i] = blake2b_IV[i];
+  }
+  state.t[0] = inlen;
+  state.t[1] = 0;
+  state.f[0] = UINT64_MAX;
+  state.f[1] = 0;
+
+  memcpy(block, input, inlen);
+  memset(block + inlen, 0, BLAKE2B_BLOCKBYTES - inlen);
+  blake2b_kernel_init();
+  blake2b_compress(&state, block);
+
+  for (i = 0; i < (outlen + 7) / 8; ++i) {
+    store64(buffer + sizeof(state.h[i]) * i, state.h[i]);
+  }
+  memcpy(output, buffer, outlen);
+}
+
 /**
  * The main blake2b function
  *
@@ -275,9 +738,59 @@ void
 blake2b(void* output, size_t outlen, const void* input, size_t inlen,
         const void* key, size_t keylen)
 {
-  blake2b_state state = {0};
+  blake2b_state state;
+
+  if (keylen == 0 && inlen <= BLAKE2B_BLOCKBYTES) {
+    blake2b_short(output, outlen, input, inlen);
+    return;
+  }
 
   blake2b_init(&state, outlen, key, keylen);
   blake2b_update(&state, (const uint8_t*)input, inlen);
   blake2b_final(&state, output, outlen);
 }
+
+/**
+ * Hashes a message under a full parameter block: salt, personalization and
+ * tree parameters. The digest is P->digest_length bytes.
+ *
+ * @param[out] output  the hash output
+ * @param[in]  input   the message input
+ * @param[in]  inlen   the message length
+ * @param[in]  key     the key, P->key_length bytes
+ * @param[in]  P       the parameter block
+ */
+void
+blake2b_param_hash(void* output, const void* input, size_t inlen,
+                   const void* key, const blake2b_param* P)
+{
+  blake2b_state state;
+
+  blake2b_init_param_key(&state, P, key);
+  blake2b_update(&state, (const uint8_t*)input, inlen);
+  blake2b_final(&state, output, P->digest_length);
+}
+
+/**
+ * blake2b with a salt and a personalization string
+ *
+ * @param[out] output    the hash output
+ * @param[in]  outlen    the hash length
+ * @param[in]  input     the message input
+ * @param[in]  inlen     the message length
+ * @param[in]  key       the key
+ * @param[in]  keylen    the key length
+ * @param[in]  salt      the 16-byte salt, or NULL for none
+ * @param[in]  personal  the 16-byte personalization string, or NULL for none
+ */
+void
+blake2b_salt_personal(void* output, size_t outlen, const void* input,
+                      size_t inlen, const void* key, size_t keylen,
+                      const void* salt, const void* personal)
+{
+  blake2b_state state;
+
+  blake2b_init_salt_personal(&state, outlen, key, keylen, salt, personal);
+  blake2b_update(&state, (const uint8_t*)input, inlen);
+  blake2b_final(&state, output, outlen);
+}
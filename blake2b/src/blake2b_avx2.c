@@ -0,0 +1,199 @@
+#include "blake2b_impl.h"
+#include <stdint.h>
+#include <string.h>
+
+#include <immintrin.h>
+
+/**
+ * AVX2 implementation of the blake2b compress function.
+ *
+ * Each row of the work vector v lives in one YMM register:
+ *
+ *   a = v[0],  v[1],  v[2],  v[3]
+ *   b = v[4],  v[5],  v[6],  v[7]
+ *   c = v[8],  v[9],  v[10], v[11]
+ *   d = v[12], v[13], v[14], v[15]
+ *
+ * so one pass of G1/G2 mixes all four columns. For the diagonal step rows b,
+ * c and d are rotated by one, two and three words with vpermq, which lines the
+ * diagonals up as columns, and rotated back afterwards.
+ */
+
+/**
+ * Helper macros to rotate the four 64-bit words of a YMM register right by
+ * 32, 24, 16 and 63 bits
+ *
+ * @param[in]  x     the register to rotate
+ */
+#define ROTR64_32(x) _mm256_shuffle_epi32((x), _MM_SHUFFLE(2, 3, 0, 1))
+#define ROTR64_24(x) _mm256_shuffle_epi8((x), r24)
+#define ROTR64_16(x) _mm256_shuffle_epi8((x), r16)
+#define ROTR64_63(x) \
+  _mm256_xor_si256(_mm256_srli_epi64((x), 63), _mm256_add_epi64((x), (x)))
+
+/**
+ * Loads the four message words of vector k (0..3) of round r. Both r and k
+ * are literals, so the schedule lookup is resolved at compile time and every
+ * word comes from a fixed slot of m.
+ */
+#define LOADMSG(r, k)                                                   \
+  _mm256_set_epi64x((int64_t)m[blake2b_vec_schedule[r][4 * (k) + 3]],   \
+                    (int64_t)m[blake2b_vec_schedule[r][4 * (k) + 2]],   \
+                    (int64_t)m[blake2b_vec_schedule[r][4 * (k) + 1]],   \
+                    (int64_t)m[blake2b_vec_schedule[r][4 * (k) + 0]])
+
+/**
+ * First and second half of the blake2b mixing function on all four columns
+ * (or diagonals)
+ *
+ * @param  x     the message words to add into row a
+ */
+#define G1(x)                                                 \
+  do {                                                        \
+  a = _mm256_add_epi64(_mm256_add_epi64(a, (x)), b);          \
+  d = ROTR64_32(_mm256_xor_si256(d, a));                      \
+  c = _mm256_add_epi64(c, d);                                 \
+  b = ROTR64_24(_mm256_xor_si256(b, c));                      \
+  } while(0)
+
+#define G2(x)                                                 \
+  do {                                                        \
+  a = _mm256_add_epi64(_mm256_add_epi64(a, (x)), b);          \
+  d = ROTR64_16(_mm256_xor_si256(d, a));                      \
+  c = _mm256_add_epi64(c, d);                                 \
+  b = ROTR64_63(_mm256_xor_si256(b, c));                      \
+  } while(0)
+
+/**
+ * Rotates rows b, c and d so the diagonals line up as columns, and back
+ */
+#define DIAGONALIZE()                                         \
+  do {                                                        \
+  b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(0, 3, 2, 1));   \
+  c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));   \
+  d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(2, 1, 0, 3));   \
+  } while(0)
+
+#define UNDIAGONALIZE()                                       \
+  do {                                                        \
+  b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(2, 1, 0, 3));   \
+  c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));   \
+  d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(0, 3, 2, 1));   \
+  } while(0)
+
+/**
+ * One full round
+ *
+ * @param[in]  r     the round number, must be a literal
+ */
+#define ROUND(r)                                              \
+  do {                                                        \
+  G1(LOADMSG(r, 0));                                          \
+  G2(LOADMSG(r, 1));                                          \
+  DIAGONALIZE();                                              \
+  G1(LOADMSG(r, 2));                                          \
+  G2(LOADMSG(r, 3));                                          \
+  UNDIAGONALIZE();                                            \
+  } while(0)
+
+/**
+ * Mixes one full 128-byte block into the chaining value h0, h1. Inlined into
+ * the loop of blake2b_compress_blocks_avx2, the chaining value stays in two
+ * YMM registers from one block to the next.
+ *
+ * @param      h0     chaining value words 0..3
+ * @param      h1     chaining value words 4..7
+ * @param[in]  tf     the counter and finalization flags, t[0], t[1], f[0], f[1]
+ * @param[in]  block  the input block
+ */
+BLAKE2B_INLINE void
+blake2b_block_avx2(__m256i* h0, __m256i* h1, __m256i tf,
+                   const uint8_t block[BLAKE2B_BLOCKBYTES])
+{
+  const __m256i r16 = _mm256_setr_epi8(
+    2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+    2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+  const __m256i r24 = _mm256_setr_epi8(
+    3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+    3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+  __m256i a, b, c, d;
+  uint64_t m[16];
+
+  /* x86 is little endian, the block can be copied as is */
+  memcpy(m, block, sizeof(m));
+
+  a = *h0;
+  b = *h1;
+  c = _mm256_loadu_si256((const __m256i*)&blake2b_IV[0]);
+  d = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)&blake2b_IV[4]), tf);
+
+  ROUND(0);
+  ROUND(1);
+  ROUND(2);
+  ROUND(3);
+  ROUND(4);
+  ROUND(5);
+  ROUND(6);
+  ROUND(7);
+  ROUND(8);
+  ROUND(9);
+  ROUND(10);
+  ROUND(11);
+
+  *h0 = _mm256_xor_si256(*h0, _mm256_xor_si256(a, c));
+  *h1 = _mm256_xor_si256(*h1, _mm256_xor_si256(b, d));
+}
+
+/**
+ * The blake2b compress function which takes a full 128-byte chunk of the
+ * input message and mixes it into the ongoing state array
+ *
+ * @param      state  blake2b_state instance
+ * @param      block  the input block
+ */
+void
+blake2b_compress_avx2(blake2b_state* state,
+                      const uint8_t block[BLAKE2B_BLOCKBYTES])
+{
+  __m256i h0 = _mm256_loadu_si256((const __m256i*)&state->h[0]);
+  __m256i h1 = _mm256_loadu_si256((const __m256i*)&state->h[4]);
+
+  blake2b_block_avx2(&h0, &h1,
+                     _mm256_loadu_si256((const __m256i*)&state->t[0]), block);
+
+  _mm256_storeu_si256((__m256i*)&state->h[0], h0);
+  _mm256_storeu_si256((__m256i*)&state->h[4], h1);
+}
+
+/**
+ * Compresses consecutive full blocks that are not the last block of the
+ * message, advancing the counter by one block before each of them
+ *
+ * @param      state    blake2b_state instance
+ * @param[in]  in       the input blocks
+ * @param[in]  nblocks  the number of blocks
+ */
+void
+blake2b_compress_blocks_avx2(blake2b_state* state, const uint8_t* in,
+                             size_t nblocks)
+{
+  __m256i h0 = _mm256_loadu_si256((const __m256i*)&state->h[0]);
+  __m256i h1 = _mm256_loadu_si256((const __m256i*)&state->h[4]);
+  uint64_t t0 = state->t[0], t1 = state->t[1];
+  uint64_t f0 = state->f[0], f1 = state->f[1];
+
+  for (; nblocks > 0; --nblocks) {
+    t0 += BLAKE2B_BLOCKBYTES;
+    t1 += (t0 < BLAKE2B_BLOCKBYTES);
+    blake2b_block_avx2(&h0, &h1,
+                       _mm256_set_epi64x((int64_t)f1, (int64_t)f0,
+                                         (int64_t)t1, (int64_t)t0),
+                       in);
+    in += BLAKE2B_BLOCKBYTES;
+  }
+
+  _mm256_storeu_si256((__m256i*)&state->h[0], h0);
+  _mm256_storeu_si256((__m256i*)&state->h[4], h1);
+  state->t[0] = t0;
+  state->t[1] = t1;
+}
@@ -0,0 +1,113 @@
+#include "blake2b.h"
+#include "blake2b_impl.h"
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Number of descriptors sorted by length at a time. The window keeps the
+ * bookkeeping on the stack while still grouping messages of similar length.
+ */
+#define BLAKE2B_BATCH_WINDOW 64
+
+/**
+ * Number of blocks it takes to hash a message, including the key block
+ *
+ * @param[in]  d     the message descriptor
+ */
+static size_t
+blake2b_desc_blocks(const blake2b_desc* d)
+{
+  size_t blocks = (d->inlen + BLAKE2B_BLOCKBYTES - 1) / BLAKE2B_BLOCKBYTES;
+
+  if (d->keylen > 0) {
+    ++blocks;
+  }
+  return blocks > 0 ? blocks : 1;
+}
+
+/**
+ * Sorts a window of descriptors by decreasing number of blocks. Long messages
+ * start first and messages of similar length share the lanes, so the lanes
+ * run out of work at about the same time.
+ *
+ * @param[in]  descs  the descriptors of the window
+ * @param[out] order  indices into descs, longest message first
+ * @param[in]  n      the number of descriptors in the window
+ */
+static void
+blake2b_batch_sort(const blake2b_desc* descs, size_t order[], size_t n)
+{
+  size_t blocks[BLAKE2B_BATCH_WINDOW];
+  size_t i, j, b;
+
+  for (i = 0; i < n; ++i) {
+    b = blake2b_desc_blocks(&descs[i]);
+    for (j = i; j > 0 && blocks[j - 1] < b; --j) {
+      blocks[j] = blocks[j - 1];
+      order[j] = order[j - 1];
+    }
+    blocks[j] = b;
+    order[j] = i;
+  }
+}
+
+/**
+ * Hashes n independent messages, each with its own length, key and digest
+ * size. The messages are spread over the lanes of the widest multi-lane
+ * kernel; a lane whose message is done is refilled with the next one, and
+ * once none are left the last lane takes its place so that the remaining
+ * lanes stay packed. The digests are the same as those of n blake2b() calls.
+ *
+ * @param[in]  descs  the message descriptors
+ * @param[in]  n      the number of descriptors
+ */
+void
+blake2b_batch(const blake2b_desc* descs, size_t n)
+{
+  blake2b_lanes lanes;
+  blake2b_lane_msg msgs[BLAKE2B_MAX_LANES];
+  const blake2b_desc* owner[BLAKE2B_MAX_LANES];
+  const uint8_t* blocks[BLAKE2B_MAX_LANES];
+  size_t order[BLAKE2B_BATCH_WINDOW];
+  size_t start = 0, count = 0, next = 0, active = 0;
+  size_t j;
+  const blake2b_desc* d;
+
+  while (active > 0 || start + next < n) {
+    /* fill the free lanes, sorting the next window when this one is done */
+    while (active < BLAKE2B_MAX_LANES && start + next < n) {
+      if (next == count) {
+        start += count;
+        count = n - start;
+        if (count > BLAKE2B_BATCH_WINDOW) {
+          count = BLAKE2B_BATCH_WINDOW;
+        }
+        blake2b_batch_sort(descs + start, order, count);
+        next = 0;
+      }
+      d = &descs[start + order[next++]];
+      blake2b_lane_msg_start(&lanes, active, &msgs[active], d->outlen, d->in,
+                             d->inlen, d->key, d->keylen);
+      owner[active++] = d;
+    }
+
+    for (j = 0; j < active; ++j) {
+      blocks[j] = blake2b_lane_msg_next(&lanes, j, &msgs[j]);
+    }
+    blake2b_compress_lanes(&lanes, blocks, active);
+
+    for (j = 0; j < active;) {
+      if (!msgs[j].final) {
+        ++j;
+        continue;
+      }
+      blake2b_lanes_store(&lanes, j, (uint8_t*)owner[j]->out,
+                          owner[j]->outlen);
+      if (j != --active) {
+        blake2b_lanes_move(&lanes, j, active);
+        msgs[j] = msgs[active];
+        owner[j] = owner[active];
+      }
+    }
+  }
+}
@@ -0,0 +1,105 @@
+#include "blake2b_impl.h"
+#include <stdint.h>
+
+#if defined(BLAKE2B_X86)
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+  #else
+    #include <cpuid.h>
+  #endif
+#endif
+
+#if defined(BLAKE2B_X86)
+/**
+ * Runs the cpuid instruction
+ *
+ * @param[in]  leaf  the leaf (eax) to query
+ * @param[in]  sub   the subleaf (ecx) to query
+ * @param[out] r     eax, ebx, ecx and edx after cpuid
+ */
+static void
+cpuid(uint32_t leaf, uint32_t sub, uint32_t r[4])
+{
+#if defined(_MSC_VER)
+  int regs[4];
+
+  __cpuidex(regs, (int)leaf, (int)sub);
+  r[0] = (uint32_t)regs[0];
+  r[1] = (uint32_t)regs[1];
+  r[2] = (uint32_t)regs[2];
+  r[3] = (uint32_t)regs[3];
+#else
+  __cpuid_count(leaf, sub, r[0], r[1], r[2], r[3]);
+#endif
+}
+
+/**
+ * Reads XCR0, the register state the operating system saves on context
+ * switches. Only valid when cpuid reports OSXSAVE.
+ */
+static uint64_t
+xgetbv0(void)
+{
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  uint32_t lo, hi;
+
+  __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+  return ((uint64_t)hi << 32) | lo;
+#endif
+}
+#endif
+
+/**
+ * Detects which of the vectorized kernels can run on this CPU. The answer
+ * cannot change while the process runs, so it is only computed once.
+ *
+ * @return     a mask of blake2b_cpu_feature flags
+ */
+int
+blake2b_cpu_features(void)
+{
+  static int features = -1;
+#if defined(BLAKE2B_X86)
+  uint32_t r[4];
+  uint32_t max_leaf;
+  uint64_t xcr0 = 0;
+  int found = 0;
+  int avx = 0;
+
+  if (features >= 0) {
+    return features;
+  }
+
+  cpuid(0, 0, r);
+  max_leaf = r[0];
+
+  cpuid(1, 0, r);
+  if ((r[2] & (1u << 9)) && (r[2] & (1u << 19))) {
+    found |= BLAKE2B_CPU_SSE41;
+  }
+  /* AVX state must also be enabled by the operating system */
+  if ((r[2] & (1u << 27)) && (r[2] & (1u << 28))) {
+    xcr0 = xgetbv0();
+    avx = (xcr0 & 0x06) == 0x06;
+  }
+
+  if (max_leaf >= 7) {
+    cpuid(7, 0, r);
+    if (avx && (r[1] & (1u << 5))) {
+      found |= BLAKE2B_CPU_AVX2;
+    }
+    /* AVX-512F and AVX-512VL, with opmask and ZMM state enabled */
+    if (avx && (xcr0 & 0xe0) == 0xe0 && (r[1] & (1u << 16)) &&
+        (r[1] & (1u << 31))) {
+      found |= BLAKE2B_CPU_AVX512;
+    }
+  }
+
+  features = found;
+#else
+  features = 0;
+#endif
+  return features;
+}
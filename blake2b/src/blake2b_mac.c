@@ -0,0 +1,111 @@
+#include "blake2b.h"
+#include "blake2b_impl.h"
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Keyed hashing with the key absorbed once. blake2b_init with a key runs a
+ * whole compression over the padded key block before any message byte; the
+ * context keeps the chained state after that compression, so every message
+ * hashed under it only pays for its own blocks.
+ *
+ * The key block is the last block of the empty message and is then
+ * compressed with the final flag set, so the context also keeps the digest of
+ * the empty message.
+ */
+
+/**
+ * Initializes a keyed hashing context
+ *
+ * @param[out] ctx     blake2b_mac_ctx instance passed by reference
+ * @param[in]  outlen  the digest size
+ * @param[in]  key     the key, may be NULL if keylen is 0
+ * @param[in]  keylen  the key length, 0 for unkeyed hashing
+ */
+void
+blake2b_mac_init(blake2b_mac_ctx* ctx, size_t outlen, const void* key,
+                 size_t keylen)
+{
+  static const uint8_t zero = 0;
+  blake2b_state state, empty;
+  size_t i;
+
+  blake2b_init(&state, outlen, key, keylen);
+  empty = state;
+  blake2b_final(&empty, ctx->empty, outlen);
+
+  /* one more byte pushes the key block through the compress function */
+  if (keylen > 0) {
+    blake2b_update(&state, &zero, 1);
+  }
+  memset(state.buf, 0, BLAKE2B_BLOCKBYTES);
+  memset(empty.buf, 0, BLAKE2B_BLOCKBYTES);
+
+  for (i = 0; i < 8; ++i) {
+    ctx->h[i] = state.h[i];
+  }
+  ctx->t = state.t[0];
+  ctx->outlen = outlen;
+}
+
+/**
+ * Starts hashing one message under the key of a context. The message is then
+ * fed with blake2b_update and the digest taken with blake2b_mac_final.
+ *
+ * @param[in]  ctx    blake2b_mac_ctx instance, only read
+ * @param[out] state  blake2b_state instance passed by reference
+ */
+void
+blake2b_mac_start(const blake2b_mac_ctx* ctx, blake2b_state* state)
+{
+  size_t i;
+
+  for (i = 0; i < 8; ++i) {
+    state->h[i] = ctx->h[i];
+  }
+  state->t[0] = ctx->t;
+  state->t[1] = 0;
+  state->f[0] = 0;
+  state->f[1] = 0;
+  state->buflen = 0;
+  state->outlen = ctx->outlen;
+  state->last_node = 0;
+}
+
+/**
+ * Finalizes a message started with blake2b_mac_start
+ *
+ * @param[in]  ctx    the blake2b_mac_ctx the message was started with
+ * @param      state  blake2b_state instance
+ * @param[out] out    the digest, ctx->outlen bytes
+ */
+void
+blake2b_mac_final(const blake2b_mac_ctx* ctx, blake2b_state* state, void* out)
+{
+  /* nothing but the key block went in */
+  if (state->buflen == 0 && state->t[0] == ctx->t && state->t[1] == 0) {
+    memcpy(out, ctx->empty, ctx->outlen);
+    return;
+  }
+  blake2b_final(state, out, ctx->outlen);
+}
+
+/**
+ * Hashes one message under the key of a context. The context is only read,
+ * so any number of threads may share it.
+ *
+ * @param[in]  ctx    blake2b_mac_ctx instance
+ * @param[out] out    the digest, ctx->outlen bytes
+ * @param[in]  in     the message
+ * @param[in]  inlen  the message length
+ */
+void
+blake2b_mac(const blake2b_mac_ctx* ctx, void* out, const void* in,
+            size_t inlen)
+{
+  blake2b_state state;
+
+  blake2b_mac_start(ctx, &state);
+  blake2b_update(&state, (const uint8_t*)in, inlen);
+  blake2b_mac_final(ctx, &state, out);
+}
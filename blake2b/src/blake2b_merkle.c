@@ -0,0 +1,357 @@
+#include "blake2b.h"
+#include "blake2b_impl.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+  #include <pthread.h>
+  #define BLAKE2B_THREADS
+#endif
+
+/**
+ * Merkle tree builder: every level of a binary tree over 32-byte digests, in
+ * one arena. Building level by level streams each level through memory once
+ * it no longer fits in cache, so the tree is instead built one subtree of
+ * 2^BLAKE2B_MERKLE_HEIGHT leaves at a time: the leaves of a subtree and the
+ * levels above them stay in L2 until its root is done. The subtrees of a pass
+ * are independent, so passes are split over threads, and the roots of one
+ * pass are the leaves of the next. Pairs are hashed by blake2b_node_lanes,
+ * which fills the multi-lane node kernels.
+ *
+ * A subtree starts at a multiple of its own size on every level, so it reads
+ * and writes its own ranges of each level and an odd node left over at the
+ * end of a level always belongs to the last subtree.
+ */
+
+/**
+ * Levels per subtree: 2048 leaves, 64 KiB of digests and as much again for
+ * the levels above
+ */
+#define BLAKE2B_MERKLE_HEIGHT 11
+
+/**
+ * Pairs handed to blake2b_node_lanes per call
+ */
+#define BLAKE2B_MERKLE_PAIRS 64
+
+/**
+ * What the subtrees of a pass share
+ */
+typedef struct blake2b_merkle_pass
+{
+  const blake2b_merkle* tree;
+  uint8_t* level[BLAKE2B_MERKLE_MAX_LEVELS]; /* writable levels, NULL for
+                                                caller leaves */
+  const uint8_t* data;           /* leaf data to hash first, or NULL */
+  size_t leaflen;                /* the length of each leaf */
+  size_t base;                   /* the level the subtrees start from */
+  size_t height;                 /* the levels each subtree adds */
+} blake2b_merkle_pass;
+
+/**
+ * Hashes consecutive pairs of nodes of one level into the next one
+ *
+ * @param[in]  in      the nodes, 2 * n * 32 bytes
+ * @param[out] out     the parents, n * 32 bytes
+ * @param[in]  n       the number of pairs
+ */
+static void
+blake2b_merkle_pairs(const uint8_t* in, uint8_t* out, size_t n)
+{
+  uint8_t* o[BLAKE2B_MERKLE_PAIRS];
+  const uint8_t* l[BLAKE2B_MERKLE_PAIRS];
+  const uint8_t* r[BLAKE2B_MERKLE_PAIRS];
+  size_t i, m;
+
+  while (n > 0) {
+    m = n < BLAKE2B_MERKLE_PAIRS ? n : BLAKE2B_MERKLE_PAIRS;
+    for (i = 0; i < m; ++i) {
+      o[i] = out + i * 32;
+      l[i] = in + i * 64;
+      r[i] = in + i * 64 + 32;
+    }
+    blake2b_node_lanes(o, l, r, m);
+    in += m * 64;
+    out += m * 32;
+    n -= m;
+  }
+}
+
+/**
+ * Hashes leaves of equal length into their 32-byte digests, eight at a time
+ *
+ * @param[in]  data     the leaves, n * leaflen bytes
+ * @param[in]  leaflen  the length of each leaf
+ * @param[out] out      the digests, n * 32 bytes
+ * @param[in]  n        the number of leaves
+ */
+static void
+blake2b_merkle_leaves(const uint8_t* data, size_t leaflen, uint8_t* out,
+                      size_t n)
+{
+  void* o[8];
+  const void* in[8];
+  size_t i;
+
+  for (; n >= 8; n -= 8) {
+    for (i = 0; i < 8; ++i) {
+      o[i] = out + i * 32;
+      in[i] = data + i * leaflen;
+    }
+    blake2b_x8(o, 32, in, leaflen, NULL, 0);
+    data += 8 * leaflen;
+    out += 8 * 32;
+  }
+  for (; n > 0; --n) {
+    blake2b(out, 32, data, leaflen, NULL, 0);
+    data += leaflen;
+    out += 32;
+  }
+}
+
+/**
+ * Builds the subtrees first .. last-1 of a pass, each all the way up before
+ * the next one
+ *
+ * @param[in]  P      the pass
+ * @param[in]  first  the index of the first subtree
+ * @param[in]  last   one past the index of the last subtree
+ */
+static void
+blake2b_merkle_subtrees(const blake2b_merkle_pass* P, size_t first,
+                        size_t last)
+{
+  const blake2b_merkle* tree = P->tree;
+  size_t j, k, lo, hi, size;
+
+  for (j = first; j < last; ++j) {
+    size = (size_t)1 << P->height;
+    if (P->data != NULL) {
+      lo = j * size;
+      hi = lo + size < tree->count[0] ? lo + size : tree->count[0];
+      blake2b_merkle_leaves(P->data + lo * P->leaflen, P->leaflen,
+                            P->level[0] + lo * 32, hi - lo);
+    }
+    for (k = P->base; k < P->base + P->height; ++k, size >>= 1) {
+      lo = j * size;
+      hi = lo + size < tree->count[k] ? lo + size : tree->count[k];
+      blake2b_merkle_pairs(tree->level[k] + lo * 32,
+                           P->level[k + 1] + lo / 2 * 32, (hi - lo) / 2);
+      /* the last node of an odd level moves up as it is */
+      if ((hi - lo) & 1) {
+        memcpy(P->level[k + 1] + (hi - 1) / 2 * 32,
+               tree->level[k] + (hi - 1) * 32, 32);
+      }
+    }
+  }
+}
+
+#if defined(BLAKE2B_THREADS)
+/**
+ * One thread's share of the subtrees of a pass
+ */
+typedef struct blake2b_merkle_work
+{
+  const blake2b_merkle_pass* pass;
+  size_t first;                  /* first subtree */
+  size_t last;                   /* one past the last subtree */
+} blake2b_merkle_work;
+
+/**
+ * Thread body: builds one share of subtrees
+ *
+ * @param      arg   the blake2b_merkle_work of the thread
+ */
+static void*
+blake2b_merkle_worker(void* arg)
+{
+  blake2b_merkle_work* W = (blake2b_merkle_work*)arg;
+
+  blake2b_merkle_subtrees(W->pass, W->first, W->last);
+  return NULL;
+}
+#endif
+
+/**
+ * Builds all the subtrees of a pass, split in contiguous shares over up to
+ * threads threads
+ *
+ * @param[in]  P        the pass
+ * @param[in]  n        the number of subtrees
+ * @param[in]  threads  the number of threads to use, 0 or 1 for none
+ */
+static void
+blake2b_merkle_run(const blake2b_merkle_pass* P, size_t n, size_t threads)
+{
+#if defined(BLAKE2B_THREADS)
+  blake2b_merkle_work* W = NULL;
+  pthread_t* tids = NULL;
+  size_t share, first = 0;
+  size_t i, started = 0;
+
+  if (threads > n) {
+    threads = n;
+  }
+  if (threads > 1) {
+    W = (blake2b_merkle_work*)malloc((threads - 1) * sizeof(*W));
+    tids = (pthread_t*)malloc((threads - 1) * sizeof(*tids));
+  }
+  if (W != NULL && tids != NULL) {
+    /* the calling thread takes the rest */
+    share = n / threads;
+    for (; started + 1 < threads; ++started) {
+      W[started].pass = P;
+      W[started].first = first;
+      W[started].last = first + share;
+      if (pthread_create(&tids[started], NULL, blake2b_merkle_worker,
+                         &W[started]) != 0) {
+        break;
+      }
+      first += share;
+    }
+  }
+  blake2b_merkle_subtrees(P, first, n);
+  for (i = 0; i < started; ++i) {
+    pthread_join(tids[i], NULL);
+  }
+  free(W);
+  free(tids);
+#else
+  (void)threads;
+  blake2b_merkle_subtrees(P, 0, n);
+#endif
+}
+
+/**
+ * Lays the levels out in one arena and builds them
+ *
+ * @param[out] tree     blake2b_merkle instance passed by reference
+ * @param[in]  leaves   the leaf digests, or NULL to hash data into the arena
+ * @param[in]  data     the leaf data if leaves is NULL
+ * @param[in]  leaflen  the length of each leaf of data
+ * @param[in]  n        the number of leaves
+ * @param[in]  threads  the number of threads to use, 0 or 1 for none
+ *
+ * @return     0 on success, -1 if n is 0 or out of memory
+ */
+static int
+blake2b_merkle_layout(blake2b_merkle* tree, const uint8_t* leaves,
+                      const uint8_t* data, size_t leaflen, size_t n,
+                      size_t threads)
+{
+  blake2b_merkle_pass P;
+  size_t k, nodes, size;
+
+  memset(tree, 0, sizeof(*tree));
+  if (n == 0 || n > SIZE_MAX / 64) {
+    return -1;
+  }
+
+  /* every level but caller leaves lives in the arena */
+  nodes = leaves == NULL ? n : 0;
+  tree->count[0] = n;
+  for (k = 0; tree->count[k] > 1; ++k) {
+    tree->count[k + 1] = (tree->count[k] + 1) / 2;
+    nodes += tree->count[k + 1];
+  }
+  tree->levels = k + 1;
+  tree->arena = (uint8_t*)malloc(nodes > 0 ? nodes * 32 : 1);
+  if (tree->arena == NULL) {
+    return -1;
+  }
+
+  memset(&P, 0, sizeof(P));
+  P.tree = tree;
+  P.data = leaves == NULL ? data : NULL;
+  P.leaflen = leaflen;
+  nodes = 0;
+  for (k = 0; k < tree->levels; ++k) {
+    if (k == 0 && leaves != NULL) {
+      tree->level[0] = leaves;
+      continue;
+    }
+    P.level[k] = tree->arena + nodes * 32;
+    tree->level[k] = P.level[k];
+    nodes += tree->count[k];
+  }
+
+  if (P.data != NULL && tree->levels == 1) {
+    blake2b_merkle_leaves(data, leaflen, P.level[0], 1);
+  }
+  for (P.base = 0; P.base + 1 < tree->levels; P.base += P.height) {
+    P.height = tree->levels - 1 - P.base;
+    if (P.height > BLAKE2B_MERKLE_HEIGHT) {
+      P.height = BLAKE2B_MERKLE_HEIGHT;
+    }
+    size = (size_t)1 << P.height;
+    blake2b_merkle_run(&P, (tree->count[P.base] + size - 1) / size, threads);
+    P.data = NULL;
+  }
+  return 0;
+}
+
+/**
+ * Builds every level of the Merkle tree over some leaf digests. The leaves
+ * are not copied: tree->level[0] points to them, so they must outlive the
+ * tree. The tree does not depend on the number of threads.
+ *
+ * @param[out] tree     blake2b_merkle instance passed by reference
+ * @param[in]  leaves   the leaf digests, n * 32 bytes
+ * @param[in]  n        the number of leaves
+ * @param[in]  threads  the number of threads to use, 0 or 1 for none
+ *
+ * @return     0 on success, -1 if n is 0 or out of memory
+ */
+int
+blake2b_merkle_build(blake2b_merkle* tree, const void* leaves, size_t n,
+                     size_t threads)
+{
+  return blake2b_merkle_layout(tree, (const uint8_t*)leaves, NULL, 0, n,
+                               threads);
+}
+
+/**
+ * Builds every level of the Merkle tree over leaves of equal length, whose
+ * digests are the 32-byte blake2b of each leaf. The digests are computed
+ * subtree by subtree with the rest of the tree and kept as level 0.
+ *
+ * @param[out] tree     blake2b_merkle instance passed by reference
+ * @param[in]  data     the leaves, n * leaflen bytes
+ * @param[in]  leaflen  the length of each leaf
+ * @param[in]  n        the number of leaves
+ * @param[in]  threads  the number of threads to use, 0 or 1 for none
+ *
+ * @return     0 on success, -1 if n is 0 or out of memory
+ */
+int
+blake2b_merkle_build_data(blake2b_merkle* tree, const void* data,
+                          size_t leaflen, size_t n, size_t threads)
+{
+  return blake2b_merkle_layout(tree, NULL, (const uint8_t*)data, leaflen, n,
+                               threads);
+}
+
+/**
+ * Copies out the root of a built tree
+ *
+ * @param[in]  tree  blake2b_merkle instance
+ * @param[out] out   the 32-byte root
+ */
+void
+blake2b_merkle_root(const blake2b_merkle* tree, void* out)
+{
+  memcpy(out, tree->level[tree->levels - 1], 32);
+}
+
+/**
+ * Frees the levels of a tree
+ *
+ * @param      tree  blake2b_merkle instance
+ */
+void
+blake2b_merkle_free(blake2b_merkle* tree)
+{
+  free(tree->arena);
+  tree->arena = NULL;
+}
@@ -0,0 +1,133 @@
+#include "blake2b.h"
+#include "blake2b_impl.h"
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Initializes a job manager with all lanes free
+ *
+ * @param[out] mgr   the job manager
+ */
+void
+blake2b_mgr_init(blake2b_mgr* mgr)
+{
+  mgr->active = 0;
+  mgr->done = NULL;
+  mgr->done_tail = NULL;
+}
+
+/**
+ * Compresses one block into every busy lane until at least one job is done.
+ * Each finished job is stored, appended to the completed list, and its lane
+ * is taken over by the last busy lane so that the busy lanes stay packed.
+ *
+ * @param      mgr   the job manager, with at least one busy lane
+ */
+static void
+blake2b_mgr_run(blake2b_mgr* mgr)
+{
+  const uint8_t* blocks[BLAKE2B_MAX_LANES];
+  blake2b_job* job;
+  size_t j;
+  int finished = 0;
+
+  while (!finished) {
+    for (j = 0; j < mgr->active; ++j) {
+      blocks[j] = blake2b_lane_msg_next(&mgr->lanes, j, &mgr->msgs[j]);
+      finished |= mgr->msgs[j].final;
+    }
+    blake2b_compress_lanes(&mgr->lanes, blocks, mgr->active);
+  }
+
+  for (j = 0; j < mgr->active;) {
+    if (!mgr->msgs[j].final) {
+      ++j;
+      continue;
+    }
+    job = mgr->jobs[j];
+    blake2b_lanes_store(&mgr->lanes, j, (uint8_t*)job->out, job->outlen);
+    job->next = NULL;
+    if (mgr->done == NULL) {
+      mgr->done = job;
+    } else {
+      mgr->done_tail->next = job;
+    }
+    mgr->done_tail = job;
+
+    if (j != --mgr->active) {
+      blake2b_lanes_move(&mgr->lanes, j, mgr->active);
+      mgr->msgs[j] = mgr->msgs[mgr->active];
+      mgr->jobs[j] = mgr->jobs[mgr->active];
+    }
+  }
+}
+
+/**
+ * Takes the oldest job off the completed list
+ *
+ * @param      mgr   the job manager
+ *
+ * @return     the job, or NULL if none has completed
+ */
+static blake2b_job*
+blake2b_mgr_pop(blake2b_mgr* mgr)
+{
+  blake2b_job* job = mgr->done;
+
+  if (job != NULL) {
+    mgr->done = job->next;
+    job->next = NULL;
+  }
+  return job;
+}
+
+/**
+ * Submits a job. The job goes into a free lane; the lanes are only run once
+ * all of them are busy, and then just until one job completes, so a lane is
+ * never left idle while there are jobs to give it. The digest of a job is
+ * written once the job is handed back, and is the same as that of a
+ * blake2b() call. The job and its buffers must stay valid until then.
+ *
+ * @param      mgr   the job manager
+ * @param      job   the job to submit
+ *
+ * @return     a completed job, or NULL if none is ready yet
+ */
+blake2b_job*
+blake2b_mgr_submit(blake2b_mgr* mgr, blake2b_job* job)
+{
+  size_t lane;
+
+  if (mgr->active == BLAKE2B_MAX_LANES) {
+    /* every lane is busy while earlier completed jobs are still queued */
+    blake2b_mgr_run(mgr);
+  }
+
+  lane = mgr->active++;
+  blake2b_lane_msg_start(&mgr->lanes, lane, &mgr->msgs[lane], job->outlen,
+                         job->in, job->inlen, job->key, job->keylen);
+  mgr->jobs[lane] = job;
+
+  if (mgr->active == BLAKE2B_MAX_LANES && mgr->done == NULL) {
+    blake2b_mgr_run(mgr);
+  }
+  return blake2b_mgr_pop(mgr);
+}
+
+/**
+ * Hands back a completed job, running the lanes that are still busy if none
+ * has completed yet. Called repeatedly until it returns NULL, it drains the
+ * manager.
+ *
+ * @param      mgr   the job manager
+ *
+ * @return     a completed job, or NULL once every job has been handed back
+ */
+blake2b_job*
+blake2b_mgr_flush(blake2b_mgr* mgr)
+{
+  if (mgr->done == NULL && mgr->active > 0) {
+    blake2b_mgr_run(mgr);
+  }
+  return blake2b_mgr_pop(mgr);
+}
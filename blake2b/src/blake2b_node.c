@@ -0,0 +1,61 @@
+#include "blake2b.h"
+#include "blake2b_impl.h"
+#include <stdint.h>
+
+/**
+ * Interior nodes of binary Merkle trees over 32-byte digests. The digest of a
+ * node is the unkeyed 32-byte blake2b of its left child followed by its right
+ * child, so hashing one is a single compression of a 64-byte block. Every
+ * function here gives the same digest as blake2b(out, 32, left || right, 64,
+ * NULL, 0), without the parameter block, buffering and padding of the
+ * generic path.
+ */
+
+/**
+ * Hashes one pair of children into their parent node
+ *
+ * @param[out] out    the 32-byte parent digest
+ * @param[in]  left   the 32-byte left child
+ * @param[in]  right  the 32-byte right child
+ */
+void
+blake2b_256_node(void* out, const void* left, const void* right)
+{
+  uint8_t* const o[1] = { (uint8_t*)out };
+  const uint8_t* const l[1] = { (const uint8_t*)left };
+  const uint8_t* const r[1] = { (const uint8_t*)right };
+
+  blake2b_node_lanes(o, l, r, 1);
+}
+
+/**
+ * Hashes four independent pairs of children at once, one per 64-bit lane of
+ * an AVX2 register where available
+ *
+ * @param[out] out    the four 32-byte parent digests
+ * @param[in]  left   the four 32-byte left children
+ * @param[in]  right  the four 32-byte right children
+ */
+void
+blake2b_256_node_x4(void* const out[4], const void* const left[4],
+                    const void* const right[4])
+{
+  blake2b_node_lanes((uint8_t* const*)out, (const uint8_t* const*)left,
+                     (const uint8_t* const*)right, 4);
+}
+
+/**
+ * Hashes eight independent pairs of children at once, one per 64-bit lane of
+ * an AVX-512 register where available
+ *
+ * @param[out] out    the eight 32-byte parent digests
+ * @param[in]  left   the eight 32-byte left children
+ * @param[in]  right  the eight 32-byte right children
+ */
+void
+blake2b_256_node_x8(void* const out[8], const void* const left[8],
+                    const void* const right[8])
+{
+  blake2b_node_lanes((uint8_t* const*)out, (const uint8_t* const*)left,
+                     (const uint8_t* const*)right, 8);
+}
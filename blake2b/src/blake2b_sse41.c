@@ -0,0 +1,240 @@
+#include "blake2b_impl.h"
+#include <stdint.h>
+#include <string.h>
+
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include <tmmintrin.h>
+
+/**
+ * SSE4.1/SSSE3 implementation of the blake2b compress function.
+ *
+ * The work vector v is kept in eight XMM registers, two 64-bit words each:
+ *
+ *   row1l = v[0],  v[1]    row1h = v[2],  v[3]
+ *   row2l = v[4],  v[5]    row2h = v[6],  v[7]
+ *   row3l = v[8],  v[9]    row3h = v[10], v[11]
+ *   row4l = v[12], v[13]   row4h = v[14], v[15]
+ *
+ * so that one pass of the G macros below mixes all four columns at once. The
+ * diagonal step rotates rows 2, 3 and 4 into place with palignr instead of
+ * shuffling words through memory.
+ */
+
+/**
+ * Helper macros to rotate both 64-bit words of an XMM register right by 32,
+ * 24, 16 and 63 bits. Rotations by a multiple of 8 are a single byte shuffle
+ * (pshufd/pshufb), only the rotation by 63 needs the shift/add/xor triple.
+ *
+ * @param[in]  x     the register to rotate
+ */
+#define ROTR64_32(x) _mm_shuffle_epi32((x), _MM_SHUFFLE(2, 3, 0, 1))
+#define ROTR64_24(x) _mm_shuffle_epi8((x), r24)
+#define ROTR64_16(x) _mm_shuffle_epi8((x), r16)
+#define ROTR64_63(x) _mm_xor_si128(_mm_srli_epi64((x), 63), _mm_add_epi64((x), (x)))
+
+/**
+ * Loads the two message words m[i] and m[j] into the low and high half of an
+ * XMM register
+ */
+#define LOADMSG(i, j) _mm_set_epi64x((int64_t)m[(j)], (int64_t)m[(i)])
+
+/**
+ * First half of the blake2b mixing function on all four columns (or diagonals)
+ *
+ * @params  b0, b1  message words for the low and high halves of row 1
+ */
+#define G1(b0, b1)                                            \
+  do {                                                        \
+  row1l = _mm_add_epi64(_mm_add_epi64(row1l, (b0)), row2l);   \
+  row1h = _mm_add_epi64(_mm_add_epi64(row1h, (b1)), row2h);   \
+  row4l = ROTR64_32(_mm_xor_si128(row4l, row1l));             \
+  row4h = ROTR64_32(_mm_xor_si128(row4h, row1h));             \
+  row3l = _mm_add_epi64(row3l, row4l);                        \
+  row3h = _mm_add_epi64(row3h, row4h);                        \
+  row2l = ROTR64_24(_mm_xor_si128(row2l, row3l));             \
+  row2h = ROTR64_24(_mm_xor_si128(row2h, row3h));             \
+  } while(0)
+
+/**
+ * Second half of the blake2b mixing function on all four columns (or diagonals)
+ *
+ * @params  b0, b1  message words for the low and high halves of row 1
+ */
+#define G2(b0, b1)                                            \
+  do {                                                        \
+  row1l = _mm_add_epi64(_mm_add_epi64(row1l, (b0)), row2l);   \
+  row1h = _mm_add_epi64(_mm_add_epi64(row1h, (b1)), row2h);   \
+  row4l = ROTR64_16(_mm_xor_si128(row4l, row1l));             \
+  row4h = ROTR64_16(_mm_xor_si128(row4h, row1h));             \
+  row3l = _mm_add_epi64(row3l, row4l);                        \
+  row3h = _mm_add_epi64(row3h, row4h);                        \
+  row2l = ROTR64_63(_mm_xor_si128(row2l, row3l));             \
+  row2h = ROTR64_63(_mm_xor_si128(row2h, row3h));             \
+  } while(0)
+
+/**
+ * Moves rows 2, 3 and 4 so that the diagonals line up as columns
+ */
+#define DIAGONALIZE()                                         \
+  do {                                                        \
+  t0 = _mm_alignr_epi8(row2h, row2l, 8);                      \
+  t1 = _mm_alignr_epi8(row2l, row2h, 8);                      \
+  row2l = t0;                                                 \
+  row2h = t1;                                                 \
+  t0 = row3l;                                                 \
+  row3l = row3h;                                              \
+  row3h = t0;                                                 \
+  t0 = _mm_alignr_epi8(row4h, row4l, 8);                      \
+  t1 = _mm_alignr_epi8(row4l, row4h, 8);                      \
+  row4l = t1;                                                 \
+  row4h = t0;                                                 \
+  } while(0)
+
+/**
+ * Inverse of DIAGONALIZE()
+ */
+#define UNDIAGONALIZE()                                       \
+  do {                                                        \
+  t0 = _mm_alignr_epi8(row2l, row2h, 8);                      \
+  t1 = _mm_alignr_epi8(row2h, row2l, 8);                      \
+  row2l = t0;                                                 \
+  row2h = t1;                                                 \
+  t0 = row3l;                                                 \
+  row3l = row3h;                                              \
+  row3h = t0;                                                 \
+  t0 = _mm_alignr_epi8(row4l, row4h, 8);                      \
+  t1 = _mm_alignr_epi8(row4h, row4l, 8);                      \
+  row4l = t1;                                                 \
+  row4h = t0;                                                 \
+  } while(0)
+
+/**
+ * One full round. r is a literal, so every blake2b_sigma lookup below is
+ * resolved at compile time and LOADMSG reads a fixed slot of m.
+ *
+ * @param[in]  r     the round number
+ */
+#define ROUND(r)                                                              \
+  do {                                                                        \
+  G1(LOADMSG(blake2b_sigma[r][0], blake2b_sigma[r][2]),                       \
+     LOADMSG(blake2b_sigma[r][4], blake2b_sigma[r][6]));                      \
+  G2(LOADMSG(blake2b_sigma[r][1], blake2b_sigma[r][3]),                       \
+     LOADMSG(blake2b_sigma[r][5], blake2b_sigma[r][7]));                      \
+  DIAGONALIZE();                                                              \
+  G1(LOADMSG(blake2b_sigma[r][8], blake2b_sigma[r][10]),                      \
+     LOADMSG(blake2b_sigma[r][12], blake2b_sigma[r][14]));                    \
+  G2(LOADMSG(blake2b_sigma[r][9], blake2b_sigma[r][11]),                      \
+     LOADMSG(blake2b_sigma[r][13], blake2b_sigma[r][15]));                    \
+  UNDIAGONALIZE();                                                            \
+  } while(0)
+
+/**
+ * Mixes one full 128-byte block into the chaining value h. Inlined into the
+ * loop of blake2b_compress_blocks_sse41, the chaining value stays in four XMM
+ * registers from one block to the next.
+ *
+ * @param      h      the chaining value, two words per register
+ * @param[in]  t      the counter, t[0] and t[1]
+ * @param[in]  f      the finalization flags, f[0] and f[1]
+ * @param[in]  block  the input block
+ */
+BLAKE2B_INLINE void
+blake2b_block_sse41(__m128i h[4], __m128i t, __m128i f,
+                    const uint8_t block[BLAKE2B_BLOCKBYTES])
+{
+  const __m128i r16 =
+    _mm_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+  const __m128i r24 =
+    _mm_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+  __m128i row1l, row1h, row2l, row2h, row3l, row3h, row4l, row4h;
+  __m128i t0, t1;
+  uint64_t m[16];
+
+  /* x86 is little endian, the block can be copied as is */
+  memcpy(m, block, sizeof(m));
+
+  row1l = h[0];
+  row1h = h[1];
+  row2l = h[2];
+  row2h = h[3];
+  row3l = _mm_loadu_si128((const __m128i*)&blake2b_IV[0]);
+  row3h = _mm_loadu_si128((const __m128i*)&blake2b_IV[2]);
+  row4l = _mm_xor_si128(_mm_loadu_si128((const __m128i*)&blake2b_IV[4]), t);
+  row4h = _mm_xor_si128(_mm_loadu_si128((const __m128i*)&blake2b_IV[6]), f);
+
+  ROUND(0);
+  ROUND(1);
+  ROUND(2);
+  ROUND(3);
+  ROUND(4);
+  ROUND(5);
+  ROUND(6);
+  ROUND(7);
+  ROUND(8);
+  ROUND(9);
+  ROUND(10);
+  ROUND(11);
+
+  h[0] = _mm_xor_si128(h[0], _mm_xor_si128(row3l, row1l));
+  h[1] = _mm_xor_si128(h[1], _mm_xor_si128(row3h, row1h));
+  h[2] = _mm_xor_si128(h[2], _mm_xor_si128(row4l, row2l));
+  h[3] = _mm_xor_si128(h[3], _mm_xor_si128(row4h, row2h));
+}
+
+/**
+ * The blake2b compress function which takes a full 128-byte chunk of the
+ * input message and mixes it into the ongoing state array
+ *
+ * @param      state  blake2b_state instance
+ * @param      block  the input block
+ */
+void
+blake2b_compress_sse41(blake2b_state* state,
+                       const uint8_t block[BLAKE2B_BLOCKBYTES])
+{
+  __m128i h[4];
+  size_t i;
+
+  for (i = 0; i < 4; ++i) {
+    h[i] = _mm_loadu_si128((const __m128i*)&state->h[2 * i]);
+  }
+  blake2b_block_sse41(h, _mm_loadu_si128((const __m128i*)&state->t[0]),
+                      _mm_loadu_si128((const __m128i*)&state->f[0]), block);
+  for (i = 0; i < 4; ++i) {
+    _mm_storeu_si128((__m128i*)&state->h[2 * i], h[i]);
+  }
+}
+
+/**
+ * Compresses consecutive full blocks that are not the last block of the
+ * message, advancing the counter by one block before each of them
+ *
+ * @param      state    blake2b_state instance
+ * @param[in]  in       the input blocks
+ * @param[in]  nblocks  the number of blocks
+ */
+void
+blake2b_compress_blocks_sse41(blake2b_state* state, const uint8_t* in,
+                              size_t nblocks)
+{
+  __m128i h[4];
+  __m128i f = _mm_loadu_si128((const __m128i*)&state->f[0]);
+  uint64_t t0 = state->t[0], t1 = state->t[1];
+  size_t i;
+
+  for (i = 0; i < 4; ++i) {
+    h[i] = _mm_loadu_si128((const __m128i*)&state->h[2 * i]);
+  }
+  for (; nblocks > 0; --nblocks) {
+    t0 += BLAKE2B_BLOCKBYTES;
+    t1 += (t0 < BLAKE2B_BLOCKBYTES);
+    blake2b_block_sse41(h, _mm_set_epi64x((int64_t)t1, (int64_t)t0), f, in);
+    in += BLAKE2B_BLOCKBYTES;
+  }
+  for (i = 0; i < 4; ++i) {
+    _mm_storeu_si128((__m128i*)&state->h[2 * i], h[i]);
+  }
+  state->t[0] = t0;
+  state->t[1] = t1;
+}
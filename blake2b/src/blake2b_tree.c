@@ -0,0 +1,441 @@
+#include "blake2b.h"
+#include "blake2b_impl.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+  #include <pthread.h>
+  #define BLAKE2B_THREADS
+#endif
+
+/**
+ * Tree hashing with sequential leaves. The input is cut into leaves of
+ * leaf_length bytes, the last one possibly shorter, and every inner node
+ * hashes the inner_length-byte digests of up to fanout consecutive children
+ * (all of them if fanout is 0). Levels are added until one node is left, the
+ * root, which must be at most depth - 1 levels above the leaves. Leaves are
+ * keyed, inner nodes only carry the key length, and the last node of every
+ * level has the last node flag set.
+ *
+ * Each node is a pure function of its level and offset, which is what lets
+ * subtrees be hashed on any thread or machine, in any order, with the same
+ * result.
+ */
+
+/**
+ * Shape of a tree over an object, and the part of the object at hand
+ */
+typedef struct blake2b_tree
+{
+  const blake2b_param* P;        /* tree parameters */
+  const uint8_t* in;             /* the bytes at hand */
+  uint64_t base;                 /* offset of in within the object */
+  uint64_t total;                /* length of the whole object */
+  const uint8_t* key;            /* key of the leaves */
+  uint64_t nodes[256];           /* number of nodes on each level */
+  size_t root;                   /* level of the root */
+  size_t split;                  /* level whose digests are precomputed */
+  uint64_t split_first;          /* first node of digests */
+  uint8_t* digests;              /* digests of the split level, or NULL */
+} blake2b_tree;
+
+/**
+ * Works out the number of nodes on each level and checks the parameters
+ *
+ * @param[out] T      the tree shape
+ * @param[in]  P      the tree parameters
+ * @param[in]  total  the length of the whole object
+ *
+ * @return     0 on success, -1 if the parameters are invalid or the object
+ *             does not fit in a tree of that depth or in 2^32 leaves
+ */
+static int
+blake2b_tree_shape(blake2b_tree* T, const blake2b_param* P, uint64_t total)
+{
+  uint64_t n;
+
+  if (P->digest_length == 0 || P->digest_length > BLAKE2B_OUTBYTES ||
+      P->key_length > BLAKE2B_KEYBYTES || P->fanout == 1 || P->depth == 0 ||
+      P->leaf_length == 0 || P->inner_length == 0 ||
+      P->inner_length > BLAKE2B_OUTBYTES) {
+    return -1;
+  }
+
+  /* node offsets are 32 bits wide */
+  n = total / P->leaf_length + (total % P->leaf_length != 0);
+  if (n > UINT32_MAX) {
+    return -1;
+  }
+  T->nodes[0] = n > 0 ? n : 1;
+  for (T->root = 0; T->nodes[T->root] > 1; ++T->root) {
+    if (T->root + 1 >= P->depth) {
+      return -1;
+    }
+    n = T->nodes[T->root];
+    T->nodes[T->root + 1] = P->fanout ? (n + P->fanout - 1) / P->fanout : 1;
+  }
+  T->P = P;
+  T->in = NULL;
+  T->base = 0;
+  T->total = total;
+  T->key = NULL;
+  T->split = 0;
+  T->split_first = 0;
+  T->digests = NULL;
+  return 0;
+}
+
+/**
+ * Finds the nodes of a lower level that lie under a given node
+ *
+ * @param[in]  T       the tree
+ * @param[in]  level   the level of the node
+ * @param[in]  offset  the offset of the node within its level
+ * @param[in]  below   the lower level, at most level
+ * @param[out] first   the first node under it
+ * @param[out] last    one past the last node under it
+ */
+static void
+blake2b_tree_range(const blake2b_tree* T, size_t level, uint64_t offset,
+                   size_t below, uint64_t* first, uint64_t* last)
+{
+  uint8_t fanout = T->P->fanout;
+
+  *first = offset;
+  *last = offset + 1;
+  while (level > below) {
+    --level;
+    if (fanout == 0) {
+      *first = 0;
+      *last = T->nodes[level];
+    } else {
+      *first *= fanout;
+      *last *= fanout;
+      if (*last > T->nodes[level]) {
+        *last = T->nodes[level];
+      }
+    }
+  }
+}
+
+/**
+ * Initializes the state of one node: the parameter block with the node
+ * offset and depth filled in, the digest size and the last node flag
+ *
+ * @param[in]  T       the tree
+ * @param[out] S       the node state
+ * @param[in]  level   the level of the node, 0 for leaves
+ * @param[in]  offset  the offset of the node within its level
+ */
+static void
+blake2b_tree_init_node(const blake2b_tree* T, blake2b_state* S, size_t level,
+                       uint64_t offset)
+{
+  blake2b_param P = *T->P;
+
+  P.node_offset = (uint32_t)offset;
+  P.node_depth = (uint8_t)level;
+  blake2b_init_param(S, &P);
+  S->outlen = level == T->root ? P.digest_length : P.inner_length;
+  S->last_node = offset == T->nodes[level] - 1;
+}
+
+/**
+ * Computes the digest of one node, recursing into its children down to the
+ * leaves or to the precomputed digests of the split level
+ *
+ * @param[in]  T       the tree
+ * @param[in]  level   the level of the node, 0 for leaves
+ * @param[in]  offset  the offset of the node within its level
+ * @param[out] out     the digest, digest_length bytes for the root and
+ *                     inner_length bytes otherwise
+ */
+static void
+blake2b_tree_node(const blake2b_tree* T, size_t level, uint64_t offset,
+                  uint8_t* out)
+{
+  uint8_t child[BLAKE2B_OUTBYTES];
+  uint8_t block[BLAKE2B_BLOCKBYTES] = {0};
+  size_t inner = T->P->inner_length;
+  blake2b_state S;
+  uint64_t first, last, c;
+
+  blake2b_tree_init_node(T, &S, level, offset);
+
+  if (level == 0) {
+    if (T->P->key_length > 0) {
+      memcpy(block, T->key, T->P->key_length);
+      blake2b_update(&S, block, BLAKE2B_BLOCKBYTES);
+      memset(block, 0, BLAKE2B_BLOCKBYTES);
+    }
+    first = offset * T->P->leaf_length;
+    last = first + T->P->leaf_length;
+    if (last > T->total) {
+      last = T->total;
+    }
+    if (first < last) {
+      blake2b_update(&S, T->in + (first - T->base), (size_t)(last - first));
+    }
+  } else {
+    blake2b_tree_range(T, level, offset, level - 1, &first, &last);
+    for (c = first; c < last; ++c) {
+      if (T->digests != NULL && level - 1 == T->split) {
+        blake2b_update(&S, T->digests + (c - T->split_first) * inner, inner);
+      } else {
+        blake2b_tree_node(T, level - 1, c, child);
+        blake2b_update(&S, child, inner);
+      }
+    }
+  }
+  blake2b_final(&S, out, S.outlen);
+}
+
+#if defined(BLAKE2B_THREADS)
+/**
+ * Work shared by the threads hashing the nodes of the split level
+ */
+typedef struct blake2b_tree_work
+{
+  blake2b_tree* T;
+  uint64_t next;                 /* next node to hash */
+  uint64_t end;                  /* one past the last node to hash */
+  pthread_mutex_t lock;          /* protects next */
+} blake2b_tree_work;
+
+/**
+ * Thread body: takes nodes of the split level one at a time until none are
+ * left. Where a digest ends up only depends on the node, not on the thread.
+ *
+ * @param      arg   the shared blake2b_tree_work
+ */
+static void*
+blake2b_tree_worker(void* arg)
+{
+  blake2b_tree_work* W = (blake2b_tree_work*)arg;
+  blake2b_tree* T = W->T;
+  uint64_t node;
+
+  for (;;) {
+    pthread_mutex_lock(&W->lock);
+    node = W->next++;
+    pthread_mutex_unlock(&W->lock);
+    if (node >= W->end) {
+      return NULL;
+    }
+    blake2b_tree_node(T, T->split, node,
+                      T->digests + (node - T->split_first) *
+                      T->P->inner_length);
+  }
+}
+#endif
+
+/**
+ * Computes the digest of one node, with the subtrees under it spread over up
+ * to threads threads
+ *
+ * @param      T        the tree, with the bytes under the node at hand
+ * @param[in]  level    the level of the node
+ * @param[in]  offset   the offset of the node within its level
+ * @param[out] out      the digest of the node
+ * @param[in]  threads  the number of threads to use, 0 or 1 for none
+ */
+static void
+blake2b_tree_run(blake2b_tree* T, size_t level, uint64_t offset, uint8_t* out,
+                 size_t threads)
+{
+#if defined(BLAKE2B_THREADS)
+  if (threads > 1 && level > 0) {
+    blake2b_tree_work W;
+    pthread_t* tids;
+    uint64_t first, last;
+    size_t i, started = 0;
+
+    /* the highest level below the node with enough subtrees to balance */
+    T->split = 0;
+    while (T->split + 1 < level) {
+      blake2b_tree_range(T, level, offset, T->split + 1, &first, &last);
+      if (last - first < 4 * threads) {
+        break;
+      }
+      ++T->split;
+    }
+    blake2b_tree_range(T, level, offset, T->split, &first, &last);
+    T->split_first = first;
+    T->digests = (uint8_t*)malloc((size_t)(last - first) *
+                                  T->P->inner_length);
+    tids = (pthread_t*)malloc((threads - 1) * sizeof(*tids));
+
+    /* without the digests, the whole node is hashed on this thread below */
+    if (T->digests != NULL) {
+      W.T = T;
+      W.next = first;
+      W.end = last;
+      pthread_mutex_init(&W.lock, NULL);
+      while (tids != NULL && started + 1 < threads &&
+             pthread_create(&tids[started], NULL, blake2b_tree_worker,
+                            &W) == 0) {
+        ++started;
+      }
+      /* the calling thread drains the work along with the ones started */
+      blake2b_tree_worker(&W);
+      for (i = 0; i < started; ++i) {
+        pthread_join(tids[i], NULL);
+      }
+      pthread_mutex_destroy(&W.lock);
+    }
+    free(tids);
+  }
+#else
+  (void)threads;
+#endif
+
+  blake2b_tree_node(T, level, offset, out);
+  free(T->digests);
+  T->digests = NULL;
+}
+
+/**
+ * Hashes one input as a tree, spreading the subtrees over up to threads
+ * threads. The digest only depends on the input, key and parameters, not on
+ * the number of threads.
+ *
+ * @param[out] out      the digest, P->digest_length bytes
+ * @param[in]  in       the input
+ * @param[in]  inlen    the input length
+ * @param[in]  key      the key, P->key_length bytes
+ * @param[in]  P        the tree parameters: digest_length, key_length,
+ *                      fanout, depth, leaf_length, inner_length and
+ *                      optionally salt and personal; node_offset and
+ *                      node_depth are set for each node
+ * @param[in]  threads  the number of threads to use, 0 or 1 for none
+ *
+ * @return     0 on success, -1 if the parameters are invalid or the input
+ *             does not fit in the tree
+ */
+int
+blake2b_tree_hash(void* out, const void* in, size_t inlen, const void* key,
+                  const blake2b_param* P, size_t threads)
+{
+  blake2b_tree T;
+
+  if (blake2b_tree_shape(&T, P, inlen) != 0) {
+    return -1;
+  }
+  T.in = (const uint8_t*)in;
+  T.key = (const uint8_t*)key;
+  blake2b_tree_run(&T, T.root, 0, (uint8_t*)out, threads);
+  return 0;
+}
+
+/**
+ * Number of nodes on one level of the tree over an object
+ *
+ * @param[in]  P          the tree parameters
+ * @param[in]  total_len  the length of the whole object
+ * @param[in]  level      the level, 0 for the leaves
+ *
+ * @return     the number of nodes, 1 on the level of the root and 0 above it
+ *             or if the parameters are invalid
+ */
+uint64_t
+blake2b_tree_nodes(const blake2b_param* P, uint64_t total_len, size_t level)
+{
+  blake2b_tree T;
+
+  if (blake2b_tree_shape(&T, P, total_len) != 0 || level > T.root) {
+    return 0;
+  }
+  return T.nodes[level];
+}
+
+/**
+ * Computes the digest of one subtree of the tree over an object from the
+ * bytes under it alone, so that separate machines holding separate parts of
+ * the object can each hash their own part. The node is the one at depth
+ * P->node_depth and offset P->node_offset; with a non-zero fanout its bytes
+ * start at node_offset * leaf_length * fanout^node_depth.
+ *
+ * @param[out] out        the digest, inner_length bytes, or digest_length if
+ *                        the node is the root
+ * @param[in]  in         the bytes under the node
+ * @param[in]  inlen      their length
+ * @param[in]  total_len  the length of the whole object
+ * @param[in]  key        the key, P->key_length bytes
+ * @param[in]  P          the tree parameters and the node
+ * @param[in]  threads    the number of threads to use, 0 or 1 for none
+ *
+ * @return     0 on success, -1 if the parameters are invalid, the node is
+ *             not in the tree or inlen is not the length under the node
+ */
+int
+blake2b_tree_subtree(void* out, const void* in, size_t inlen,
+                     uint64_t total_len, const void* key,
+                     const blake2b_param* P, size_t threads)
+{
+  blake2b_tree T;
+  uint64_t first, last;
+  size_t level = P->node_depth;
+
+  if (blake2b_tree_shape(&T, P, total_len) != 0 || level > T.root ||
+      P->node_offset >= T.nodes[level]) {
+    return -1;
+  }
+  blake2b_tree_range(&T, level, P->node_offset, 0, &first, &last);
+  first *= P->leaf_length;
+  last *= P->leaf_length;
+  if (last > total_len) {
+    last = total_len;
+  }
+  if (inlen != last - first) {
+    return -1;
+  }
+
+  T.in = (const uint8_t*)in;
+  T.base = first;
+  T.key = (const uint8_t*)key;
+  blake2b_tree_run(&T, level, P->node_offset, (uint8_t*)out, threads);
+  return 0;
+}
+
+/**
+ * Computes the digest of an inner node from the digests of its children,
+ * without any of the bytes under it. Applied level by level to the digests
+ * returned by blake2b_tree_subtree it yields the digest of the whole object.
+ * The node is the one at depth P->node_depth and offset P->node_offset.
+ *
+ * @param[out] out        the digest, inner_length bytes, or digest_length if
+ *                        the node is the root
+ * @param[in]  digests    the inner_length-byte digests of the children, in
+ *                        order
+ * @param[in]  count      the number of children
+ * @param[in]  total_len  the length of the whole object
+ * @param[in]  P          the tree parameters and the node
+ *
+ * @return     0 on success, -1 if the parameters are invalid, the node is
+ *             not an inner node of the tree or count is not its number of
+ *             children
+ */
+int
+blake2b_tree_merge(void* out, const void* digests, size_t count,
+                   uint64_t total_len, const blake2b_param* P)
+{
+  blake2b_tree T;
+  blake2b_state S;
+  uint64_t first, last;
+  size_t level = P->node_depth;
+
+  if (blake2b_tree_shape(&T, P, total_len) != 0 || level == 0 ||
+      level > T.root || P->node_offset >= T.nodes[level]) {
+    return -1;
+  }
+  blake2b_tree_range(&T, level, P->node_offset, level - 1, &first, &last);
+  if (count != last - first) {
+    return -1;
+  }
+
+  blake2b_tree_init_node(&T, &S, level, P->node_offset);
+  blake2b_update(&S, (const uint8_t*)digests, count * P->inner_length);
+  blake2b_final(&S, out, S.outlen);
+  return 0;
+}
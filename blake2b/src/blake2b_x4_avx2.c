@@ -0,0 +1,237 @@
+#include "blake2b_impl.h"
+#include <stdint.h>
+
+#include <immintrin.h>
+
+/**
+ * AVX2 implementation of the blake2b compress function over four independent
+ * lanes.
+ *
+ * Unlike the single-stream kernels, the state is transposed: v[i] holds word
+ * i of the work vector of all four lanes, one lane per 64-bit element, and
+ * m[i] holds message word i of all four blocks. Every G therefore works on
+ * four unrelated messages at once and no diagonalization is needed.
+ */
+
+/**
+ * Helper macros to rotate the four 64-bit words of a YMM register right by
+ * 32, 24, 16 and 63 bits
+ *
+ * @param[in]  x     the register to rotate
+ */
+#define ROTR64_32(x) _mm256_shuffle_epi32((x), _MM_SHUFFLE(2, 3, 0, 1))
+#define ROTR64_24(x) _mm256_shuffle_epi8((x), r24)
+#define ROTR64_16(x) _mm256_shuffle_epi8((x), r16)
+#define ROTR64_63(x) \
+  _mm256_xor_si256(_mm256_srli_epi64((x), 63), _mm256_add_epi64((x), (x)))
+
+/**
+ * The blake2b mixing function on four lanes at once
+ *
+ * @params  a, b, c, d  work vector entries of all lanes
+ * @params  x, y        message words of all lanes
+ */
+#define G(a, b, c, d, x, y)                                   \
+  do {                                                        \
+  a = _mm256_add_epi64(_mm256_add_epi64(a, b), x);            \
+  d = ROTR64_32(_mm256_xor_si256(d, a));                      \
+  c = _mm256_add_epi64(c, d);                                 \
+  b = ROTR64_24(_mm256_xor_si256(b, c));                      \
+  a = _mm256_add_epi64(_mm256_add_epi64(a, b), y);            \
+  d = ROTR64_16(_mm256_xor_si256(d, a));                      \
+  c = _mm256_add_epi64(c, d);                                 \
+  b = ROTR64_63(_mm256_xor_si256(b, c));                      \
+  } while(0)
+
+/**
+ * Message word k of round r
+ */
+#define M(r, k) m[blake2b_sigma[r][k]]
+
+/**
+ * One full round
+ *
+ * @param[in]  r     the round number, must be a literal
+ */
+#define ROUND(r)                                              \
+  do {                                                        \
+  G(v[0], v[4], v[8], v[12], M(r, 0), M(r, 1));               \
+  G(v[1], v[5], v[9], v[13], M(r, 2), M(r, 3));               \
+  G(v[2], v[6], v[10], v[14], M(r, 4), M(r, 5));              \
+  G(v[3], v[7], v[11], v[15], M(r, 6), M(r, 7));              \
+  G(v[0], v[5], v[10], v[15], M(r, 8), M(r, 9));              \
+  G(v[1], v[6], v[11], v[12], M(r, 10), M(r, 11));            \
+  G(v[2], v[7], v[8], v[13], M(r, 12), M(r, 13));             \
+  G(v[3], v[4], v[9], v[14], M(r, 14), M(r, 15));             \
+  } while(0)
+
+/**
+ * Loads 32 bytes from each of the four pointers p[0] .. p[3] and transposes
+ * them so that m[4k + i] holds word i of every lane
+ *
+ * @param[in]  p     one input pointer per lane
+ * @param[in]  k     which group of four message words to fill
+ */
+#define LOADWORDS(p, k)                                                     \
+  do {                                                                      \
+  __m256i r0 = _mm256_loadu_si256((const __m256i*)(p)[0]);                  \
+  __m256i r1 = _mm256_loadu_si256((const __m256i*)(p)[1]);                  \
+  __m256i r2 = _mm256_loadu_si256((const __m256i*)(p)[2]);                  \
+  __m256i r3 = _mm256_loadu_si256((const __m256i*)(p)[3]);                  \
+  __m256i t0 = _mm256_unpacklo_epi64(r0, r1);                               \
+  __m256i t1 = _mm256_unpackhi_epi64(r0, r1);                               \
+  __m256i t2 = _mm256_unpacklo_epi64(r2, r3);                               \
+  __m256i t3 = _mm256_unpackhi_epi64(r2, r3);                               \
+  m[4 * (k) + 0] = _mm256_permute2x128_si256(t0, t2, 0x20);                 \
+  m[4 * (k) + 1] = _mm256_permute2x128_si256(t1, t3, 0x20);                 \
+  m[4 * (k) + 2] = _mm256_permute2x128_si256(t0, t2, 0x31);                 \
+  m[4 * (k) + 3] = _mm256_permute2x128_si256(t1, t3, 0x31);                 \
+  } while(0)
+
+/**
+ * Loads message words 4k .. 4k+3 of the four blocks, transposed
+ *
+ * @param[in]  k     which group of four words to load
+ */
+#define LOADMSG(k)                                                          \
+  do {                                                                      \
+  const uint8_t* const p[4] = {                                             \
+    blocks[0] + 32 * (k), blocks[1] + 32 * (k),                             \
+    blocks[2] + 32 * (k), blocks[3] + 32 * (k)                              \
+  };                                                                        \
+  LOADWORDS(p, k);                                                          \
+  } while(0)
+
+/**
+ * Compresses one full 128-byte block into each of the lanes lane .. lane+3
+ *
+ * @param      lanes   the transposed states
+ * @param[in]  lane    the first lane to compress
+ * @param[in]  blocks  one input block per lane
+ */
+void
+blake2b_compress_x4_avx2(blake2b_lanes* lanes, size_t lane,
+                         const uint8_t* const blocks[4])
+{
+  const __m256i r16 = _mm256_setr_epi8(
+    2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+    2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+  const __m256i r24 = _mm256_setr_epi8(
+    3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+    3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+  __m256i v[16], m[16];
+  size_t i;
+
+  /* x86 is little endian, the blocks can be transposed as they are */
+  LOADMSG(0);
+  LOADMSG(1);
+  LOADMSG(2);
+  LOADMSG(3);
+
+  for (i = 0; i < 8; ++i) {
+    v[i] = _mm256_loadu_si256((const __m256i*)&lanes->h[i][lane]);
+    v[i + 8] = _mm256_set1_epi64x((int64_t)blake2b_IV[i]);
+  }
+  v[12] = _mm256_xor_si256(v[12],
+    _mm256_loadu_si256((const __m256i*)&lanes->t[0][lane]));
+  v[13] = _mm256_xor_si256(v[13],
+    _mm256_loadu_si256((const __m256i*)&lanes->t[1][lane]));
+  v[14] = _mm256_xor_si256(v[14],
+    _mm256_loadu_si256((const __m256i*)&lanes->f[0][lane]));
+  v[15] = _mm256_xor_si256(v[15],
+    _mm256_loadu_si256((const __m256i*)&lanes->f[1][lane]));
+
+  ROUND(0);
+  ROUND(1);
+  ROUND(2);
+  ROUND(3);
+  ROUND(4);
+  ROUND(5);
+  ROUND(6);
+  ROUND(7);
+  ROUND(8);
+  ROUND(9);
+  ROUND(10);
+  ROUND(11);
+
+  for (i = 0; i < 8; ++i) {
+    __m256i h = _mm256_loadu_si256((const __m256i*)&lanes->h[i][lane]);
+    h = _mm256_xor_si256(h, _mm256_xor_si256(v[i], v[i + 8]));
+    _mm256_storeu_si256((__m256i*)&lanes->h[i][lane], h);
+  }
+}
+
+/**
+ * Hashes four 32-byte node pairs, each into a 32-byte unkeyed blake2b digest
+ * of left || right. That is one compression of a fixed block: the chaining
+ * value is the IV with the parameter block folded in, the counter is 64, the
+ * last block flag is set and message words 8 .. 15 are zero, so all of it is
+ * constant and only the two children are loaded. Only the four words of the
+ * chaining value that make up the digest are computed and stored.
+ *
+ * @param      out    one 32-byte output per lane
+ * @param[in]  left   one 32-byte left child per lane
+ * @param[in]  right  one 32-byte right child per lane
+ */
+void
+blake2b_node_x4_avx2(uint8_t* const out[4], const uint8_t* const left[4],
+                     const uint8_t* const right[4])
+{
+  const __m256i r16 = _mm256_setr_epi8(
+    2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+    2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+  const __m256i r24 = _mm256_setr_epi8(
+    3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+    3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+  __m256i v[16], m[16], h[4], t0, t1, t2, t3;
+  size_t i;
+
+  LOADWORDS(left, 0);
+  LOADWORDS(right, 1);
+  for (i = 8; i < 16; ++i) {
+    m[i] = _mm256_setzero_si256();
+  }
+
+  for (i = 0; i < 8; ++i) {
+    v[i] = _mm256_set1_epi64x((int64_t)blake2b_IV[i]);
+    v[i + 8] = v[i];
+  }
+  /* digest length 32, fanout 1, depth 1; 64 bytes; last block */
+  v[0] = _mm256_set1_epi64x((int64_t)(blake2b_IV[0] ^ 0x01010020));
+  v[12] = _mm256_set1_epi64x((int64_t)(blake2b_IV[4] ^ 64));
+  v[14] = _mm256_set1_epi64x((int64_t)~blake2b_IV[6]);
+  for (i = 0; i < 4; ++i) {
+    h[i] = v[i];
+  }
+
+  ROUND(0);
+  ROUND(1);
+  ROUND(2);
+  ROUND(3);
+  ROUND(4);
+  ROUND(5);
+  ROUND(6);
+  ROUND(7);
+  ROUND(8);
+  ROUND(9);
+  ROUND(10);
+  ROUND(11);
+
+  for (i = 0; i < 4; ++i) {
+    h[i] = _mm256_xor_si256(h[i], _mm256_xor_si256(v[i], v[i + 8]));
+  }
+
+  /* back from word-major to lane-major */
+  t0 = _mm256_unpacklo_epi64(h[0], h[1]);
+  t1 = _mm256_unpackhi_epi64(h[0], h[1]);
+  t2 = _mm256_unpacklo_epi64(h[2], h[3]);
+  t3 = _mm256_unpackhi_epi64(h[2], h[3]);
+  _mm256_storeu_si256((__m256i*)out[0],
+                      _mm256_permute2x128_si256(t0, t2, 0x20));
+  _mm256_storeu_si256((__m256i*)out[1],
+                      _mm256_permute2x128_si256(t1, t3, 0x20));
+  _mm256_storeu_si256((__m256i*)out[2],
+                      _mm256_permute2x128_si256(t0, t2, 0x31));
+  _mm256_storeu_si256((__m256i*)out[3],
+                      _mm256_permute2x128_si256(t1, t3, 0x31));
+}
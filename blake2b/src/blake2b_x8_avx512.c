@@ -0,0 +1,255 @@
+#include "blake2b_impl.h"
+#include <stdint.h>
+
+#include <immintrin.h>
+
+/**
+ * AVX-512F implementation of the blake2b compress function over eight
+ * independent lanes.
+ *
+ * Same transposed layout as the four-lane AVX2 kernel, with one lane per
+ * 64-bit element of a ZMM register. Every rotation is a single vprorq and the
+ * feed-forward three-way XOR a single vpternlogq.
+ */
+
+/**
+ * Helper macro to rotate the eight 64-bit words of a ZMM register right by c
+ * bits with a native vector rotate
+ *
+ * @param[in]  x     the register to rotate
+ * @param[in]  c     offset to rotate by
+ */
+#define ROTR64(x, c) _mm512_ror_epi64((x), (c))
+
+/**
+ * Three-way XOR of ZMM registers, a single vpternlogq
+ */
+#define XOR3(x, y, z) _mm512_ternarylogic_epi64((x), (y), (z), 0x96)
+
+/**
+ * The blake2b mixing function on eight lanes at once
+ *
+ * @params  a, b, c, d  work vector entries of all lanes
+ * @params  x, y        message words of all lanes
+ */
+#define G(a, b, c, d, x, y)                                   \
+  do {                                                        \
+  a = _mm512_add_epi64(_mm512_add_epi64(a, b), x);            \
+  d = ROTR64(_mm512_xor_si512(d, a), 32);                     \
+  c = _mm512_add_epi64(c, d);                                 \
+  b = ROTR64(_mm512_xor_si512(b, c), 24);                     \
+  a = _mm512_add_epi64(_mm512_add_epi64(a, b), y);            \
+  d = ROTR64(_mm512_xor_si512(d, a), 16);                     \
+  c = _mm512_add_epi64(c, d);                                 \
+  b = ROTR64(_mm512_xor_si512(b, c), 63);                     \
+  } while(0)
+
+/**
+ * Message word k of round r
+ */
+#define M(r, k) m[blake2b_sigma[r][k]]
+
+/**
+ * One full round
+ *
+ * @param[in]  r     the round number, must be a literal
+ */
+#define ROUND(r)                                              \
+  do {                                                        \
+  G(v[0], v[4], v[8], v[12], M(r, 0), M(r, 1));               \
+  G(v[1], v[5], v[9], v[13], M(r, 2), M(r, 3));               \
+  G(v[2], v[6], v[10], v[14], M(r, 4), M(r, 5));              \
+  G(v[3], v[7], v[11], v[15], M(r, 6), M(r, 7));              \
+  G(v[0], v[5], v[10], v[15], M(r, 8), M(r, 9));              \
+  G(v[1], v[6], v[11], v[12], M(r, 10), M(r, 11));            \
+  G(v[2], v[7], v[8], v[13], M(r, 12), M(r, 13));             \
+  G(v[3], v[4], v[9], v[14], M(r, 14), M(r, 15));             \
+  } while(0)
+
+/**
+ * Transposes eight rows of eight 64-bit words, one row per lane, so that m[i]
+ * holds word i of every lane. Three rounds of unpack and 128-bit lane
+ * shuffles transpose the 8x8 matrix.
+ *
+ * @param[out] m     the transposed message words
+ * @param[in]  r     one row of eight message words per lane
+ */
+static inline void
+transpose_msg(__m512i m[8], const __m512i r[8])
+{
+  const int lo = _MM_SHUFFLE(2, 0, 2, 0);
+  const int hi = _MM_SHUFFLE(3, 1, 3, 1);
+  __m512i t[8], s[8];
+  size_t j;
+
+  /* pairs of rows: words 0, 2, 4, 6 and 1, 3, 5, 7 */
+  for (j = 0; j < 8; j += 2) {
+    t[j] = _mm512_unpacklo_epi64(r[j], r[j + 1]);
+    t[j + 1] = _mm512_unpackhi_epi64(r[j], r[j + 1]);
+  }
+  /* quads of rows: words 0 and 4, 2 and 6, 1 and 5, 3 and 7 */
+  for (j = 0; j < 8; j += 4) {
+    s[j] = _mm512_shuffle_i64x2(t[j], t[j + 2], lo);
+    s[j + 1] = _mm512_shuffle_i64x2(t[j], t[j + 2], hi);
+    s[j + 2] = _mm512_shuffle_i64x2(t[j + 1], t[j + 3], lo);
+    s[j + 3] = _mm512_shuffle_i64x2(t[j + 1], t[j + 3], hi);
+  }
+  m[0] = _mm512_shuffle_i64x2(s[0], s[4], lo);
+  m[4] = _mm512_shuffle_i64x2(s[0], s[4], hi);
+  m[2] = _mm512_shuffle_i64x2(s[1], s[5], lo);
+  m[6] = _mm512_shuffle_i64x2(s[1], s[5], hi);
+  m[1] = _mm512_shuffle_i64x2(s[2], s[6], lo);
+  m[5] = _mm512_shuffle_i64x2(s[2], s[6], hi);
+  m[3] = _mm512_shuffle_i64x2(s[3], s[7], lo);
+  m[7] = _mm512_shuffle_i64x2(s[3], s[7], hi);
+}
+
+/**
+ * Loads message words 8k .. 8k+7 of the eight blocks and transposes them so
+ * that m[8k + i] holds word 8k + i of every lane
+ *
+ * @param[out] m       the transposed message words
+ * @param[in]  blocks  one input block per lane
+ * @param[in]  k       which half of the blocks to load
+ */
+static inline void
+load_msg(__m512i m[16], const uint8_t* const blocks[8], size_t k)
+{
+  __m512i r[8];
+  size_t j;
+
+  for (j = 0; j < 8; ++j) {
+    r[j] = _mm512_loadu_si512((const void*)(blocks[j] + 64 * k));
+  }
+  transpose_msg(m + 8 * k, r);
+}
+
+/**
+ * Compresses one full 128-byte block into each of the lanes lane .. lane+7
+ *
+ * @param      lanes   the transposed states
+ * @param[in]  lane    the first lane to compress
+ * @param[in]  blocks  one input block per lane
+ */
+void
+blake2b_compress_x8_avx512(blake2b_lanes* lanes, size_t lane,
+                           const uint8_t* const blocks[8])
+{
+  __m512i v[16], m[16];
+  size_t i;
+
+  /* x86 is little endian, the blocks can be transposed as they are */
+  load_msg(m, blocks, 0);
+  load_msg(m, blocks, 1);
+
+  for (i = 0; i < 8; ++i) {
+    v[i] = _mm512_loadu_si512((const void*)&lanes->h[i][lane]);
+    v[i + 8] = _mm512_set1_epi64((int64_t)blake2b_IV[i]);
+  }
+  v[12] = _mm512_xor_si512(v[12],
+    _mm512_loadu_si512((const void*)&lanes->t[0][lane]));
+  v[13] = _mm512_xor_si512(v[13],
+    _mm512_loadu_si512((const void*)&lanes->t[1][lane]));
+  v[14] = _mm512_xor_si512(v[14],
+    _mm512_loadu_si512((const void*)&lanes->f[0][lane]));
+  v[15] = _mm512_xor_si512(v[15],
+    _mm512_loadu_si512((const void*)&lanes->f[1][lane]));
+
+  ROUND(0);
+  ROUND(1);
+  ROUND(2);
+  ROUND(3);
+  ROUND(4);
+  ROUND(5);
+  ROUND(6);
+  ROUND(7);
+  ROUND(8);
+  ROUND(9);
+  ROUND(10);
+  ROUND(11);
+
+  for (i = 0; i < 8; ++i) {
+    __m512i h = _mm512_loadu_si512((const void*)&lanes->h[i][lane]);
+    _mm512_storeu_si512((void*)&lanes->h[i][lane], XOR3(h, v[i], v[i + 8]));
+  }
+}
+
+/**
+ * Hashes eight 32-byte node pairs, each into a 32-byte unkeyed blake2b digest
+ * of left || right. That is one compression of a fixed block: the chaining
+ * value is the IV with the parameter block folded in, the counter is 64, the
+ * last block flag is set and message words 8 .. 15 are zero, so all of it is
+ * constant and only the two children are loaded. Only the four words of the
+ * chaining value that make up the digest are computed and stored.
+ *
+ * @param      out    one 32-byte output per lane
+ * @param[in]  left   one 32-byte left child per lane
+ * @param[in]  right  one 32-byte right child per lane
+ */
+void
+blake2b_node_x8_avx512(uint8_t* const out[8], const uint8_t* const left[8],
+                       const uint8_t* const right[8])
+{
+  /* lanes 0 and 2, 4 and 6 of a pair of unpacked rows */
+  const __m512i even = _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11);
+  const __m512i odd = _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15);
+  __m512i v[16], m[16], r[8], h[4], t0, t1, t2, t3, x;
+  size_t i;
+
+  for (i = 0; i < 8; ++i) {
+    r[i] = _mm512_inserti64x4(
+      _mm512_castsi256_si512(_mm256_loadu_si256((const __m256i*)left[i])),
+      _mm256_loadu_si256((const __m256i*)right[i]), 1);
+  }
+  transpose_msg(m, r);
+  for (i = 8; i < 16; ++i) {
+    m[i] = _mm512_setzero_si512();
+  }
+
+  for (i = 0; i < 8; ++i) {
+    v[i] = _mm512_set1_epi64((int64_t)blake2b_IV[i]);
+    v[i + 8] = v[i];
+  }
+  /* digest length 32, fanout 1, depth 1; 64 bytes; last block */
+  v[0] = _mm512_set1_epi64((int64_t)(blake2b_IV[0] ^ 0x01010020));
+  v[12] = _mm512_set1_epi64((int64_t)(blake2b_IV[4] ^ 64));
+  v[14] = _mm512_set1_epi64((int64_t)~blake2b_IV[6]);
+  for (i = 0; i < 4; ++i) {
+    h[i] = v[i];
+  }
+
+  ROUND(0);
+  ROUND(1);
+  ROUND(2);
+  ROUND(3);
+  ROUND(4);
+  ROUND(5);
+  ROUND(6);
+  ROUND(7);
+  ROUND(8);
+  ROUND(9);
+  ROUND(10);
+  ROUND(11);
+
+  for (i = 0; i < 4; ++i) {
+    h[i] = XOR3(h[i], v[i], v[i + 8]);
+  }
+
+  /* back from word-major to lane-major, two lanes per register */
+  t0 = _mm512_unpacklo_epi64(h[0], h[1]);
+  t1 = _mm512_unpackhi_epi64(h[0], h[1]);
+  t2 = _mm512_unpacklo_epi64(h[2], h[3]);
+  t3 = _mm512_unpackhi_epi64(h[2], h[3]);
+  x = _mm512_permutex2var_epi64(t0, even, t2);
+  _mm256_storeu_si256((__m256i*)out[0], _mm512_castsi512_si256(x));
+  _mm256_storeu_si256((__m256i*)out[2], _mm512_extracti64x4_epi64(x, 1));
+  x = _mm512_permutex2var_epi64(t0, odd, t2);
+  _mm256_storeu_si256((__m256i*)out[4], _mm512_castsi512_si256(x));
+  _mm256_storeu_si256((__m256i*)out[6], _mm512_extracti64x4_epi64(x, 1));
+  x = _mm512_permutex2var_epi64(t1, even, t3);
+  _mm256_storeu_si256((__m256i*)out[1], _mm512_castsi512_si256(x));
+  _mm256_storeu_si256((__m256i*)out[3], _mm512_extracti64x4_epi64(x, 1));
+  x = _mm512_permutex2var_epi64(t1, odd, t3);
+  _mm256_storeu_si256((__m256i*)out[5], _mm512_castsi512_si256(x));
+  _mm256_storeu_si256((__m256i*)out[7], _mm512_extracti64x4_epi64(x, 1));
+}
@@ -0,0 +1,210 @@
+#include "blake2b.h"
+#include "blake2b_impl.h"
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * BLAKE2bp: blake2b in a tree of fanout 4 and depth 2. Block i of the input
+ * goes to leaf i mod 4, and the root hashes the four 64-byte leaf digests.
+ * The leaves are the lanes of a blake2b_lanes instance, so every stripe of
+ * four consecutive blocks is compressed by one multi-lane kernel call.
+ */
+
+#define BLAKE2BP_STRIPE (BLAKE2BP_LEAVES * BLAKE2B_BLOCKBYTES)
+
+/**
+ * Fills in the parameter block shared by the leaves and the root
+ *
+ * @param[out] P       the parameter block
+ * @param[in]  outlen  the digest size of the whole tree
+ * @param[in]  keylen  the key length
+ */
+static void
+blake2bp_param(blake2b_param* P, size_t outlen, size_t keylen)
+{
+  memset(P, 0, sizeof(*P));
+  P->digest_length = (uint8_t)outlen;
+  P->key_length = (uint8_t)keylen;
+  P->fanout = BLAKE2BP_LEAVES;
+  P->depth = 2;
+  P->inner_length = BLAKE2B_OUTBYTES;
+}
+
+/**
+ * Initializes a BLAKE2bp state
+ *
+ * @param      state   blake2bp_state instance passed by reference
+ * @param[in]  outlen  the hash output length
+ * @param[in]  key     the key, may be NULL if keylen is 0
+ * @param[in]  keylen  the key length
+ */
+void
+blake2bp_init(blake2bp_state* state, size_t outlen, const void* key,
+              size_t keylen)
+{
+  blake2b_param P;
+  size_t i;
+
+  blake2bp_param(&P, outlen, keylen);
+  for (i = 0; i < BLAKE2BP_LEAVES; ++i) {
+    P.node_offset = (uint32_t)i;
+    blake2b_lanes_init(&state->leaves, i, &P);
+  }
+  state->buflen = 0;
+  state->outlen = outlen;
+
+  /* the key block is only absorbed once it is known not to be the last one */
+  memset(state->key, 0, sizeof(state->key));
+  if (keylen > 0) {
+    memcpy(state->key, key, keylen);
+  }
+  state->keylen = keylen;
+  state->key_pending = keylen > 0;
+}
+
+/**
+ * Compresses one stripe of four blocks, one into each leaf. The caller makes
+ * sure that every leaf gets more input after this stripe, so none of these
+ * blocks is the last one of its leaf.
+ *
+ * @param      state   blake2bp_state instance
+ * @param[in]  stripe  four consecutive input blocks
+ */
+static void
+blake2bp_stripe(blake2bp_state* state, const uint8_t* stripe)
+{
+  const uint8_t* blocks[BLAKE2BP_LEAVES];
+  uint8_t key_block[BLAKE2B_BLOCKBYTES] = {0};
+  blake2b_lanes* leaves = &state->leaves;
+  size_t i;
+
+  if (state->key_pending) {
+    memcpy(key_block, state->key, state->keylen);
+    for (i = 0; i < BLAKE2BP_LEAVES; ++i) {
+      blocks[i] = key_block;
+      leaves->t[0][i] += BLAKE2B_BLOCKBYTES;
+    }
+    blake2b_compress_lanes(leaves, blocks, BLAKE2BP_LEAVES);
+    memset(key_block, 0, sizeof(key_block));
+    state->key_pending = 0;
+  }
+
+  for (i = 0; i < BLAKE2BP_LEAVES; ++i) {
+    blocks[i] = stripe + i * BLAKE2B_BLOCKBYTES;
+    leaves->t[0][i] += BLAKE2B_BLOCKBYTES;
+    leaves->t[1][i] += (leaves->t[0][i] < BLAKE2B_BLOCKBYTES);
+  }
+  blake2b_compress_lanes(leaves, blocks, BLAKE2BP_LEAVES);
+}
+
+/**
+ * Updates a BLAKE2bp state with more input. A stripe is only compressed once
+ * at least one more stripe of input follows it, which leaves every leaf at
+ * least one block for blake2bp_final.
+ *
+ * @param      state  blake2bp_state instance
+ * @param[in]  input  the input buffer
+ * @param[in]  inlen  the input length
+ */
+void
+blake2bp_update(blake2bp_state* state, const void* input, size_t inlen)
+{
+  const uint8_t* in = (const uint8_t*)input;
+  size_t fill;
+
+  while (state->buflen + inlen >= 2 * BLAKE2BP_STRIPE) {
+    if (state->buflen == 0) {
+      blake2bp_stripe(state, in);
+      in += BLAKE2BP_STRIPE;
+      inlen -= BLAKE2BP_STRIPE;
+    } else if (state->buflen < BLAKE2BP_STRIPE) {
+      fill = BLAKE2BP_STRIPE - state->buflen;
+      memcpy(state->buf + state->buflen, in, fill);
+      blake2bp_stripe(state, state->buf);
+      state->buflen = 0;
+      in += fill;
+      inlen -= fill;
+    } else {
+      blake2bp_stripe(state, state->buf);
+      state->buflen -= BLAKE2BP_STRIPE;
+      memmove(state->buf, state->buf + BLAKE2BP_STRIPE, state->buflen);
+    }
+  }
+  memcpy(state->buf + state->buflen, in, inlen);
+  state->buflen += inlen;
+}
+
+/**
+ * Finishes the leaves with the buffered input, hashes their digests into the
+ * root and writes the BLAKE2bp digest
+ *
+ * @param      state   blake2bp_state instance
+ * @param[out] out     the output buffer
+ * @param[in]  outlen  the digest size
+ */
+void
+blake2bp_final(blake2bp_state* state, void* out, size_t outlen)
+{
+  uint8_t hashes[BLAKE2BP_LEAVES][BLAKE2B_OUTBYTES];
+  uint8_t key_block[BLAKE2B_BLOCKBYTES] = {0};
+  blake2b_state leaf, root;
+  blake2b_param P;
+  size_t i, j, left;
+
+  memcpy(key_block, state->key, state->keylen);
+
+  /* at most two blocks per leaf are left, they go through the scalar path */
+  for (i = 0; i < BLAKE2BP_LEAVES; ++i) {
+    for (j = 0; j < 8; ++j) {
+      leaf.h[j] = state->leaves.h[j][i];
+    }
+    leaf.t[0] = state->leaves.t[0][i];
+    leaf.t[1] = state->leaves.t[1][i];
+    leaf.f[0] = 0;
+    leaf.f[1] = 0;
+    leaf.buflen = 0;
+    leaf.outlen = BLAKE2B_OUTBYTES;
+    leaf.last_node = i == BLAKE2BP_LEAVES - 1;
+
+    if (state->key_pending) {
+      blake2b_update(&leaf, key_block, BLAKE2B_BLOCKBYTES);
+    }
+    for (j = i * BLAKE2B_BLOCKBYTES; j < state->buflen; j += BLAKE2BP_STRIPE) {
+      left = state->buflen - j;
+      blake2b_update(&leaf, state->buf + j,
+                     left < BLAKE2B_BLOCKBYTES ? left : BLAKE2B_BLOCKBYTES);
+    }
+    blake2b_final(&leaf, hashes[i], BLAKE2B_OUTBYTES);
+  }
+
+  blake2bp_param(&P, state->outlen, state->keylen);
+  P.node_depth = 1;
+  blake2b_init_param(&root, &P);
+  root.last_node = 1;
+  blake2b_update(&root, &hashes[0][0], sizeof(hashes));
+  blake2b_final(&root, out, outlen);
+
+  memset(key_block, 0, sizeof(key_block));
+  memset(state->key, 0, sizeof(state->key));
+}
+
+/**
+ * Computes the BLAKE2bp digest of a message in one call
+ *
+ * @param      output  the hash output
+ * @param[in]  outlen  the hash length
+ * @param[in]  input   the message
+ * @param[in]  inlen   the message length
+ * @param[in]  key     the key, may be NULL if keylen is 0
+ * @param[in]  keylen  the key length
+ */
+void
+blake2bp(void* output, size_t outlen, const void* input, size_t inlen,
+         const void* key, size_t keylen)
+{
+  blake2bp_state state;
+
+  blake2bp_init(&state, outlen, key, keylen);
+  blake2bp_update(&state, input, inlen);
+  blake2bp_final(&state, output, outlen);
+}
@@ -0,0 +1,406 @@
+#include "blake2b.h"
+#include "blake2b_impl.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+  #include <pthread.h>
+  #define BLAKE2B_THREADS
+#endif
+
+/**
+ * BLAKE2Xb: an extendable-output function on top of blake2b. The input is
+ * absorbed once by a root blake2b instance whose parameter block carries the
+ * requested output length in xof_length. Output block i is then the blake2b
+ * digest of the 64-byte root digest under a parameter block with node_offset
+ * i, so every block depends on the root digest and its index alone and costs
+ * a single compression. Runs of whole blocks are therefore computed one per
+ * lane of the multi-lane kernels, and long runs are split over threads.
+ */
+
+#define BLAKE2XB_MAX_OUTPUT (((uint64_t)1 << 32) * BLAKE2B_OUTBYTES)
+
+/**
+ * Minimum number of blocks worth handing to a thread of its own
+ */
+#define BLAKE2XB_THREAD_BLOCKS 256
+
+/**
+ * Fills in the parameter block of one output block
+ *
+ * @param[in]  state  blake2xb_state instance
+ * @param[out] P      the parameter block
+ * @param[in]  i      the index of the block
+ * @param[in]  len    the size of the block, 64 except for the last one
+ */
+static void
+blake2xb_param(const blake2xb_state* state, blake2b_param* P, uint32_t i,
+               size_t len)
+{
+  *P = state->P;
+  P->digest_length = (uint8_t)len;
+  P->key_length = 0;
+  P->fanout = 0;
+  P->depth = 0;
+  P->leaf_length = BLAKE2B_OUTBYTES;
+  P->node_offset = i;
+  P->node_depth = 0;
+  P->inner_length = BLAKE2B_OUTBYTES;
+}
+
+/**
+ * Computes one block of output from the root digest
+ *
+ * @param[in]  state  a blake2xb_state instance whose root digest is computed
+ * @param[in]  i      the index of the block
+ * @param[out] out    the output block
+ * @param[in]  len    the size of the block, 64 except for the last one
+ */
+static void
+blake2xb_block(const blake2xb_state* state, uint32_t i, uint8_t* out,
+               size_t len)
+{
+  blake2b_param P;
+  blake2b_state C;
+
+  blake2xb_param(state, &P, i, len);
+  blake2b_init_param(&C, &P);
+  blake2b_update(&C, state->root, BLAKE2B_OUTBYTES);
+  blake2b_final(&C, out, len);
+}
+
+/**
+ * Computes the full 64-byte blocks first .. last-1 of the output, one block
+ * per lane. Every lane compresses the same padded root digest and only the
+ * node offset in its chained state differs.
+ *
+ * @param[in]  state  a blake2xb_state instance whose root digest is computed
+ * @param[in]  first  the index of the first block
+ * @param[in]  last   one past the index of the last block
+ * @param[out] out    the output, (last - first) * 64 bytes
+ */
+static void
+blake2xb_blocks(const blake2xb_state* state, uint64_t first, uint64_t last,
+                uint8_t* out)
+{
+  uint8_t block[BLAKE2B_BLOCKBYTES] = {0};
+  const uint8_t* blocks[BLAKE2B_MAX_LANES];
+  blake2b_lanes lanes;
+  blake2b_param P;
+  size_t i, n;
+
+  memcpy(block, state->root, BLAKE2B_OUTBYTES);
+  for (i = 0; i < BLAKE2B_MAX_LANES; ++i) {
+    blocks[i] = block;
+  }
+  blake2xb_param(state, &P, 0, BLAKE2B_OUTBYTES);
+
+  while (first < last) {
+    n = last - first < BLAKE2B_MAX_LANES ? (size_t)(last - first) :
+        BLAKE2B_MAX_LANES;
+    for (i = 0; i < n; ++i) {
+      P.node_offset = (uint32_t)(first + i);
+      blake2b_lanes_init(&lanes, i, &P);
+      lanes.t[0][i] = BLAKE2B_OUTBYTES;
+      lanes.f[0][i] = UINT64_MAX;
+    }
+    blake2b_compress_lanes(&lanes, blocks, n);
+    for (i = 0; i < n; ++i) {
+      blake2b_lanes_store(&lanes, i, out, BLAKE2B_OUTBYTES);
+      out += BLAKE2B_OUTBYTES;
+    }
+    first += n;
+  }
+}
+
+#if defined(BLAKE2B_THREADS)
+/**
+ * One thread's share of a run of blocks
+ */
+typedef struct blake2xb_work
+{
+  const blake2xb_state* state;
+  uint64_t first;                /* first block */
+  uint64_t last;                 /* one past the last block */
+  uint8_t* out;                  /* where block first goes */
+} blake2xb_work;
+
+/**
+ * Thread body: computes one share of blocks
+ *
+ * @param      arg   the blake2xb_work of the thread
+ */
+static void*
+blake2xb_worker(void* arg)
+{
+  blake2xb_work* W = (blake2xb_work*)arg;
+
+  blake2xb_blocks(W->state, W->first, W->last, W->out);
+  return NULL;
+}
+#endif
+
+/**
+ * Computes the full 64-byte blocks first .. last-1 of the output, split in
+ * contiguous shares over up to threads threads
+ *
+ * @param[in]  state    a blake2xb_state instance whose root digest is
+ *                      computed
+ * @param[in]  first    the index of the first block
+ * @param[in]  last     one past the index of the last block
+ * @param[out] out      the output, (last - first) * 64 bytes
+ * @param[in]  threads  the number of threads to use, 0 or 1 for none
+ */
+static void
+blake2xb_run(const blake2xb_state* state, uint64_t first, uint64_t last,
+             uint8_t* out, size_t threads)
+{
+#if defined(BLAKE2B_THREADS)
+  blake2xb_work* W = NULL;
+  pthread_t* tids = NULL;
+  uint64_t share;
+  size_t i, started = 0;
+
+  if (threads > (last - first) / BLAKE2XB_THREAD_BLOCKS) {
+    threads = (size_t)((last - first) / BLAKE2XB_THREAD_BLOCKS);
+  }
+  if (threads > 1) {
+    W = (blake2xb_work*)malloc((threads - 1) * sizeof(*W));
+    tids = (pthread_t*)malloc((threads - 1) * sizeof(*tids));
+  }
+  if (W != NULL && tids != NULL) {
+    /* whole kernel calls per share, the calling thread takes the rest */
+    share = (last - first) / threads / BLAKE2B_MAX_LANES * BLAKE2B_MAX_LANES;
+    for (; started + 1 < threads; ++started) {
+      W[started].state = state;
+      W[started].first = first;
+      W[started].last = first + share;
+      W[started].out = out;
+      if (pthread_create(&tids[started], NULL, blake2xb_worker,
+                         &W[started]) != 0) {
+        break;
+      }
+      first += share;
+      out += share * BLAKE2B_OUTBYTES;
+    }
+  }
+  blake2xb_blocks(state, first, last, out);
+  for (i = 0; i < started; ++i) {
+    pthread_join(tids[i], NULL);
+  }
+  free(W);
+  free(tids);
+#else
+  (void)threads;
+  blake2xb_blocks(state, first, last, out);
+#endif
+}
+
+/**
+ * Initializes a BLAKE2Xb state
+ *
+ * @param      state   blake2xb_state instance passed by reference
+ * @param[in]  outlen  the output length, 1 to 2^32 - 2 bytes, or
+ *                     BLAKE2XB_LENGTH_UNKNOWN to leave it open
+ * @param[in]  key     the key, may be NULL if keylen is 0
+ * @param[in]  keylen  the key length
+ *
+ * @return     0 on success, -1 if outlen or keylen is out of range
+ */
+int
+blake2xb_init(blake2xb_state* state, size_t outlen, const void* key,
+              size_t keylen)
+{
+  if (outlen == 0 || (uint64_t)outlen > BLAKE2XB_LENGTH_UNKNOWN ||
+      keylen > BLAKE2B_KEYBYTES) {
+    return -1;
+  }
+
+  memset(&state->P, 0, sizeof(state->P));
+  state->P.digest_length = BLAKE2B_OUTBYTES;
+  state->P.key_length = (uint8_t)keylen;
+  state->P.fanout = 1;
+  state->P.depth = 1;
+  state->P.xof_length = (uint32_t)outlen;
+  blake2b_init_param_key(&state->S, &state->P, key);
+  state->finalized = 0;
+  state->pos = 0;
+  return 0;
+}
+
+/**
+ * Updates a BLAKE2Xb state. Must not be called once it is finalized.
+ *
+ * @param      state  blake2xb_state instance
+ * @param[in]  in     the input
+ * @param[in]  inlen  the input length
+ */
+void
+blake2xb_update(blake2xb_state* state, const void* in, size_t inlen)
+{
+  blake2b_update(&state->S, (const uint8_t*)in, inlen);
+}
+
+/**
+ * Computes the root digest unless that is already done. From then on the
+ * input is closed and blake2xb_read only reads the state, so it may be
+ * shared by any number of threads.
+ *
+ * @param      state  blake2xb_state instance
+ */
+void
+blake2xb_finalize(blake2xb_state* state)
+{
+  if (!state->finalized) {
+    blake2b_final(&state->S, state->root, BLAKE2B_OUTBYTES);
+    state->finalized = 1;
+  }
+}
+
+/**
+ * Finalizes the root hash and expands it into the whole output at once, as
+ * upstream BLAKE2Xb does
+ *
+ * @param      state   blake2xb_state instance
+ * @param[out] out     the output buffer
+ * @param[in]  outlen  the output length, which must be the one passed to
+ *                     blake2xb_init unless that was BLAKE2XB_LENGTH_UNKNOWN
+ *
+ * @return     0 on success, -1 if outlen does not match
+ */
+int
+blake2xb_final(blake2xb_state* state, void* out, size_t outlen)
+{
+  size_t full = outlen / BLAKE2B_OUTBYTES;
+
+  if (state->P.xof_length == BLAKE2XB_LENGTH_UNKNOWN) {
+    if (outlen == 0 || (uint64_t)outlen > BLAKE2XB_MAX_OUTPUT) {
+      return -1;
+    }
+  } else if ((uint64_t)outlen != state->P.xof_length) {
+    return -1;
+  }
+
+  blake2xb_finalize(state);
+  blake2xb_run(state, 0, full, (uint8_t*)out, 1);
+  if (outlen % BLAKE2B_OUTBYTES != 0) {
+    blake2xb_block(state, (uint32_t)full,
+                   (uint8_t*)out + full * BLAKE2B_OUTBYTES,
+                   outlen % BLAKE2B_OUTBYTES);
+  }
+  return 0;
+}
+
+/**
+ * Produces any part of the output stream without the bytes before it. The
+ * state must have been through blake2xb_finalize and is only read, so any
+ * number of threads may call this on the same state at once. With a known
+ * length the stream is exactly what blake2xb_final returns. With
+ * BLAKE2XB_LENGTH_UNKNOWN every block is a full 64-byte one, so the stream
+ * matches blake2xb_final only up to the last multiple of 64 bytes.
+ *
+ * @param[in]  state    a finalized blake2xb_state instance
+ * @param[in]  offset   the offset of the first byte to produce
+ * @param[out] out      the output buffer
+ * @param[in]  outlen   the number of bytes to produce
+ * @param[in]  threads  the number of threads to use, 0 or 1 for none
+ *
+ * @return     0 on success, -1 if the state is not finalized or that would
+ *             go past the end of the output
+ */
+int
+blake2xb_read(const blake2xb_state* state, uint64_t offset, void* out,
+              size_t outlen, size_t threads)
+{
+  uint64_t end = state->P.xof_length == BLAKE2XB_LENGTH_UNKNOWN ?
+                 BLAKE2XB_MAX_OUTPUT : state->P.xof_length;
+  uint8_t block[BLAKE2B_OUTBYTES];
+  uint8_t* p = (uint8_t*)out;
+  uint64_t i = offset / BLAKE2B_OUTBYTES;
+  size_t off = (size_t)(offset % BLAKE2B_OUTBYTES);
+  size_t len, full;
+
+  if (!state->finalized || offset > end || (uint64_t)outlen > end - offset) {
+    return -1;
+  }
+
+  /* the block offset falls in, unless offset is at its start */
+  if (off != 0 && outlen > 0) {
+    len = end - i * BLAKE2B_OUTBYTES < BLAKE2B_OUTBYTES ?
+          (size_t)(end - i * BLAKE2B_OUTBYTES) : BLAKE2B_OUTBYTES;
+    blake2xb_block(state, (uint32_t)i, block, len);
+    len -= off;
+    if (len > outlen) {
+      len = outlen;
+    }
+    memcpy(p, block + off, len);
+    p += len;
+    outlen -= len;
+    ++i;
+  }
+
+  /* whole blocks, which all have the full length */
+  full = outlen / BLAKE2B_OUTBYTES;
+  blake2xb_run(state, i, i + full, p, threads);
+  p += full * BLAKE2B_OUTBYTES;
+  outlen -= full * BLAKE2B_OUTBYTES;
+  i += full;
+
+  /* the start of one more block, or all of a short last one */
+  if (outlen > 0) {
+    len = end - i * BLAKE2B_OUTBYTES < BLAKE2B_OUTBYTES ?
+          (size_t)(end - i * BLAKE2B_OUTBYTES) : BLAKE2B_OUTBYTES;
+    blake2xb_block(state, (uint32_t)i, block, len);
+    memcpy(p, block, outlen);
+  }
+  return 0;
+}
+
+/**
+ * Produces the next outlen bytes of output. Any number of calls may follow
+ * each other, and their outputs put together are bytes 0, 1, ... of the
+ * stream of blake2xb_read however the stream is cut.
+ *
+ * @param      state   blake2xb_state instance
+ * @param[out] out     the output buffer
+ * @param[in]  outlen  the number of bytes to produce
+ *
+ * @return     0 on success, -1 if that would go past the end of the output
+ */
+int
+blake2xb_squeeze(blake2xb_state* state, void* out, size_t outlen)
+{
+  blake2xb_finalize(state);
+  if (blake2xb_read(state, state->pos, out, outlen, 1) != 0) {
+    return -1;
+  }
+  state->pos += outlen;
+  return 0;
+}
+
+/**
+ * The one-shot BLAKE2Xb function
+ *
+ * @param[out] out     the output
+ * @param[in]  outlen  the output length, 1 to 2^32 - 2 bytes
+ * @param[in]  in      the message input
+ * @param[in]  inlen   the message length
+ * @param[in]  key     the key
+ * @param[in]  keylen  the key length
+ *
+ * @return     0 on success, -1 if outlen or keylen is out of range
+ */
+int
+blake2xb(void* out, size_t outlen, const void* in, size_t inlen,
+         const void* key, size_t keylen)
+{
+  blake2xb_state state;
+
+  if ((uint64_t)outlen == BLAKE2XB_LENGTH_UNKNOWN ||
+      blake2xb_init(&state, outlen, key, keylen) != 0) {
+    return -1;
+  }
+  blake2xb_update(&state, in, inlen);
+  return blake2xb_final(&state, out, outlen);
+}
@@ -1,8 +1,16 @@
 #include "blake2b.h"
+#include "blake2b_impl.h"
 #include "blake2b_kat.h"
+#include "blake2bp_kat.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#if !defined(_WIN32)
+  #include <sys/wait.h>
+  #include <unistd.h>
+#endif
+
 void
 print_hex(const uint8_t* hash, char* string, int len)
 {
@@ -16,28 +24,20 @@ print_hex(const uint8_t* hash, char* string, int len)
   printf("\n\n");
 }
 
+/**
+ * Checks the compress function currently selected against the test vectors
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every test vector matches, -1 otherwise
+ */
 int
-main(int argc, char const* argv[])
+test_kat(const uint8_t* key, const uint8_t* buf)
 {
-
-  uint8_t key[BLAKE2B_KEYBYTES];
-  uint8_t buf[BLAKE2_KAT_LENGTH];
   uint8_t hash[BLAKE2B_OUTBYTES];
   size_t i;
 
-  /* Key of the form (i, i+1 ... i+63 where i=0) */
-  for (i = 0; i < BLAKE2B_KEYBYTES; ++i) {
-    key[i] = (uint8_t)i;
-  }
-
-  for (i = 0; i < BLAKE2_KAT_LENGTH; ++i) {
-    buf[i] = (uint8_t)0;
-  }
-  /* Buffer of the form (i, i+1 ... i+255 where i=0) */
-  for (i = 0; i < BLAKE2_KAT_LENGTH; ++i) {
-    buf[i] = (uint8_t)i;
-  }
-
   /* Testing for unkeyed hashes against the test vectors */
   for (i = 0; i < BLAKE2_KAT_LENGTH; ++i) {
     blake2b(hash, BLAKE2B_OUTBYTES, buf, i, key, 0);
@@ -64,6 +64,1087 @@ main(int argc, char const* argv[])
       return -1;
     }
   }
+  return 0;
+}
+
+/**
+ * Checks hashing under a full parameter block against reference digests:
+ * a salt and personalization string through both the one-shot and the
+ * streaming API, and tree parameters through blake2b_param_hash
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every digest matches, -1 otherwise
+ */
+int
+test_param(const uint8_t* key, const uint8_t* buf)
+{
+  /* keyed, 256-byte input */
+  static const uint8_t salted[BLAKE2B_OUTBYTES] = {
+    0x7D, 0x4F, 0x13, 0x98, 0x0A, 0x96, 0x5E, 0x50,
+    0xB5, 0xD9, 0xC0, 0xC9, 0x6F, 0xDB, 0x65, 0xF3,
+    0xA0, 0xA9, 0x19, 0xD2, 0xF0, 0x17, 0x0A, 0x18,
+    0xE0, 0x32, 0x2D, 0xD8, 0xF6, 0xDB, 0x13, 0xE1,
+    0x60, 0x49, 0x5E, 0x25, 0x33, 0x4E, 0xC9, 0x66,
+    0x4E, 0x6D, 0xD3, 0xF7, 0x90, 0x9B, 0x3B, 0xB7,
+    0xEB, 0x57, 0x14, 0xEA, 0x3E, 0x2E, 0xE7, 0x5D,
+    0x6C, 0x48, 0x74, 0x4B, 0x22, 0xDA, 0xF1, 0x3B
+  };
+  /* node 5 of level 1 of a tree, keyed and salted, 100-byte input */
+  static const uint8_t node[32] = {
+    0xA1, 0x9B, 0x99, 0x85, 0x98, 0x7E, 0xCC, 0xC3,
+    0xC6, 0xAE, 0x34, 0x88, 0xC1, 0xB0, 0xE5, 0x7D,
+    0x6A, 0x38, 0x26, 0x3F, 0x62, 0x5E, 0xC1, 0xEA,
+    0xCE, 0x39, 0x7A, 0xCE, 0x27, 0xB7, 0xF6, 0xF3
+  };
+  static const uint8_t personal[BLAKE2B_PERSONALBYTES] = "protocol-v2-tag!";
+  uint8_t salt[BLAKE2B_SALTBYTES];
+  uint8_t hash[BLAKE2B_OUTBYTES];
+  blake2b_state state;
+  blake2b_param P;
+  size_t i;
+
+  for (i = 0; i < BLAKE2B_SALTBYTES; ++i) {
+    salt[i] = (uint8_t)(0x80 + i);
+  }
+  blake2b_salt_personal(hash, BLAKE2B_OUTBYTES, buf, BLAKE2_KAT_LENGTH, key,
+                        BLAKE2B_KEYBYTES, salt, personal);
+  if (memcmp(hash, salted, BLAKE2B_OUTBYTES)) {
+    printf("salted and personalized blake2b failed\n");
+    return -1;
+  }
+  blake2b_init_salt_personal(&state, BLAKE2B_OUTBYTES, key, BLAKE2B_KEYBYTES,
+                             salt, personal);
+  for (i = 0; i < BLAKE2_KAT_LENGTH; i += 100) {
+    blake2b_update(&state, buf + i,
+                   BLAKE2_KAT_LENGTH - i < 100 ? BLAKE2_KAT_LENGTH - i : 100);
+  }
+  blake2b_final(&state, hash, BLAKE2B_OUTBYTES);
+  if (memcmp(hash, salted, BLAKE2B_OUTBYTES)) {
+    printf("streaming salted and personalized blake2b failed\n");
+    return -1;
+  }
+
+  memset(&P, 0, sizeof(P));
+  P.digest_length = 32;
+  P.key_length = BLAKE2B_KEYBYTES;
+  P.fanout = 4;
+  P.depth = 3;
+  P.leaf_length = 4096;
+  P.node_offset = 5;
+  P.node_depth = 1;
+  P.inner_length = 32;
+  memcpy(P.salt, salt, BLAKE2B_SALTBYTES);
+  memcpy(P.personal, personal, BLAKE2B_PERSONALBYTES);
+  blake2b_param_hash(hash, buf, 100, key, &P);
+  if (memcmp(hash, node, 32)) {
+    printf("blake2b with tree parameters failed\n");
+    return -1;
+  }
+  return 0;
+}
+
+/**
+ * Checks that long updates, which compress all but the last block in one
+ * multi-block call, hash the same as byte by byte updates, which compress
+ * every block on its own, also when the counter carries into t[1]
+ *
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if both digests match every time, -1 otherwise
+ */
+int
+test_update(const uint8_t* buf)
+{
+  uint8_t msg[1024], hash[BLAKE2B_OUTBYTES], ref[BLAKE2B_OUTBYTES];
+  blake2b_state bulk, bytes;
+  size_t i, j, k;
+
+  for (i = 0; i < sizeof(msg); ++i) {
+    msg[i] = buf[(i * 3) % BLAKE2_KAT_LENGTH];
+  }
+  for (k = 0; k < 2; ++k) {
+    for (i = 5; i <= sizeof(msg); i += 37) {
+      blake2b_init(&bulk, BLAKE2B_OUTBYTES, NULL, 0);
+      if (k == 1) {
+        bulk.t[0] = (uint64_t)0 - 3 * BLAKE2B_BLOCKBYTES - 5;
+      }
+      bytes = bulk;
+      blake2b_update(&bulk, msg, 5);
+      blake2b_update(&bulk, msg + 5, i - 5);
+      for (j = 0; j < i; ++j) {
+        blake2b_update(&bytes, msg + j, 1);
+      }
+      blake2b_final(&bulk, hash, BLAKE2B_OUTBYTES);
+      blake2b_final(&bytes, ref, BLAKE2B_OUTBYTES);
+      if (memcmp(hash, ref, BLAKE2B_OUTBYTES) || bulk.t[1] != bytes.t[1]) {
+        printf("multi-block blake2b_update failed, length %d\n", (int)i);
+        return -1;
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks the single-block path of blake2b() against init, update and final
+ * for every digest length and every message length up to one block, and
+ * that it writes nothing past the digest
+ *
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every digest matches, -1 otherwise
+ */
+int
+test_short(const uint8_t* buf)
+{
+  uint8_t hash[BLAKE2B_OUTBYTES], ref[BLAKE2B_OUTBYTES];
+  blake2b_state state;
+  size_t i, outlen;
+
+  for (outlen = 1; outlen <= BLAKE2B_OUTBYTES; ++outlen) {
+    for (i = 0; i <= BLAKE2B_BLOCKBYTES; ++i) {
+      blake2b_init(&state, outlen, NULL, 0);
+      blake2b_update(&state, buf, i);
+      blake2b_final(&state, ref, outlen);
+      memset(hash, 0, sizeof(hash));
+      blake2b(hash, outlen, buf, i, NULL, 0);
+      if (memcmp(hash, ref, outlen) ||
+          (outlen < BLAKE2B_OUTBYTES && hash[outlen] != 0)) {
+        printf("short blake2b failed, digest %d, message %d\n", (int)outlen,
+               (int)i);
+        return -1;
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks keyed hashing through a blake2b_mac_ctx against blake2b for every
+ * key length and message lengths around the block boundaries, one-shot and
+ * streamed, including the empty message
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every digest matches, -1 otherwise
+ */
+int
+test_mac(const uint8_t* key, const uint8_t* buf)
+{
+  uint8_t hash[BLAKE2B_OUTBYTES], ref[BLAKE2B_OUTBYTES];
+  blake2b_mac_ctx ctx;
+  blake2b_state state;
+  size_t i, j, k, outlen;
+
+  for (k = 0; k <= BLAKE2B_KEYBYTES; k += 8) {
+    outlen = k == 0 ? BLAKE2B_OUTBYTES : k;
+    blake2b_mac_init(&ctx, outlen, key, k);
+    for (i = 0; i < BLAKE2_KAT_LENGTH; i += i < 130 ? 1 : 31) {
+      blake2b(ref, outlen, buf, i, key, k);
+      blake2b_mac(&ctx, hash, buf, i);
+      if (memcmp(hash, ref, outlen)) {
+        printf("blake2b_mac failed, key %d, message %d\n", (int)k, (int)i);
+        return -1;
+      }
+      blake2b_mac_start(&ctx, &state);
+      for (j = 0; j < i; j += 5) {
+        blake2b_update(&state, buf + j, i - j < 5 ? i - j : 5);
+      }
+      blake2b_mac_final(&ctx, &state, hash);
+      if (memcmp(hash, ref, outlen)) {
+        printf("streaming blake2b_mac failed, key %d, message %d\n", (int)k,
+               (int)i);
+        return -1;
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks the prefix cache against blake2b() for messages that are the
+ * prefix, start with all or part of it, or leave it mid-block, and checks
+ * that a cloned state hashes on independently of the original
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every digest matches, -1 otherwise
+ */
+int
+test_prefix(const uint8_t* key, const uint8_t* buf)
+{
+  static const size_t prefixlens[] = { 0, 1, 128, 255, 256, 700 };
+  uint8_t msg[1024], alt[1024];
+  uint8_t hash[BLAKE2B_OUTBYTES], ref[BLAKE2B_OUTBYTES];
+  blake2b_prefix cache;
+  blake2b_state state, fork;
+  size_t i, j, k, p, n, done;
+
+  for (i = 0; i < sizeof(msg); ++i) {
+    msg[i] = buf[(i * 7) % BLAKE2_KAT_LENGTH];
+  }
+  for (k = 0; k <= BLAKE2B_KEYBYTES; k += 64) {
+    for (p = 0; p < sizeof(prefixlens) / sizeof(prefixlens[0]); ++p) {
+      n = prefixlens[p];
+      if (blake2b_prefix_init(&cache, BLAKE2B_OUTBYTES, key, k, msg, n)) {
+        printf("blake2b_prefix_init failed\n");
+        return -1;
+      }
+      for (i = 0; i <= n + 300; ++i) {
+        blake2b(ref, BLAKE2B_OUTBYTES, msg, i, key, k);
+        blake2b_prefix_hash(&cache, hash, msg, i);
+        if (memcmp(hash, ref, BLAKE2B_OUTBYTES)) {
+          printf("blake2b_prefix_hash failed, prefix %d, message %d\n",
+                 (int)n, (int)i);
+          return -1;
+        }
+        done = blake2b_prefix_start(&cache, &state, msg, i);
+        for (j = done; j < i; j += 50) {
+          blake2b_update(&state, msg + j, i - j < 50 ? i - j : 50);
+        }
+        blake2b_mac_final(&cache.mac, &state, hash);
+        if (memcmp(hash, ref, BLAKE2B_OUTBYTES)) {
+          printf("streaming blake2b_prefix failed, prefix %d, message %d\n",
+                 (int)n, (int)i);
+          return -1;
+        }
+        if (i >= n) {
+          blake2b_prefix_tail(&cache, hash, msg + n, i - n);
+          if (memcmp(hash, ref, BLAKE2B_OUTBYTES)) {
+            printf("blake2b_prefix_tail failed, prefix %d, message %d\n",
+                   (int)n, (int)i);
+            return -1;
+          }
+        }
+      }
+
+      /* a message that leaves the prefix mid-block */
+      if (n > 200) {
+        memcpy(alt, msg, sizeof(alt));
+        alt[150] ^= 1;
+        blake2b(ref, BLAKE2B_OUTBYTES, alt, n + 10, key, k);
+        blake2b_prefix_hash(&cache, hash, alt, n + 10);
+        if (memcmp(hash, ref, BLAKE2B_OUTBYTES)) {
+          printf("diverging blake2b_prefix failed, prefix %d\n", (int)n);
+          return -1;
+        }
+      }
+      blake2b_prefix_free(&cache);
+    }
+
+    /* fork one stream into two messages */
+    blake2b_init(&state, BLAKE2B_OUTBYTES, key, k);
+    blake2b_update(&state, msg, 300);
+    blake2b_clone(&fork, &state);
+    blake2b_update(&state, msg + 300, 100);
+    blake2b_update(&fork, buf, 50);
+    blake2b_final(&state, hash, BLAKE2B_OUTBYTES);
+    blake2b(ref, BLAKE2B_OUTBYTES, msg, 400, key, k);
+    if (memcmp(hash, ref, BLAKE2B_OUTBYTES)) {
+      printf("blake2b_clone failed, original\n");
+      return -1;
+    }
+    memcpy(msg + 300, buf, 50);
+    blake2b_final(&fork, hash, BLAKE2B_OUTBYTES);
+    blake2b(ref, BLAKE2B_OUTBYTES, msg, 350, key, k);
+    if (memcmp(hash, ref, BLAKE2B_OUTBYTES)) {
+      printf("blake2b_clone failed, clone\n");
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks the Merkle node functions against blake2b() over the concatenated
+ * children, one, four and eight pairs at a time, also when each parent
+ * overwrites its left child
+ *
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every digest matches, -1 otherwise
+ */
+int
+test_node(const uint8_t* buf)
+{
+  static const size_t counts[] = { 1, 4, 8 };
+  uint8_t nodes[8][32], ref[8][32];
+  void* out[8];
+  const void* left[8];
+  const void* right[8];
+  size_t i, j, n;
+
+  for (j = 0; j < sizeof(counts) / sizeof(counts[0]); ++j) {
+    n = counts[j];
+    for (i = 0; i < n; ++i) {
+      blake2b(ref[i], 32, buf + 16 * i, 64, NULL, 0);
+      memcpy(nodes[i], buf + 16 * i, 32);
+      out[i] = nodes[i];
+      left[i] = nodes[i];
+      right[i] = buf + 16 * i + 32;
+    }
+    if (n == 1) {
+      blake2b_256_node(out[0], left[0], right[0]);
+    } else if (n == 4) {
+      blake2b_256_node_x4(out, left, right);
+    } else {
+      blake2b_256_node_x8(out, left, right);
+    }
+    for (i = 0; i < n; ++i) {
+      if (memcmp(nodes[i], ref[i], 32)) {
+        printf("blake2b_256_node failed, %d pairs, pair %d\n", (int)n,
+               (int)i);
+        return -1;
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks the Merkle tree builder against a level by level build with
+ * blake2b(), from leaf digests and from leaf data, for leaf counts within one
+ * subtree and across several and for several thread counts
+ *
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every node matches, -1 otherwise
+ */
+int
+test_merkle(const uint8_t* buf)
+{
+  static const size_t counts[] = { 1, 2, 3, 7, 2048, 2051, 5000 };
+  static const size_t threads[] = { 1, 3 };
+  const size_t leaflen = 40;
+  blake2b_merkle tree;
+  uint8_t *data, *ref, *p, *q;
+  uint8_t root[32];
+  size_t c, t, i, k, n, m, mode;
+  int ret = 0;
+
+  n = counts[sizeof(counts) / sizeof(counts[0]) - 1];
+  data = (uint8_t*)malloc(n * leaflen);
+  ref = (uint8_t*)malloc((2 * n + BLAKE2B_MERKLE_MAX_LEVELS) * 32);
+  if (data == NULL || ref == NULL) {
+    free(data);
+    free(ref);
+    return -1;
+  }
+  for (i = 0; i < n * leaflen; ++i) {
+    data[i] = (uint8_t)(buf[i % BLAKE2_KAT_LENGTH] ^ (i >> 8));
+  }
+
+  for (c = 0; c < sizeof(counts) / sizeof(counts[0]) && ret == 0; ++c) {
+    n = counts[c];
+    /* the reference levels, one after another */
+    for (i = 0; i < n; ++i) {
+      blake2b(ref + i * 32, 32, data + i * leaflen, leaflen, NULL, 0);
+    }
+    for (p = ref, m = n; m > 1; p = q, m = (m + 1) / 2) {
+      q = p + m * 32;
+      for (i = 0; i + 1 < m; i += 2) {
+        blake2b(q + i / 2 * 32, 32, p + i * 32, 64, NULL, 0);
+      }
+      if (m & 1) {
+        memcpy(q + i / 2 * 32, p + i * 32, 32);
+      }
+    }
+
+    for (t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t) {
+      for (mode = 0; mode < 2; ++mode) {
+        if (mode == 0 ? blake2b_merkle_build(&tree, ref, n, threads[t])
+                      : blake2b_merkle_build_data(&tree, data, leaflen, n,
+                                                  threads[t])) {
+          printf("blake2b_merkle_build failed, %d leaves\n", (int)n);
+          ret = -1;
+          break;
+        }
+        for (p = ref, k = 0, m = n; k < tree.levels; ++k) {
+          if (tree.count[k] != m || memcmp(tree.level[k], p, m * 32)) {
+            break;
+          }
+          p += m * 32;
+          m = (m + 1) / 2;
+        }
+        blake2b_merkle_root(&tree, root);
+        if (k != tree.levels || m != 1 || memcmp(root, p - 32, 32)) {
+          printf("blake2b_merkle failed, %d leaves, %d threads, level %d\n",
+                 (int)n, (int)threads[t], (int)k);
+          ret = -1;
+        }
+        blake2b_merkle_free(&tree);
+      }
+    }
+  }
+  free(data);
+  free(ref);
+  return ret;
+}
+
+/**
+ * Checks blake2b_x4 and blake2b_x8 against the test vectors in lane 0 and
+ * against blake2b() for other messages of the same length in the other lanes
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every lane matches, -1 otherwise
+ */
+int
+test_lanes(const uint8_t* key, const uint8_t* buf)
+{
+  uint8_t msgs[8][BLAKE2_KAT_LENGTH];
+  uint8_t hashes[8][BLAKE2B_OUTBYTES];
+  uint8_t expected[BLAKE2B_OUTBYTES];
+  const void* in[8];
+  void* out[8];
+  size_t i, j, n, keylen;
+
+  for (j = 0; j < 8; ++j) {
+    for (i = 0; i < BLAKE2_KAT_LENGTH; ++i) {
+      msgs[j][i] = (uint8_t)(buf[i] * (j + 1));
+    }
+    in[j] = msgs[j];
+    out[j] = hashes[j];
+  }
+
+  for (n = 4; n <= 8; n += 4) {
+    for (keylen = 0; keylen <= BLAKE2B_KEYBYTES; keylen += BLAKE2B_KEYBYTES) {
+      for (i = 0; i < BLAKE2_KAT_LENGTH; ++i) {
+        if (n == 4) {
+          blake2b_x4(out, BLAKE2B_OUTBYTES, in, i, key, keylen);
+        } else {
+          blake2b_x8(out, BLAKE2B_OUTBYTES, in, i, key, keylen);
+        }
+        if (memcmp(hashes[0], keylen ? blake2b_keyed_kat[i] : blake2b_kat[i],
+                   BLAKE2B_OUTBYTES)) {
+          printf("x%d lane 0 failed at %d\n", (int)n, (int)i);
+          return -1;
+        }
+        for (j = 1; j < n; ++j) {
+          blake2b(expected, BLAKE2B_OUTBYTES, in[j], i, key, keylen);
+          if (memcmp(hashes[j], expected, BLAKE2B_OUTBYTES)) {
+            printf("x%d lane %d failed at %d\n", (int)n, (int)j, (int)i);
+            return -1;
+          }
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks blake2b_batch on all test vectors at once, in a scrambled order, and
+ * against blake2b() for a batch mixing key and digest sizes
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every digest matches, -1 otherwise
+ */
+int
+test_batch(const uint8_t* key, const uint8_t* buf)
+{
+  static uint8_t hashes[2 * BLAKE2_KAT_LENGTH][BLAKE2B_OUTBYTES];
+  blake2b_desc descs[2 * BLAKE2_KAT_LENGTH];
+  uint8_t expected[BLAKE2B_OUTBYTES];
+  size_t i, k, n = 2 * BLAKE2_KAT_LENGTH;
+
+  for (i = 0; i < n; ++i) {
+    /* 37 is odd, so k walks over every test vector once */
+    k = (i * 37) % n;
+    descs[i].in = buf;
+    descs[i].inlen = k % BLAKE2_KAT_LENGTH;
+    descs[i].key = k < BLAKE2_KAT_LENGTH ? NULL : key;
+    descs[i].keylen = k < BLAKE2_KAT_LENGTH ? 0 : BLAKE2B_KEYBYTES;
+    descs[i].out = hashes[k];
+    descs[i].outlen = BLAKE2B_OUTBYTES;
+  }
+  blake2b_batch(descs, n);
+  for (i = 0; i < BLAKE2_KAT_LENGTH; ++i) {
+    if (memcmp(hashes[i], blake2b_kat[i], BLAKE2B_OUTBYTES) ||
+        memcmp(hashes[i + BLAKE2_KAT_LENGTH], blake2b_keyed_kat[i],
+               BLAKE2B_OUTBYTES)) {
+      printf("batch failed at %d\n", (int)i);
+      return -1;
+    }
+  }
+
+  for (i = 0; i < n; ++i) {
+    descs[i].in = buf;
+    descs[i].inlen = (i * 7) % BLAKE2_KAT_LENGTH;
+    descs[i].key = key;
+    descs[i].keylen = i % (BLAKE2B_KEYBYTES + 1);
+    descs[i].out = hashes[i];
+    descs[i].outlen = 1 + i % BLAKE2B_OUTBYTES;
+  }
+  blake2b_batch(descs, n);
+  for (i = 0; i < n; ++i) {
+    blake2b(expected, descs[i].outlen, descs[i].in, descs[i].inlen,
+            descs[i].key, descs[i].keylen);
+    if (memcmp(hashes[i], expected, descs[i].outlen)) {
+      printf("batch failed at %d\n", (int)i);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks the job manager: submits jobs of many lengths, some keyed, and
+ * checks that each one comes back exactly once from submit or flush with the
+ * same digest as blake2b()
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every job matches, -1 otherwise
+ */
+int
+test_mgr(const uint8_t* key, const uint8_t* buf)
+{
+  static uint8_t hashes[2 * BLAKE2_KAT_LENGTH][BLAKE2B_OUTBYTES];
+  static blake2b_job jobs[2 * BLAKE2_KAT_LENGTH];
+  int returned[2 * BLAKE2_KAT_LENGTH] = {0};
+  uint8_t expected[BLAKE2B_OUTBYTES];
+  blake2b_mgr mgr;
+  blake2b_job* job;
+  size_t i, k, n = 2 * BLAKE2_KAT_LENGTH;
+
+  blake2b_mgr_init(&mgr);
+  for (i = 0; i < n; ++i) {
+    /* lengths jump around so the lanes finish at different times */
+    jobs[i].in = buf;
+    jobs[i].inlen = (i * 101) % BLAKE2_KAT_LENGTH;
+    jobs[i].key = i % 3 == 0 ? key : NULL;
+    jobs[i].keylen = i % 3 == 0 ? BLAKE2B_KEYBYTES : 0;
+    jobs[i].out = hashes[i];
+    jobs[i].outlen = 1 + i % BLAKE2B_OUTBYTES;
+  }
+
+  for (i = 0; i < 2 * n; ++i) {
+    job = i < n ? blake2b_mgr_submit(&mgr, &jobs[i]) : blake2b_mgr_flush(&mgr);
+    if (job == NULL) {
+      continue;
+    }
+    k = (size_t)(job - jobs);
+    if (returned[k]++) {
+      printf("mgr returned job %d twice\n", (int)k);
+      return -1;
+    }
+    blake2b(expected, job->outlen, job->in, job->inlen, job->key, job->keylen);
+    if (memcmp(hashes[k], expected, job->outlen)) {
+      printf("mgr failed at %d\n", (int)k);
+      return -1;
+    }
+  }
+  for (k = 0; k < n; ++k) {
+    if (!returned[k]) {
+      printf("mgr lost job %d\n", (int)k);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks BLAKE2bp against the test vectors, and on a 4099-byte message that
+ * spans several stripes, fed in one call and in chunks of various sizes
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every digest matches, -1 otherwise
+ */
+int
+test_bp(const uint8_t* key, const uint8_t* buf)
+{
+  static const uint8_t long_kat[2][BLAKE2B_OUTBYTES] = {
+    {
+      0xDC, 0xE6, 0xE5, 0xC4, 0x6D, 0x31, 0x8A, 0xED,
+      0x49, 0x6F, 0x96, 0xB8, 0xF7, 0xC0, 0x3D, 0x3A,
+      0x3C, 0x23, 0x90, 0x77, 0xB8, 0x57, 0x44, 0xE7,
+      0x2B, 0xF0, 0xB7, 0xEC, 0x88, 0xCB, 0x40, 0x40,
+      0xE3, 0x33, 0xC9, 0x26, 0x5D, 0x83, 0xDE, 0x63,
+      0xE5, 0xC6, 0x5C, 0x99, 0x43, 0x58, 0x72, 0xC6,
+      0xED, 0x87, 0x46, 0x3D, 0xD0, 0x63, 0x38, 0xB4,
+      0x8E, 0xBD, 0x22, 0x3E, 0x89, 0xF0, 0x85, 0xC6
+    },
+    {
+      0x3F, 0xB0, 0x4B, 0xFE, 0x13, 0x0D, 0x71, 0xFD,
+      0xD6, 0xC8, 0xB9, 0xDC, 0xC6, 0xF0, 0xA5, 0xE6,
+      0xC0, 0x4B, 0x7B, 0x2E, 0x78, 0xC4, 0x7F, 0x5D,
+      0x61, 0x18, 0xDE, 0x4A, 0xDD, 0xB6, 0x5F, 0x02,
+      0xF6, 0x08, 0xBA, 0x2A, 0x13, 0x0C, 0x35, 0x07,
+      0x19, 0x27, 0x95, 0xA2, 0x4A, 0xA5, 0xF3, 0xBD,
+      0xDF, 0x40, 0x7C, 0x7D, 0x30, 0x70, 0x1C, 0x34,
+      0xEA, 0x61, 0x97, 0x41, 0x2F, 0x88, 0xA6, 0xC2
+    }
+  };
+  static const size_t chunks[] = { 1, 7, 128, 511, 512, 513, 1000, 4099 };
+  uint8_t msg[4099];
+  uint8_t hash[BLAKE2B_OUTBYTES];
+  blake2bp_state state;
+  size_t i, j, k, n, keylen;
+
+  for (i = 0; i < BLAKE2_KAT_LENGTH; ++i) {
+    blake2bp(hash, BLAKE2B_OUTBYTES, buf, i, key, 0);
+    if (memcmp(hash, blake2bp_kat[i], BLAKE2B_OUTBYTES)) {
+      printf("blake2bp failed at %d\n", (int)i);
+      return -1;
+    }
+    blake2bp(hash, BLAKE2B_OUTBYTES, buf, i, key, BLAKE2B_KEYBYTES);
+    if (memcmp(hash, blake2bp_keyed_kat[i], BLAKE2B_OUTBYTES)) {
+      printf("keyed blake2bp failed at %d\n", (int)i);
+      return -1;
+    }
+  }
+
+  for (i = 0; i < sizeof(msg); ++i) {
+    msg[i] = (uint8_t)i;
+  }
+  for (k = 0; k < 2; ++k) {
+    keylen = k ? BLAKE2B_KEYBYTES : 0;
+    for (j = 0; j < sizeof(chunks) / sizeof(chunks[0]); ++j) {
+      blake2bp_init(&state, BLAKE2B_OUTBYTES, key, keylen);
+      for (i = 0; i < sizeof(msg); i += n) {
+        n = sizeof(msg) - i < chunks[j] ? sizeof(msg) - i : chunks[j];
+        blake2bp_update(&state, msg + i, n);
+      }
+      blake2bp_final(&state, hash, BLAKE2B_OUTBYTES);
+      if (memcmp(hash, long_kat[k], BLAKE2B_OUTBYTES)) {
+        printf("blake2bp failed with %d-byte chunks\n", (int)chunks[j]);
+        return -1;
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks tree hashing of a 300000-byte message against reference digests for
+ * three tree shapes, with 1 to 7 threads, and that a tree too shallow for the
+ * input is rejected
+ *
+ * @param[in]  key   the test key
+ *
+ * @return     0 if every digest matches, -1 otherwise
+ */
+int
+test_tree(const uint8_t* key)
+{
+  static const struct
+  {
+    uint8_t outlen, keylen, fanout, depth, inner;
+    uint32_t leaf;
+    uint8_t digest[BLAKE2B_OUTBYTES];
+  } trees[] = {
+    { 64, 0, 4, 8, 64, 4096, {
+      0x9A, 0x73, 0x12, 0x91, 0x6A, 0xEA, 0xD1, 0x77,
+      0x76, 0xBF, 0x8F, 0x4A, 0x01, 0x35, 0xFE, 0x7B,
+      0x8F, 0x87, 0x66, 0x55, 0x9C, 0x0D, 0x0C, 0x28,
+      0x24, 0x84, 0x9C, 0xFC, 0x2E, 0x36, 0xF0, 0x91,
+      0xA8, 0xF7, 0x37, 0x42, 0xC3, 0xE8, 0xF8, 0xE8,
+      0xAB, 0xEF, 0xBE, 0xB7, 0x48, 0xEF, 0xCE, 0xAD,
+      0x81, 0x9D, 0xA2, 0x00, 0xCA, 0x84, 0x59, 0xC4,
+      0x1B, 0xB7, 0xA5, 0xA6, 0x25, 0x22, 0x02, 0xF5 } },
+    /* fanout 0: the root takes all 300 leaves */
+    { 32, 64, 0, 2, 32, 1000, {
+      0xBA, 0xA9, 0x26, 0xF9, 0x0C, 0x7C, 0xB2, 0xBA,
+      0x45, 0x1C, 0xFF, 0x35, 0x4C, 0x97, 0x47, 0x33,
+      0x16, 0x7C, 0xE3, 0x86, 0xB2, 0x12, 0xD2, 0xF6,
+      0x2C, 0x74, 0x3A, 0x9A, 0x3D, 0xEB, 0x8D, 0x33 } },
+    /* a single leaf is the root */
+    { 64, 0, 2, 3, 64, 1 << 20, {
+      0xAB, 0x95, 0xD9, 0x7A, 0xF1, 0x5A, 0xE8, 0xAD,
+      0x90, 0xCF, 0x91, 0x43, 0xBC, 0xEB, 0x0D, 0xE7,
+      0x9F, 0x9D, 0x15, 0x99, 0x37, 0xC8, 0xBB, 0xA6,
+      0xE5, 0x2C, 0x71, 0xA9, 0x95, 0x37, 0x9C, 0x30,
+      0x01, 0x19, 0x66, 0x5B, 0xDE, 0x82, 0x3E, 0x20,
+      0x5A, 0x81, 0xCA, 0x4A, 0x9D, 0xB6, 0x02, 0xCF,
+      0x9F, 0xFA, 0xB2, 0xD1, 0x7F, 0x80, 0x6A, 0x0A,
+      0x62, 0x95, 0xEA, 0x04, 0x83, 0xA9, 0x99, 0x09 } }
+  };
+  static uint8_t msg[300000];
+  uint8_t hash[BLAKE2B_OUTBYTES];
+  blake2b_param P;
+  size_t i, j, threads;
+
+  for (i = 0; i < sizeof(msg); ++i) {
+    msg[i] = (uint8_t)i;
+  }
+  for (j = 0; j < sizeof(trees) / sizeof(trees[0]); ++j) {
+    memset(&P, 0, sizeof(P));
+    P.digest_length = trees[j].outlen;
+    P.key_length = trees[j].keylen;
+    P.fanout = trees[j].fanout;
+    P.depth = trees[j].depth;
+    P.leaf_length = trees[j].leaf;
+    P.inner_length = trees[j].inner;
+    for (threads = 1; threads <= 7; ++threads) {
+      if (blake2b_tree_hash(hash, msg, sizeof(msg), key, &P, threads) != 0 ||
+          memcmp(hash, trees[j].digest, P.digest_length)) {
+        printf("tree %d failed with %d threads\n", (int)j, (int)threads);
+        return -1;
+      }
+    }
+  }
+
+  /* 74 leaves of 4096 bytes need four levels with fanout 4 */
+  memset(&P, 0, sizeof(P));
+  P.digest_length = BLAKE2B_OUTBYTES;
+  P.fanout = 4;
+  P.depth = 3;
+  P.leaf_length = 4096;
+  P.inner_length = BLAKE2B_OUTBYTES;
+  if (blake2b_tree_hash(hash, msg, sizeof(msg), NULL, &P, 1) != -1) {
+    printf("tree too shallow was not rejected\n");
+    return -1;
+  }
+  return 0;
+}
+
+#if !defined(_WIN32)
+/**
+ * Checks that a tree hashed in pieces matches the tree hashed at once: one
+ * child process per level 2 subtree of a 300000-byte message hashes only its
+ * own bytes and sends the digest back through a pipe, as separate storage
+ * nodes would, and the parent merges the digests level by level up to the
+ * root
+ *
+ * @param[in]  key   the test key
+ *
+ * @return     0 if the merged digest matches, -1 otherwise
+ */
+int
+test_tree_shards(const uint8_t* key)
+{
+  static uint8_t msg[300000];
+  static uint8_t digests[2][64 * BLAKE2B_OUTBYTES];
+  uint8_t hash[BLAKE2B_OUTBYTES], root[BLAKE2B_OUTBYTES];
+  blake2b_param P;
+  uint64_t n, k, first, count;
+  size_t i, level, shard = 2, span;
+  int fds[2], status, failed = 0;
+  pid_t pid;
+
+  for (i = 0; i < sizeof(msg); ++i) {
+    msg[i] = (uint8_t)i;
+  }
+  memset(&P, 0, sizeof(P));
+  P.digest_length = BLAKE2B_OUTBYTES;
+  P.key_length = BLAKE2B_KEYBYTES;
+  P.fanout = 4;
+  P.depth = 8;
+  P.leaf_length = 4096;
+  P.inner_length = BLAKE2B_OUTBYTES;
+  if (blake2b_tree_hash(hash, msg, sizeof(msg), key, &P, 1) != 0) {
+    return -1;
+  }
+
+  /* 74 leaves, 19 nodes on level 1 and 5 subtrees of 16 leaves on level 2 */
+  n = blake2b_tree_nodes(&P, sizeof(msg), shard);
+  span = 16 * 4096;
+  if (n != 5 || pipe(fds) != 0) {
+    return -1;
+  }
+  for (k = 0; k < n; ++k) {
+    pid = fork();
+    if (pid < 0) {
+      /* reap the shards already started before giving up */
+      close(fds[0]);
+      close(fds[1]);
+      while (wait(&status) > 0) {
+      }
+      printf("tree shard fork failed\n");
+      return -1;
+    }
+    if (pid == 0) {
+      /* the storage node holding bytes [k * span, (k + 1) * span) */
+      uint8_t out[1 + BLAKE2B_OUTBYTES];
+      size_t len = k + 1 < n ? span : sizeof(msg) - k * span;
+
+      P.node_depth = (uint8_t)shard;
+      P.node_offset = k;
+      out[0] = (uint8_t)k;
+      status = blake2b_tree_subtree(out + 1, msg + k * span, len,
+                                    sizeof(msg), key, &P, 2);
+      if (status != 0 || write(fds[1], out, sizeof(out)) != sizeof(out)) {
+        _exit(1);
+      }
+      _exit(0);
+    }
+  }
+  close(fds[1]);
+  for (k = 0; k < n; ++k) {
+    uint8_t in[1 + BLAKE2B_OUTBYTES];
+
+    if (read(fds[0], in, sizeof(in)) != sizeof(in) || in[0] >= n) {
+      failed = 1;
+      break;
+    }
+    memcpy(digests[0] + in[0] * BLAKE2B_OUTBYTES, in + 1, BLAKE2B_OUTBYTES);
+  }
+  close(fds[0]);
+  while (wait(&status) > 0) {
+    failed |= !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+  }
+  if (failed) {
+    printf("tree shard failed\n");
+    return -1;
+  }
+
+  /* merge the shards up to the root, which is the only node of its level */
+  for (level = shard + 1; n > 1; ++level) {
+    uint8_t* below = digests[(level - shard - 1) & 1];
+    uint8_t* above = digests[(level - shard) & 1];
+
+    n = blake2b_tree_nodes(&P, sizeof(msg), level);
+    for (k = 0; k < n; ++k) {
+      first = 4 * k;
+      count = blake2b_tree_nodes(&P, sizeof(msg), level - 1) - first;
+      count = count < 4 ? count : 4;
+      P.node_depth = (uint8_t)level;
+      P.node_offset = k;
+      if (blake2b_tree_merge(n > 1 ? above + k * BLAKE2B_OUTBYTES : root,
+                             below + first * BLAKE2B_OUTBYTES, (size_t)count,
+                             sizeof(msg), &P) != 0) {
+        printf("tree merge failed on level %d\n", (int)level);
+        return -1;
+      }
+    }
+  }
+  if (memcmp(root, hash, BLAKE2B_OUTBYTES)) {
+    printf("merged tree digest does not match\n");
+    return -1;
+  }
+  return 0;
+}
+#endif
+
+/**
+ * Checks that a 1 MiB BLAKE2Xb output read at once on 1 to 4 threads, and
+ * read from an odd offset, matches the same output squeezed in odd chunks
+ *
+ * @param[in]  key   the test key
+ *
+ * @return     0 if the outputs match, -1 otherwise
+ */
+int
+test_xb_long(const uint8_t* key)
+{
+  static uint8_t ref[1 << 20], out[1 << 20];
+  blake2xb_state state;
+  size_t i, n, threads;
+
+  blake2xb_init(&state, BLAKE2XB_LENGTH_UNKNOWN, key, BLAKE2B_KEYBYTES);
+  blake2xb_update(&state, key, BLAKE2B_KEYBYTES);
+  for (i = 0; i < sizeof(ref); i += n) {
+    n = sizeof(ref) - i < 1000 ? sizeof(ref) - i : 1000;
+    blake2xb_squeeze(&state, ref + i, n);
+  }
+  for (threads = 1; threads <= 4; ++threads) {
+    memset(out, 0, sizeof(out));
+    if (blake2xb_read(&state, 0, out, sizeof(out), threads) != 0 ||
+        memcmp(out, ref, sizeof(out)) ||
+        blake2xb_read(&state, 12345, out, sizeof(out) - 23456, threads) != 0 ||
+        memcmp(out, ref + 12345, sizeof(out) - 23456)) {
+      printf("blake2xb read failed with %d threads\n", (int)threads);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks BLAKE2Xb against reference outputs, squeezed in one piece and in
+ * chunks of various sizes, and that invalid lengths are rejected
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every output matches, -1 otherwise
+ */
+int
+test_xb(const uint8_t* key, const uint8_t* buf)
+{
+  /* keyed, 256-byte input, xof_length 256 */
+  static const uint8_t kat_256[256] = {
+    0x1E, 0x9B, 0x2C, 0x45, 0x4E, 0x9D, 0xE3, 0xA2,
+    0xD7, 0x23, 0xD8, 0x50, 0x33, 0x10, 0x37, 0xDB,
+    0xF5, 0x41, 0x33, 0xDB, 0xE2, 0x74, 0x88, 0xFF,
+    0x75, 0x7D, 0xD2, 0x55, 0x83, 0x3A, 0x27, 0xD8,
+    0xEB, 0x8A, 0x12, 0x8A, 0xD1, 0x2D, 0x09, 0x78,
+    0xB6, 0x88, 0x4E, 0x25, 0x73, 0x70, 0x86, 0xA7,
+    0x04, 0xFB, 0x28, 0x9A, 0xAA, 0xCC, 0xF9, 0x30,
+    0xD5, 0xB5, 0x82, 0xAB, 0x4D, 0xF1, 0xF5, 0x5F,
+    0x0C, 0x42, 0x9B, 0x68, 0x75, 0xED, 0xEC, 0x3F,
+    0xE4, 0x54, 0x64, 0xFA, 0x74, 0x16, 0x4B, 0xE0,
+    0x56, 0xA5, 0x5E, 0x24, 0x3C, 0x42, 0x22, 0xC5,
+    0x86, 0xBE, 0xC5, 0xB1, 0x8F, 0x39, 0x03, 0x6A,
+    0xA9, 0x03, 0xD9, 0x81, 0x80, 0xF2, 0x4F, 0x83,
+    0xD0, 0x9A, 0x45, 0x4D, 0xFA, 0x1E, 0x03, 0xA6,
+    0x0E, 0x6A, 0x3B, 0xA4, 0x61, 0x3E, 0x99, 0xC3,
+    0x5F, 0x87, 0x4D, 0x79, 0x01, 0x74, 0xEE, 0x48,
+    0xA5, 0x57, 0xF4, 0xF0, 0x21, 0xAD, 0xE4, 0xD1,
+    0xB2, 0x78, 0xD7, 0x99, 0x7E, 0xF0, 0x94, 0x56,
+    0x9B, 0x37, 0xB3, 0xDB, 0x05, 0x05, 0x95, 0x1E,
+    0x9E, 0xE8, 0x40, 0x0A, 0xDA, 0xEA, 0x27, 0x5C,
+    0x6D, 0xB5, 0x1B, 0x32, 0x5E, 0xE7, 0x30, 0xC6,
+    0x9D, 0xF9, 0x77, 0x45, 0xB5, 0x56, 0xAE, 0x41,
+    0xCD, 0x98, 0x74, 0x1E, 0x28, 0xAA, 0x3A, 0x49,
+    0x54, 0x45, 0x41, 0xEE, 0xB3, 0xDA, 0x1B, 0x1E,
+    0x8F, 0xA4, 0xE8, 0xE9, 0x10, 0x0D, 0x66, 0xDD,
+    0x0C, 0x7F, 0x5E, 0x2C, 0x27, 0x1B, 0x1E, 0xCC,
+    0x07, 0x7D, 0xE7, 0x9C, 0x46, 0x2B, 0x9F, 0xE4,
+    0xC2, 0x73, 0x54, 0x3E, 0xCD, 0x82, 0xA5, 0xBE,
+    0xA6, 0x3C, 0x5A, 0xCC, 0x01, 0xEC, 0xA5, 0xFB,
+    0x78, 0x0C, 0x7D, 0x7C, 0x8C, 0x9F, 0xE2, 0x08,
+    0xAE, 0x8B, 0xD5, 0x0C, 0xAD, 0x17, 0x69, 0x69,
+    0x3D, 0x92, 0xC6, 0xC8, 0x64, 0x9D, 0x20, 0xD8
+  };
+  /* xof_length 65: not a prefix of the above, xof_length is in every block */
+  static const uint8_t kat_65[65] = {
+    0x78, 0xF0, 0xED, 0x6E, 0x22, 0x0B, 0x3D, 0xA3,
+    0xCC, 0x93, 0x81, 0x56, 0x3B, 0x2F, 0x72, 0xC8,
+    0xDC, 0x83, 0x0C, 0xB0, 0xF3, 0x9A, 0x48, 0xC6,
+    0xAE, 0x47, 0x9A, 0x6A, 0x78, 0xDC, 0xFA, 0x94,
+    0x00, 0x26, 0x31, 0xDE, 0xC4, 0x67, 0xE9, 0xE9,
+    0xB4, 0x7C, 0xC8, 0xF0, 0x88, 0x7E, 0xB6, 0x80,
+    0xE3, 0x40, 0xAE, 0xC3, 0xEC, 0x00, 0x9D, 0x4A,
+    0x33, 0xD2, 0x41, 0x53, 0x3C, 0x76, 0xC8, 0xCA,
+    0x8C
+  };
+  static const size_t chunks[] = { 1, 7, 64, 65, 200 };
+  uint8_t out[256], ref[256];
+  blake2xb_state state;
+  size_t i, j, n;
+
+  if (blake2xb(out, 256, buf, BLAKE2_KAT_LENGTH, key, BLAKE2B_KEYBYTES) != 0 ||
+      memcmp(out, kat_256, 256) ||
+      blake2xb(out, 65, buf, BLAKE2_KAT_LENGTH, key, BLAKE2B_KEYBYTES) != 0 ||
+      memcmp(out, kat_65, 65) ||
+      blake2xb(out, 1, buf, BLAKE2_KAT_LENGTH, key, BLAKE2B_KEYBYTES) != 0 ||
+      out[0] != 0x64) {
+    printf("blake2xb failed\n");
+    return -1;
+  }
+
+  for (j = 0; j < sizeof(chunks) / sizeof(chunks[0]); ++j) {
+    blake2xb_init(&state, 256, key, BLAKE2B_KEYBYTES);
+    blake2xb_update(&state, buf, BLAKE2_KAT_LENGTH);
+    for (i = 0; i < 256; i += n) {
+      n = 256 - i < chunks[j] ? 256 - i : chunks[j];
+      if (blake2xb_squeeze(&state, out + i, n) != 0) {
+        return -1;
+      }
+    }
+    if (memcmp(out, kat_256, 256) || blake2xb_squeeze(&state, out, 1) != -1) {
+      printf("blake2xb squeeze failed with %d-byte chunks\n",
+             (int)chunks[j]);
+      return -1;
+    }
+  }
+
+  /* with an unknown length, the stream is made of full blocks */
+  blake2xb_init(&state, BLAKE2XB_LENGTH_UNKNOWN, key, BLAKE2B_KEYBYTES);
+  blake2xb_update(&state, buf, BLAKE2_KAT_LENGTH);
+  blake2xb_final(&state, ref, 256);
+  blake2xb_init(&state, BLAKE2XB_LENGTH_UNKNOWN, key, BLAKE2B_KEYBYTES);
+  blake2xb_update(&state, buf, BLAKE2_KAT_LENGTH);
+  for (i = 0; i < 256; i += 48) {
+    blake2xb_squeeze(&state, out + i, 256 - i < 48 ? 256 - i : 48);
+  }
+  if (memcmp(out, ref, 256) || !memcmp(ref, kat_256, 256)) {
+    printf("blake2xb squeeze failed with an unknown length\n");
+    return -1;
+  }
+
+  /* any window of the output, without the bytes before it */
+  blake2xb_init(&state, 256, key, BLAKE2B_KEYBYTES);
+  blake2xb_update(&state, buf, BLAKE2_KAT_LENGTH);
+  if (blake2xb_read(&state, 0, out, 1, 1) != -1) {
+    printf("blake2xb read before finalize was not rejected\n");
+    return -1;
+  }
+  blake2xb_finalize(&state);
+  for (i = 0; i < 256; i += 13) {
+    for (n = 0; i + n <= 256; n += 29) {
+      if (blake2xb_read(&state, i, out, n, 1) != 0 ||
+          memcmp(out, kat_256 + i, n)) {
+        printf("blake2xb read failed at %d+%d\n", (int)i, (int)n);
+        return -1;
+      }
+    }
+  }
+  if (blake2xb_read(&state, 200, out, 57, 1) != -1 ||
+      blake2xb_read(&state, 257, out, 0, 1) != -1) {
+    printf("blake2xb read past the end was not rejected\n");
+    return -1;
+  }
+
+  /* a long output on several threads matches the same output squeezed */
+  if (test_xb_long(key) != 0) {
+    return -1;
+  }
+
+  if (blake2xb_init(&state, 0, NULL, 0) != -1 ||
+      blake2xb_init(&state, 16, key, BLAKE2B_KEYBYTES + 1) != -1 ||
+      blake2xb_init(&state, 16, NULL, 0) != 0 ||
+      blake2xb_final(&state, out, 17) != -1) {
+    printf("blake2xb did not reject invalid lengths\n");
+    return -1;
+  }
+  return 0;
+}
+
+int
+main(int argc, char const* argv[])
+{
+  static const char* kernels[] = { "ref", "sse41", "avx2", "avx512" };
+  uint8_t key[BLAKE2B_KEYBYTES];
+  uint8_t buf[BLAKE2_KAT_LENGTH];
+  size_t i;
+
+  /* Key of the form (i, i+1 ... i+63 where i=0) */
+  for (i = 0; i < BLAKE2B_KEYBYTES; ++i) {
+    key[i] = (uint8_t)i;
+  }
+
+  /* Buffer of the form (i, i+1 ... i+255 where i=0) */
+  for (i = 0; i < BLAKE2_KAT_LENGTH; ++i) {
+    buf[i] = (uint8_t)i;
+  }
+
+  /* Every kernel this CPU can run has to match the test vectors */
+  for (i = 0; i < sizeof(kernels) / sizeof(kernels[0]); ++i) {
+    if (blake2b_select_kernel(kernels[i]) != 0) {
+      printf("Skipping %s kernel\n", kernels[i]);
+      continue;
+    }
+    if (test_kat(key, buf) != 0 || test_short(buf) != 0 ||
+        test_update(buf) != 0 || test_param(key, buf) != 0 ||
+        test_mac(key, buf) != 0 || test_prefix(key, buf) != 0 ||
+        test_lanes(key, buf) != 0 || test_node(buf) != 0 ||
+        test_merkle(buf) != 0 || test_batch(key, buf) != 0 ||
+        test_mgr(key, buf) != 0 || test_bp(key, buf) != 0 ||
+        test_tree(key) != 0 || test_xb(key, buf) != 0) {
+      printf("%s kernel failed\n", kernels[i]);
+      return -1;
+    }
+#if !defined(_WIN32)
+    if (test_tree_shards(key) != 0) {
+      printf("%s kernel failed\n", kernels[i]);
+      return -1;
+    }
+#endif
+  }
+
   /* All test vectors pass successfully */
   printf("Success\n");
 
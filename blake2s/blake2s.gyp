@@ -1,4 +1,9 @@
 {
+  'variables': {
+    # Fully unroll the rounds of the portable compress function. Set to 0 for
+    # the smaller looped version.
+    'unroll_rounds%': 1,
+  },
   'targets': [
     {
       'target_name': 'blake2s',
@@ -8,8 +13,84 @@
       ],
       'sources': [
         'src/blake2s.c',
+        'src/blake2s_batch.c',
+        'src/blake2s_cpu.c',
+        'src/blake2s_lanes.c',
+        'src/blake2s_mac.c',
+        'src/blake2sp.c',
+        'src/blake2s_prefix.c',
+        'src/blake2xs.c',
         'src/test.c',
       ],
+      'conditions': [
+        ['OS!="win"', {
+          'link_settings': {
+            'libraries': [
+              '-lpthread',
+            ],
+          },
+        }],
+        ['unroll_rounds==1', {
+          'defines': [
+            'BLAKE2S_UNROLL',
+          ],
+        }],
+        # The vectorized kernels are picked at runtime, see blake2s_compress
+        ['target_arch=="x64" or target_arch=="ia32"', {
+          'dependencies': [
+            'blake2s_sse41',
+            'blake2s_avx2',
+            'blake2s_avx512',
+          ],
+        }],
+      ],
    }
       ],
+  'conditions': [
+    ['target_arch=="x64" or target_arch=="ia32"', {
+      'targets': [
+        {
+          'target_name': 'blake2s_sse41',
+          'type': 'static_library',
+          'include_dirs': [
+            'include/',
+          ],
+          'cflags': [
+            '-msse4.1',
+          ],
+          'sources': [
+            'src/blake2s_sse41.c',
+          ],
+        },
+        {
+          'target_name': 'blake2s_avx2',
+          'type': 'static_library',
+          'include_dirs': [
+            'include/',
+          ],
+          'cflags': [
+            '-mavx2',
+          ],
+          'sources': [
+            'src/blake2s_x8_avx2.c',
+          ],
+        },
+        {
+          'target_name': 'blake2s_avx512',
+          'type': 'static_library',
+          'include_dirs': [
+            'include/',
+          ],
+          'cflags': [
+            '-mavx512f',
+            '-mavx512vl',
+          ],
+          'sources': [
+            'src/blake2s_avx512.c',
+            'src/blake2s_x16_avx512.c',
+          ],
+        },
+      ],
+    }],
+  ],
 }
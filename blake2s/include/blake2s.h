@@ -47,6 +47,7 @@
     uint8_t  buf[BLAKE2S_BLOCKBYTES]; /* Input buffer */
     size_t   buflen; /* size of buffer */
     size_t   outlen; /* digest (output) size */
+    uint8_t  last_node; /* Last node of its level in a tree */
   } blake2s_state;
 
   typedef struct blake2s_param
@@ -65,10 +66,168 @@
   } blake2s_param;
   
 
+  /**
+   * Number of lanes a blake2s_lanes instance holds, enough for the widest
+   * multi-lane kernel
+   */
+
+  #define BLAKE2S_MAX_LANES 16
+
+  /**
+   * State of several independent blake2s instances in transposed form: word i
+   * of the chained state of lane j is h[i][j], so a multi-lane kernel loads the
+   * same word of consecutive lanes with one vector load
+   */
+
+  typedef struct blake2s_lanes
+  {
+    uint32_t h[8][BLAKE2S_MAX_LANES]; /* Chained states */
+    uint32_t t[2][BLAKE2S_MAX_LANES]; /* Total number of bytes */
+    uint32_t f[2][BLAKE2S_MAX_LANES]; /* Last block flags */
+  } blake2s_lanes;
+
+  /**
+   * Position of one message in a lane of a blake2s_lanes instance. Each lane
+   * steps through its own message, so lanes may hold messages of different
+   * lengths and keys.
+   */
+
+  typedef struct blake2s_lane_msg
+  {
+    const uint8_t* in;               /* Rest of the message */
+    size_t inlen;                    /* Bytes left in in */
+    const uint8_t* key;              /* Key to absorb first, NULL once done */
+    size_t keylen;                   /* Key length */
+    int final;                       /* Last block has been handed out */
+    uint8_t buf[BLAKE2S_BLOCKBYTES]; /* Padded key or padded last block */
+  } blake2s_lane_msg;
+
+  /**
+   * Keyed hashing context: the state after the key block, computed once and
+   * shared read-only by any number of messages and threads
+   */
+
+  typedef struct blake2s_mac_ctx
+  {
+    uint32_t h[8];                   /* Chained state after the key block */
+    uint32_t t;                      /* Bytes absorbed, the key block or 0 */
+    size_t outlen;                   /* Digest size */
+    uint8_t empty[BLAKE2S_OUTBYTES]; /* Digest of the empty message */
+  } blake2s_mac_ctx;
+
+  /**
+   * Midstates of a fixed prefix, at every block boundary of it, so that
+   * messages starting with all or part of the prefix only pay for the rest
+   */
+
+  typedef struct blake2s_prefix
+  {
+    blake2s_mac_ctx mac; /* State after the key block, if any */
+    uint8_t* prefix;     /* Copy of the prefix */
+    size_t prefixlen;    /* Prefix length */
+    size_t blocks;       /* Whole blocks in the prefix */
+    uint32_t (*h)[8];    /* h[j]: chained state after j blocks */
+  } blake2s_prefix;
+
+  /* One message of a blake2s_batch call */
+  typedef struct blake2s_desc
+  {
+    const void* in;  /* Message */
+    size_t inlen;    /* Message length */
+    const void* key; /* Key, NULL for unkeyed hashing */
+    size_t keylen;   /* Key length */
+    void* out;       /* Digest output */
+    size_t outlen;   /* Digest size */
+  } blake2s_desc;
+
+  /**
+   * Number of leaves of BLAKE2sp, each hashing every eighth block of the input
+   */
+
+  #define BLAKE2SP_LEAVES 8
+
+  /**
+   * BLAKE2sp state: the eight leaves live in lanes 0 to 7 so that one stripe
+   * of eight blocks is a single multi-lane compression
+   */
+
+  typedef struct blake2sp_state
+  {
+    blake2s_lanes leaves;                                  /* Leaf states */
+    uint8_t buf[2 * BLAKE2SP_LEAVES * BLAKE2S_BLOCKBYTES]; /* Input buffer */
+    size_t buflen;                                         /* Size of buffer */
+    uint8_t key[BLAKE2S_KEYBYTES];                         /* Key */
+    size_t keylen;                                         /* Key length */
+    int key_pending;                   /* Leaves have not absorbed the key */
+    size_t outlen;                                         /* Digest size */
+  } blake2sp_state;
+
+  /**
+   * Output length that lets blake2xs_final produce any number of bytes, up to
+   * 2^32 blocks of 32 bytes
+   */
+
+  #define BLAKE2XS_LENGTH_UNKNOWN 0xFFFF
+
+  /**
+   * BLAKE2Xs state: the root blake2s instance that absorbs the input, and its
+   * parameter block, from which the output blocks derive theirs
+   */
+
+  typedef struct blake2xs_state
+  {
+    blake2s_state S;                  /* Root hash state */
+    blake2s_param P;                  /* Root parameter block */
+    uint8_t root[BLAKE2S_OUTBYTES];   /* Root digest, once finalized */
+    int finalized;                    /* Root digest has been computed */
+  } blake2xs_state;
+
   /* Streaming API */
   extern void blake2s_init(blake2s_state* state, size_t outlen, const void* key, size_t keylen);
   extern void blake2s_update( blake2s_state* state, const unsigned char* in, size_t inlen );
   extern void blake2s_final( blake2s_state* state, void* out, size_t outlen );
   extern void blake2s(void* output, size_t outlen, const void* input, size_t inlen, const void* key, size_t keylen);
 
+  /* Parameter block API */
+  extern void blake2s_init_param(blake2s_state* state, const blake2s_param* P);
+  extern void blake2s_init_param_key(blake2s_state* state, const blake2s_param* P, const void* key);
+  extern void blake2s_init_salt_personal(blake2s_state* state, size_t outlen, const void* key, size_t keylen,
+          const void* salt, const void* personal);
+  extern void blake2s_param_hash(void* output, const void* input, size_t inlen, const void* key, const blake2s_param* P);
+  extern void blake2s_salt_personal(void* output, size_t outlen, const void* input, size_t inlen,
+          const void* key, size_t keylen, const void* salt, const void* personal);
+
+  /* Keyed hashing API */
+  extern void blake2s_mac_init(blake2s_mac_ctx* ctx, size_t outlen, const void* key, size_t keylen);
+  extern void blake2s_mac_start(const blake2s_mac_ctx* ctx, blake2s_state* state);
+  extern void blake2s_mac_final(const blake2s_mac_ctx* ctx, blake2s_state* state, void* out);
+  extern void blake2s_mac(const blake2s_mac_ctx* ctx, void* out, const void* in, size_t inlen);
+
+  /* State cloning and prefix cache API */
+  extern void blake2s_clone(blake2s_state* dst, const blake2s_state* src);
+  extern int blake2s_prefix_init(blake2s_prefix* cache, size_t outlen, const void* key, size_t keylen, const void* prefix, size_t prefixlen);
+  extern void blake2s_prefix_free(blake2s_prefix* cache);
+  extern size_t blake2s_prefix_start(const blake2s_prefix* cache, blake2s_state* state, const void* in, size_t inlen);
+  extern void blake2s_prefix_hash(const blake2s_prefix* cache, void* out, const void* in, size_t inlen);
+  extern void blake2s_prefix_tail(const blake2s_prefix* cache, void* out, const void* tail, size_t taillen);
+
+  /* Multi-message API */
+  extern void blake2s_x8(void* output[8], size_t outlen, const void* const input[8], size_t inlen, const void* key, size_t keylen);
+  extern void blake2s_x16(void* output[16], size_t outlen, const void* const input[16], size_t inlen, const void* key, size_t keylen);
+  extern void blake2s_batch(const blake2s_desc* descs, size_t n);
+
+  /* BLAKE2sp API */
+  extern void blake2sp_init(blake2sp_state* state, size_t outlen, const void* key, size_t keylen);
+  extern void blake2sp_update(blake2sp_state* state, const void* in, size_t inlen);
+  extern void blake2sp_final(blake2sp_state* state, void* out, size_t outlen);
+  extern void blake2sp(void* output, size_t outlen, const void* input, size_t inlen, const void* key, size_t keylen);
+
+  /* BLAKE2Xs API */
+  extern int blake2xs_init(blake2xs_state* state, size_t outlen, const void* key, size_t keylen);
+  extern void blake2xs_update(blake2xs_state* state, const void* in, size_t inlen);
+  extern void blake2xs_finalize(blake2xs_state* state);
+  extern int blake2xs_final(blake2xs_state* state, void* out, size_t outlen);
+  extern int blake2xs_read(const blake2xs_state* state, uint64_t offset, void* out, size_t outlen, size_t threads);
+  extern int blake2xs(void* output, size_t outlen, const void* input, size_t inlen, const void* key, size_t keylen);
+
 #endif /* BLAKE_H */
@@ -0,0 +1,137 @@
+#ifndef BLAKE2S_IMPL_H
+#define BLAKE2S_IMPL_H
+
+#include "blake2s.h"
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+  #define BLAKE2S_X86
+#endif
+
+/**
+ * Inlining that the compiler may not refuse, for the per-block helpers of the
+ * multi-block kernels: the chaining value only stays in registers across
+ * blocks if the helper is merged into the loop.
+ */
+
+#if defined(_MSC_VER)
+  #define BLAKE2S_INLINE static __forceinline
+#elif defined(__GNUC__)
+  #define BLAKE2S_INLINE static inline __attribute__((always_inline))
+#else
+  #define BLAKE2S_INLINE static inline
+#endif
+
+/**
+ * Instruction set extensions the vectorized kernels need
+ */
+
+enum blake2s_cpu_feature
+{
+  BLAKE2S_CPU_SSE41 = 1 << 0,  /* SSSE3 and SSE4.1 */
+  BLAKE2S_CPU_AVX2 = 1 << 1,   /* AVX2, with YMM state enabled */
+  BLAKE2S_CPU_AVX512 = 1 << 2  /* AVX-512F and AVX-512VL */
+};
+
+/**
+ * Helper macro to load into src 32 bytes at a time
+ *
+ * @param[in]  dest  the destination
+ * @param[in]  src   the source
+ */
+
+#if defined(NATIVE_LITTLE_ENDIAN)
+  #define LOAD32(dest, src) memcpy(&(dest), (src), sizeof (dest))
+#else
+  #define LOAD32(dest, src)                                          \
+    do {                                                             \
+    const uint8_t* load = (const uint8_t*)(src);                     \
+    dest = ((uint64_t)(load[0]) <<  0) |                             \
+           ((uint64_t)(load[1]) <<  8) |                             \
+           ((uint64_t)(load[2]) << 16) |                             \
+           ((uint64_t)(load[3]) << 24);                              \
+    } while(0)
+#endif
+
+/**
+ * Signature shared by all compress functions
+ */
+
+typedef void (*blake2s_compress_fn)(blake2s_state* state, const uint8_t block[BLAKE2S_BLOCKBYTES]);
+
+/**
+ * Signature shared by all multi-block compress functions, which compress
+ * nblocks consecutive blocks of one message, none of them the last one, and
+ * advance the counter by one block before each
+ */
+
+typedef void (*blake2s_blocks_fn)(blake2s_state* state, const uint8_t* in, size_t nblocks);
+
+/**
+ * Signature shared by all multi-lane compress functions, which compress one
+ * block into each of a fixed number of consecutive lanes starting at lane
+ */
+
+typedef void (*blake2s_lanes_fn)(blake2s_lanes* lanes, size_t lane, const uint8_t* const blocks[]);
+
+/**
+ * Message schedule of each round for the kernels that keep a whole row of v
+ * in one register, derived from blake2s_sigma. Row r holds the words of round
+ * r in the order the vectors are consumed: the first message word of the four
+ * column G's, the second one, then the same for the four diagonal G's, i.e.
+ *
+ *   s[0], s[2], s[4], s[6],  s[1], s[3], s[5], s[7],
+ *   s[8], s[10], s[12], s[14],  s[9], s[11], s[13], s[15]
+ */
+static const uint8_t blake2s_vec_schedule[10][16] = {
+  {  0,  2,  4,  6,  1,  3,  5,  7,  8, 10, 12, 14,  9, 11, 13, 15 },
+  { 14,  4,  9, 13, 10,  8, 15,  6,  1,  0, 11,  5, 12,  2,  7,  3 },
+  { 11, 12,  5, 15,  8,  0,  2, 13, 10,  3,  7,  9, 14,  6,  1,  4 },
+  {  7,  3, 13, 11,  9,  1, 12, 14,  2,  5,  4, 15,  6, 10,  0,  8 },
+  {  9,  5,  2, 10,  0,  7,  4, 15, 14, 11,  6,  3,  1, 12,  8, 13 },
+  {  2,  6,  0,  8, 12, 10, 11,  3,  4,  7, 15,  1, 13,  5, 14,  9 },
+  { 12,  1, 14,  4,  5, 15, 13, 10,  0,  6,  9,  8,  7,  3,  2, 11 },
+  { 13,  7, 12,  3, 11, 14,  1,  9,  5, 15,  8,  2,  0,  4,  6, 10 },
+  {  6, 14, 11,  0, 15,  9,  3,  8, 12, 13,  1, 10,  2,  7,  4,  5 },
+  { 10,  8,  7,  1,  2,  4,  6,  5, 15,  9,  3, 13, 11, 14, 12,  0 }
+};
+
+/**
+ * Vectorized blake2s compress functions. Each one takes a full 64-byte chunk
+ * of the input message and mixes it into the ongoing state array, exactly like
+ * the portable F() in blake2s.c, and is built in its own translation unit with
+ * the instruction set it needs enabled.
+ */
+extern void blake2s_compress_sse41(blake2s_state* state, const uint8_t block[BLAKE2S_BLOCKBYTES]);
+extern void blake2s_compress_avx512(blake2s_state* state, const uint8_t block[BLAKE2S_BLOCKBYTES]);
+
+/**
+ * Multi-block compress functions, keeping the chaining value and counter in
+ * registers across the blocks
+ */
+
+extern void blake2s_compress_blocks_sse41(blake2s_state* state, const uint8_t* in, size_t nblocks);
+extern void blake2s_compress_blocks_avx512(blake2s_state* state, const uint8_t* in, size_t nblocks);
+
+/**
+ * Multi-lane compress functions
+ */
+
+extern void blake2s_compress_x8_avx2(blake2s_lanes* lanes, size_t lane, const uint8_t* const blocks[8]);
+extern void blake2s_compress_x16_avx512(blake2s_lanes* lanes, size_t lane, const uint8_t* const blocks[16]);
+
+extern void store32(uint8_t* dst, uint32_t w);
+extern void blake2s_compress_lanes(blake2s_lanes* lanes, const uint8_t* const blocks[], size_t nlanes);
+extern void blake2s_lanes_init(blake2s_lanes* lanes, size_t lane, const blake2s_param* P);
+extern void blake2s_lanes_store(const blake2s_lanes* lanes, size_t lane, uint8_t* out, size_t outlen);
+extern void blake2s_lanes_move(blake2s_lanes* lanes, size_t dst, size_t src);
+extern void blake2s_lane_msg_start(blake2s_lanes* lanes, size_t lane, blake2s_lane_msg* msg, size_t outlen,
+        const void* in, size_t inlen, const void* key, size_t keylen);
+extern const uint8_t* blake2s_lane_msg_next(blake2s_lanes* lanes, size_t lane, blake2s_lane_msg* msg);
+
+extern int blake2s_cpu_features(void);
+extern int blake2s_select_kernel(const char* name);
+extern const char* blake2s_kernel_name(void);
+
+#endif /* BLAKE2S_IMPL_H */
@@ -0,0 +1,68 @@
+#ifndef BLAKE2S_TRANSPOSE_H
+#define BLAKE2S_TRANSPOSE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <immintrin.h>
+
+/**
+ * Transposes eight 32-byte rows of 32-bit words so that word i of every row
+ * ends up in out[i], row j in element j. Only for translation units built
+ * with AVX2 enabled.
+ *
+ * @param[out] out   the eight transposed vectors
+ * @param[in]  r     the eight rows
+ */
+
+static inline void blake2s_transpose_8x8(__m256i out[8], const __m256i r[8])
+{
+  __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+  __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+  __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+  __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+  __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+  __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+  __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+  __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+  __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+  __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+  __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+  __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+  __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+  __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+  __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+  __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+  out[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+  out[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+  out[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+  out[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+  out[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+  out[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+  out[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+  out[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+/**
+ * Loads one 64-byte block from each of eight pointers and transposes them so
+ * that m[i] holds message word i of every block, block j in element j
+ *
+ * @param[out] m       the sixteen transposed message vectors
+ * @param[in]  blocks  the eight input blocks
+ */
+
+static inline void blake2s_transpose_x8(__m256i m[16], const uint8_t* const blocks[8])
+{
+  __m256i r[8];
+  size_t i, k;
+
+  for (k = 0; k < 2; ++k) {
+    for (i = 0; i < 8; ++i) {
+      r[i] = _mm256_loadu_si256((const __m256i*)(blocks[i] + 32 * k));
+    }
+    blake2s_transpose_8x8(m + 8 * k, r);
+  }
+}
+
+#endif /* BLAKE2S_TRANSPOSE_H */
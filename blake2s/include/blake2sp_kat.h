@@ -0,0 +1,3079 @@
+static const uint8_t blake2sp_kat[BLAKE2_KAT_LENGTH][BLAKE2S_OUTBYTES] =
+{
+  {
+    0xDD, 0x0E, 0x89, 0x17, 0x76, 0x93, 0x3F, 0x43,
+    0xC7, 0xD0, 0x32, 0xB0, 0x8A, 0x91, 0x7E, 0x25,
+    0x74, 0x1F, 0x8A, 0xA9, 0xA1, 0x2C, 0x12, 0xE1,
+    0xCA, 0xC8, 0x80, 0x15, 0x00, 0xF2, 0xCA, 0x4F
+  },
+  {
+    0xA6, 0xB9, 0xEE, 0xCC, 0x25, 0x22, 0x7A, 0xD7,
+    0x88, 0xC9, 0x9D, 0x3F, 0x23, 0x6D, 0xEB, 0xC8,
+    0xDA, 0x40, 0x88, 0x49, 0xE9, 0xA5, 0x17, 0x89,
+    0x78, 0x72, 0x7A, 0x81, 0x45, 0x7F, 0x72, 0x39
+  },
+  {
+    0xDA, 0xCA, 0xDE, 0xCE, 0x7A, 0x8E, 0x6B, 0xF3,
+    0xAB, 0xFE, 0x32, 0x4C, 0xA6, 0x95, 0x43, 0x69,
+    0x84, 0xB8, 0x19, 0x5D, 0x29, 0xF6, 0xBB, 0xD8,
+    0x96, 0xE4, 0x1E, 0x18, 0xE2, 0x1C, 0x91, 0x45
+  },
+  {
+    0xED, 0x14, 0x41, 0x3B, 0x40, 0xDA, 0x68, 0x9F,
+    0x1F, 0x7F, 0xED, 0x2B, 0x08, 0xDF, 0xF4, 0x5B,
+    0x80, 0x92, 0xDB, 0x5E, 0xC2, 0xC3, 0x61, 0x0E,
+    0x02, 0x72, 0x4D, 0x20, 0x2F, 0x42, 0x3C, 0x46
+  },
+  {
+    0x9B, 0x8A, 0x52, 0x7B, 0x52, 0x72, 0x25, 0x0A,
+    0x1E, 0xC3, 0x97, 0x38, 0x8F, 0x04, 0x09, 0x14,
+    0x95, 0x48, 0x06, 0xE7, 0x94, 0xDB, 0x04, 0xB7,
+    0x0A, 0x46, 0x11, 0xBC, 0x59, 0x58, 0x6A, 0x83
+  },
+  {
+    0x2B, 0xB6, 0x33, 0x37, 0x29, 0x00, 0x0B, 0xE3,
+    0xD5, 0xA2, 0x1B, 0x98, 0xF8, 0xE7, 0xEA, 0xD0,
+    0x77, 0xF1, 0x51, 0xA5, 0x39, 0x39, 0x19, 0xEB,
+    0x67, 0xC8, 0x76, 0xEE, 0x00, 0xBB, 0xBB, 0x04
+  },
+  {
+    0x63, 0xC0, 0x14, 0x08, 0x15, 0x4A, 0xD1, 0x9D,
+    0x7F, 0xB7, 0x39, 0xF3, 0x11, 0x78, 0x17, 0x80,
+    0x46, 0x2C, 0xF2, 0xEE, 0xCC, 0xE6, 0x0F, 0x06,
+    0x4E, 0x85, 0x34, 0x87, 0xC2, 0x72, 0xE3, 0xEB
+  },
+  {
+    0x3D, 0x05, 0x1A, 0x11, 0x76, 0x01, 0x9C, 0xA3,
+    0x7B, 0xF3, 0x3D, 0x60, 0x42, 0x7F, 0x8D, 0x9D,
+    0x1C, 0x3A, 0xBD, 0x59, 0x82, 0x97, 0xCF, 0xB4,
+    0x23, 0x5F, 0x74, 0x7D, 0x7C, 0x7C, 0x7F, 0xEC
+  },
+  {
+    0x39, 0x1E, 0xA9, 0x12, 0xDF, 0x4D, 0x4D, 0x79,
+    0xA4, 0x64, 0x6D, 0x9D, 0xA2, 0x54, 0x9A, 0x44,
+    0x6D, 0x22, 0x40, 0xF6, 0x24, 0x15, 0xD0, 0x70,
+    0xA2, 0xE0, 0x93, 0x99, 0x2B, 0x47, 0x1F, 0xBA
+  },
+  {
+    0x32, 0x46, 0x40, 0x44, 0x0E, 0xA5, 0xC3, 0x08,
+    0x2D, 0xDC, 0x30, 0x9E, 0x78, 0x09, 0xD7, 0x41,
+    0xD6, 0xCC, 0x1B, 0x2D, 0x49, 0x0F, 0xF8, 0xC0,
+    0x52, 0x12, 0x8A, 0x6E, 0xEB, 0x40, 0x9D, 0x62
+  },
+  {
+    0xAB, 0x85, 0x5E, 0x6F, 0xA3, 0x9A, 0x5E, 0x8F,
+    0xC9, 0x0E, 0xAC, 0xB9, 0x99, 0xC7, 0xF7, 0x8A,
+    0xE7, 0x1E, 0x59, 0xC3, 0xD9, 0x7D, 0x60, 0xAF,
+    0xE5, 0x17, 0xD5, 0x87, 0x92, 0x3B, 0x77, 0x11
+  },
+  {
+    0x2A, 0x39, 0xDA, 0x45, 0x86, 0xEF, 0xC4, 0x77,
+    0x85, 0xA7, 0xA8, 0xDA, 0x85, 0x68, 0x3A, 0x51,
+    0x72, 0x4C, 0xDE, 0xF5, 0x41, 0x3B, 0x35, 0x6D,
+    0xC4, 0xFB, 0x50, 0x05, 0x13, 0xF8, 0xFA, 0x2E
+  },
+  {
+    0x8A, 0x00, 0x57, 0xC1, 0xF7, 0x8A, 0xD6, 0x21,
+    0x45, 0x55, 0xC0, 0x67, 0x07, 0x33, 0xE2, 0x9A,
+    0x4C, 0x7E, 0x95, 0x62, 0x27, 0x66, 0x0E, 0xFE,
+    0xB1, 0xD7, 0xFC, 0x79, 0xF5, 0x8E, 0xC6, 0xF2
+  },
+  {
+    0x07, 0x64, 0xB0, 0x01, 0x7F, 0x5B, 0xD9, 0x51,
+    0xF0, 0x1D, 0x9F, 0xDF, 0x95, 0xC0, 0xCB, 0x41,
+    0x38, 0x98, 0x5D, 0x84, 0x79, 0x9C, 0xD4, 0x29,
+    0x84, 0xE2, 0x5B, 0x51, 0x28, 0x00, 0xE7, 0x3C
+  },
+  {
+    0xCC, 0x02, 0x49, 0x56, 0x93, 0xC8, 0xE1, 0x84,
+    0xAD, 0x2E, 0xD0, 0x9D, 0x53, 0x3D, 0xC3, 0x3B,
+    0x76, 0xA7, 0x78, 0x3D, 0x62, 0x07, 0xFC, 0xAC,
+    0xCB, 0x64, 0xF3, 0xED, 0x2C, 0x6D, 0x66, 0xE0
+  },
+  {
+    0xC0, 0xDF, 0x49, 0xC2, 0x06, 0xA3, 0x42, 0x88,
+    0x14, 0x32, 0x16, 0x84, 0x7D, 0xF3, 0x34, 0xD4,
+    0x56, 0x9D, 0xAD, 0x73, 0xC2, 0xB1, 0xFF, 0x62,
+    0x84, 0x88, 0x4F, 0xD3, 0x89, 0x41, 0xFB, 0x95
+  },
+  {
+    0xB9, 0x19, 0x45, 0x19, 0xE4, 0x97, 0x8A, 0x9D,
+    0xC8, 0x93, 0xB2, 0x8B, 0xD8, 0x08, 0xCD, 0xFA,
+    0xBB, 0x1B, 0xD5, 0x10, 0xD8, 0x62, 0xB3, 0x17,
+    0x1F, 0xF6, 0xE0, 0x17, 0xA4, 0x1B, 0x80, 0x4C
+  },
+  {
+    0xBB, 0xA9, 0x27, 0xAC, 0xF1, 0x1B, 0xEB, 0xD3,
+    0x62, 0xA3, 0xA3, 0xEB, 0x78, 0xC4, 0xBB, 0x65,
+    0xE6, 0x02, 0xA8, 0x70, 0x9F, 0xCE, 0xF3, 0x8D,
+    0xC6, 0xC8, 0xB7, 0xBD, 0xA6, 0x64, 0xC3, 0x2C
+  },
+  {
+    0xEC, 0xB4, 0x90, 0x0A, 0x63, 0x92, 0x4E, 0x72,
+    0x0D, 0x40, 0xF2, 0xD2, 0xB1, 0x4D, 0x1B, 0xB3,
+    0x9C, 0x37, 0x01, 0xAD, 0x73, 0x46, 0xBD, 0x0B,
+    0x67, 0x23, 0x42, 0x70, 0xBF, 0xBE, 0x7E, 0x70
+  },
+  {
+    0xF8, 0x31, 0x5A, 0x21, 0xB2, 0x5E, 0x6B, 0xA8,
+    0xBF, 0x59, 0xB1, 0x7B, 0x05, 0x91, 0x3B, 0x8C,
+    0xA4, 0x65, 0x9F, 0x1C, 0xD8, 0x38, 0xFC, 0xC7,
+    0x73, 0xC9, 0xEB, 0x12, 0xE7, 0x00, 0x4E, 0x09
+  },
+  {
+    0x4B, 0x77, 0xAF, 0x67, 0xA9, 0x23, 0x2B, 0xF1,
+    0x18, 0x4E, 0x57, 0x81, 0x82, 0x94, 0x03, 0x1E,
+    0x55, 0xF1, 0xF8, 0x53, 0xC9, 0x4D, 0xBA, 0xB5,
+    0x57, 0x75, 0x47, 0x33, 0x0D, 0x65, 0xAA, 0x61
+  },
+  {
+    0x76, 0x85, 0x68, 0x39, 0x0F, 0xD2, 0xB8, 0x70,
+    0x94, 0x11, 0x4E, 0xD4, 0xCF, 0x72, 0x3E, 0xA3,
+    0x20, 0xFE, 0x97, 0x7B, 0x53, 0x18, 0x03, 0x05,
+    0xC3, 0x84, 0x33, 0x54, 0x79, 0xF0, 0xB5, 0x9B
+  },
+  {
+    0xA4, 0x31, 0xCB, 0x27, 0x0F, 0x3E, 0x2C, 0x9B,
+    0x7A, 0x95, 0x93, 0xB1, 0x55, 0xCC, 0xEC, 0xFF,
+    0x5B, 0x5C, 0x4A, 0x2D, 0xCD, 0x5D, 0x6B, 0xB1,
+    0xC4, 0x85, 0xAA, 0x28, 0x69, 0x97, 0xF9, 0x15
+  },
+  {
+    0xD6, 0x91, 0xFA, 0x6A, 0x79, 0x0B, 0x1A, 0x51,
+    0x79, 0x80, 0x08, 0x7F, 0x50, 0xB0, 0x3D, 0xED,
+    0x8C, 0x6E, 0xD4, 0x86, 0xD0, 0x84, 0x22, 0x1C,
+    0x82, 0x7D, 0x9B, 0xD9, 0x22, 0xBE, 0xB8, 0xC0
+  },
+  {
+    0x8F, 0x97, 0x8A, 0x49, 0x32, 0xF4, 0x45, 0x98,
+    0x13, 0xE8, 0xFE, 0x15, 0x68, 0x6E, 0x4E, 0xFA,
+    0x25, 0xC2, 0xC5, 0xFF, 0x5A, 0x3A, 0x4F, 0x8C,
+    0x9B, 0x14, 0x96, 0x5D, 0x2F, 0x0B, 0xE4, 0x61
+  },
+  {
+    0x1E, 0xFB, 0xD0, 0xC1, 0x31, 0x44, 0x91, 0x42,
+    0xF2, 0x29, 0x5F, 0x2D, 0x42, 0x41, 0x1D, 0xFE,
+    0x0F, 0x48, 0xD4, 0xAC, 0xAE, 0x76, 0x2D, 0x8D,
+    0xF6, 0x7A, 0x57, 0x0B, 0xF7, 0xB1, 0xDC, 0xD5
+  },
+  {
+    0xD5, 0x3B, 0xA9, 0x33, 0x46, 0x14, 0x3A, 0xB8,
+    0xE0, 0xD3, 0xD1, 0xBF, 0x27, 0x27, 0x06, 0xD1,
+    0x69, 0xE6, 0x6C, 0x69, 0xC7, 0xB8, 0xF4, 0xA5,
+    0xE8, 0x2F, 0xEF, 0x44, 0x07, 0x02, 0xBC, 0xF2
+  },
+  {
+    0xF7, 0x1A, 0x3E, 0xC0, 0x1A, 0xA3, 0x82, 0xEA,
+    0x76, 0x99, 0x2B, 0x43, 0x0A, 0x7F, 0x42, 0xC7,
+    0xAD, 0x2A, 0x86, 0xAE, 0xA9, 0xC1, 0x9E, 0x76,
+    0xCD, 0x17, 0x32, 0xEC, 0x68, 0x30, 0xDE, 0x6F
+  },
+  {
+    0x80, 0xA6, 0xAB, 0x7B, 0x71, 0x04, 0x64, 0xF9,
+    0x3E, 0x6C, 0xBA, 0x96, 0x86, 0x4A, 0xA6, 0x40,
+    0x9B, 0xCA, 0xFC, 0x1B, 0xF4, 0xB3, 0x2A, 0x30,
+    0x93, 0x72, 0xE8, 0x57, 0xE8, 0x04, 0x06, 0x8C
+  },
+  {
+    0xDB, 0xDE, 0x81, 0xE5, 0x1A, 0x52, 0x17, 0x4B,
+    0x10, 0x14, 0x90, 0x1B, 0x53, 0xBE, 0xF8, 0x8D,
+    0xE9, 0x3B, 0x29, 0xE2, 0x74, 0x34, 0x7E, 0x8E,
+    0x9A, 0x7B, 0x03, 0x74, 0x56, 0x62, 0x9F, 0x35
+  },
+  {
+    0x75, 0xF2, 0x74, 0x46, 0x6B, 0x1A, 0x2D, 0x0F,
+    0xD8, 0x45, 0xBB, 0xB5, 0x7C, 0x38, 0xC9, 0x89,
+    0x51, 0x6E, 0x15, 0x68, 0x32, 0x0A, 0xB5, 0x17,
+    0xB1, 0x63, 0xEA, 0xF7, 0x09, 0x23, 0x4C, 0xC7
+  },
+  {
+    0xAF, 0xE1, 0xA0, 0x59, 0x1C, 0x49, 0x1D, 0x41,
+    0x6E, 0xB6, 0x4F, 0x62, 0x86, 0xF3, 0xBA, 0x29,
+    0xD4, 0xC9, 0x99, 0x82, 0x14, 0xA3, 0x83, 0x1C,
+    0x39, 0x01, 0x4A, 0xC0, 0x30, 0x55, 0x79, 0x45
+  },
+  {
+    0x67, 0xFF, 0x6A, 0xCD, 0xBE, 0x8A, 0x99, 0xA1,
+    0x66, 0xA5, 0xD9, 0xCF, 0x32, 0x13, 0x65, 0x06,
+    0xB5, 0x48, 0xD6, 0xC9, 0x47, 0xC2, 0x4C, 0x69,
+    0x9C, 0xEA, 0x3A, 0xFD, 0x92, 0xAD, 0xFA, 0xCA
+  },
+  {
+    0xBF, 0xB4, 0xD0, 0xC7, 0x11, 0x20, 0x75, 0x26,
+    0x2C, 0x2D, 0xD2, 0x48, 0xF3, 0x34, 0xB2, 0xEF,
+    0x15, 0x40, 0x08, 0x7E, 0xCC, 0x73, 0x82, 0xBC,
+    0x2A, 0x27, 0x25, 0x75, 0xC5, 0x00, 0x9F, 0x70
+  },
+  {
+    0x17, 0xC9, 0x4B, 0x9C, 0x53, 0x72, 0x43, 0xF2,
+    0x33, 0x5B, 0x86, 0x39, 0x49, 0xB2, 0xB9, 0x1C,
+    0x98, 0xA6, 0x95, 0x6D, 0x7C, 0x10, 0xAA, 0x98,
+    0x99, 0x59, 0xA8, 0x0F, 0x91, 0x0C, 0x25, 0x22
+  },
+  {
+    0xF6, 0x33, 0x8F, 0x43, 0x4D, 0x31, 0x94, 0x10,
+    0x19, 0x6D, 0x95, 0x19, 0xAB, 0xCA, 0xEF, 0xF7,
+    0xD5, 0x54, 0x39, 0xFD, 0x2A, 0xA5, 0xBA, 0xBF,
+    0x7A, 0x7E, 0x79, 0x13, 0xB2, 0x94, 0xED, 0x4D
+  },
+  {
+    0x08, 0xEF, 0x7D, 0x65, 0xF9, 0xBB, 0xF3, 0xDA,
+    0x1F, 0x78, 0x84, 0xAE, 0x9B, 0x75, 0x90, 0x1F,
+    0xD8, 0x52, 0x95, 0x66, 0x2A, 0x6E, 0xA7, 0x1D,
+    0xE0, 0x8B, 0xEE, 0x38, 0x34, 0x57, 0x62, 0x78
+  },
+  {
+    0x16, 0x47, 0xEC, 0xC2, 0xBA, 0x13, 0xF8, 0xB9,
+    0x3B, 0x2F, 0xBC, 0xDC, 0x4E, 0x8F, 0x1D, 0xFA,
+    0x47, 0xFE, 0x3B, 0xE1, 0x2A, 0xAA, 0x0E, 0x45,
+    0x9B, 0x0E, 0x5A, 0x87, 0xF3, 0xA6, 0x9B, 0xB0
+  },
+  {
+    0xFF, 0x92, 0x7A, 0x71, 0x78, 0x81, 0xF6, 0xFD,
+    0x8E, 0xD8, 0xBF, 0x5D, 0x5E, 0x35, 0xBD, 0x80,
+    0x16, 0x15, 0x73, 0xE5, 0x82, 0x94, 0x04, 0xC3,
+    0x2D, 0x2A, 0x27, 0x6A, 0x01, 0xF4, 0xB9, 0x06
+  },
+  {
+    0xC8, 0xCA, 0xF1, 0x36, 0xFF, 0x20, 0x9C, 0x82,
+    0xE0, 0x24, 0x0C, 0x1E, 0x62, 0xA3, 0xBC, 0x7E,
+    0x9C, 0xAC, 0x87, 0x3B, 0x01, 0x1C, 0xF7, 0xC5,
+    0xE6, 0x7E, 0xC1, 0x87, 0xA5, 0xFB, 0xCD, 0x96
+  },
+  {
+    0xD9, 0xAC, 0xC7, 0x3E, 0x3F, 0x42, 0x1E, 0x18,
+    0x83, 0xB5, 0xED, 0x53, 0xD8, 0x2A, 0x9A, 0xEC,
+    0x8F, 0x5D, 0xC9, 0x80, 0xC4, 0x2B, 0xCA, 0xEB,
+    0x0E, 0x7D, 0x89, 0x76, 0xA3, 0x38, 0xEF, 0x51
+  },
+  {
+    0x9F, 0x17, 0x3F, 0xCF, 0x08, 0xA5, 0x36, 0x21,
+    0x93, 0xF3, 0x52, 0xC8, 0x25, 0x6A, 0xE5, 0x34,
+    0xAE, 0x9C, 0xE7, 0xBF, 0xA4, 0xBC, 0x09, 0xFA,
+    0xC9, 0x00, 0x98, 0xF9, 0x8A, 0x71, 0x62, 0x94
+  },
+  {
+    0x0A, 0x72, 0x45, 0x79, 0xDC, 0x80, 0xBC, 0x0C,
+    0x90, 0x04, 0xE5, 0x1B, 0xE7, 0xEF, 0xF3, 0xAF,
+    0xA5, 0x30, 0x75, 0xAB, 0x4A, 0x32, 0x55, 0x77,
+    0x33, 0x58, 0x6E, 0x82, 0x0F, 0xD3, 0x64, 0x23
+  },
+  {
+    0x38, 0xF7, 0xC3, 0x40, 0xF4, 0xB1, 0x59, 0xB1,
+    0xE5, 0x94, 0xF6, 0xEB, 0x83, 0x28, 0x49, 0x17,
+    0xB7, 0xAA, 0x19, 0xC7, 0x4F, 0x57, 0x11, 0x7A,
+    0x4E, 0x08, 0xCF, 0x7C, 0x4E, 0x32, 0xA2, 0x3C
+  },
+  {
+    0x1C, 0x67, 0x4B, 0xE2, 0x57, 0xE9, 0xB3, 0x31,
+    0x34, 0xD4, 0x16, 0x8F, 0x15, 0x2F, 0x8B, 0x63,
+    0xDF, 0xD7, 0x80, 0xC9, 0x7D, 0xC4, 0xDC, 0x37,
+    0xAC, 0x26, 0xCC, 0x0A, 0xEF, 0xB7, 0x9C, 0x1A
+  },
+  {
+    0x2F, 0x0C, 0x59, 0x76, 0x16, 0xD5, 0x75, 0x17,
+    0x14, 0xA5, 0xFB, 0x4E, 0xBF, 0x3C, 0x48, 0x1A,
+    0x96, 0xC3, 0xAD, 0x14, 0x5E, 0xBD, 0xE0, 0x65,
+    0x09, 0xF3, 0xA2, 0xE5, 0xF2, 0xC1, 0x3F, 0xC8
+  },
+  {
+    0xFD, 0xDC, 0x69, 0xE0, 0xC9, 0x83, 0xCD, 0x82,
+    0x83, 0xED, 0x81, 0x88, 0xBE, 0xC4, 0xE5, 0xF4,
+    0x1D, 0xEA, 0x3D, 0x01, 0xB9, 0xE7, 0x4C, 0x4B,
+    0xAF, 0x73, 0x41, 0xD8, 0xB4, 0xBF, 0x55, 0x3D
+  },
+  {
+    0x24, 0xD0, 0x83, 0xCB, 0xA0, 0x38, 0xC8, 0x7E,
+    0x9A, 0xCB, 0x86, 0x81, 0x82, 0x02, 0x08, 0xB7,
+    0x5C, 0xB3, 0x29, 0x3A, 0x96, 0xC9, 0xEF, 0xA7,
+    0x5D, 0x2C, 0x63, 0xF1, 0x6B, 0x85, 0xFE, 0x1E
+  },
+  {
+    0x7F, 0x6A, 0x64, 0x9C, 0xCA, 0x89, 0xB2, 0x53,
+    0xFF, 0xBD, 0x20, 0xC0, 0x16, 0x98, 0x01, 0x00,
+    0xA8, 0x7C, 0x16, 0x81, 0x09, 0x62, 0x8F, 0xCC,
+    0x66, 0x52, 0x5D, 0x8B, 0xAA, 0xFE, 0x50, 0x5F
+  },
+  {
+    0x6D, 0xA3, 0x73, 0xB4, 0xC1, 0x87, 0x92, 0xB3,
+    0x20, 0x9A, 0xDD, 0x15, 0xA5, 0x07, 0x4A, 0x1D,
+    0x70, 0xC1, 0x0B, 0xB3, 0x94, 0x80, 0xCA, 0x3F,
+    0xE5, 0xC4, 0x39, 0xD9, 0x5F, 0xC2, 0x86, 0xCA
+  },
+  {
+    0x27, 0x0A, 0xFF, 0xA6, 0x42, 0x6F, 0x1A, 0x51,
+    0x5C, 0x9B, 0x76, 0xDF, 0xC2, 0x7D, 0x18, 0x1F,
+    0xC2, 0xFD, 0x57, 0xD0, 0x82, 0xA3, 0xBA, 0x2C,
+    0x1E, 0xEF, 0x07, 0x15, 0x33, 0xA6, 0xDF, 0xB7
+  },
+  {
+    0xC2, 0x2E, 0x15, 0xCF, 0xC5, 0xA3, 0xD1, 0x4B,
+    0x64, 0xD1, 0x31, 0xF3, 0x5F, 0xB3, 0x5D, 0xD5,
+    0xE6, 0xC5, 0x7D, 0xC4, 0xAF, 0xC5, 0x52, 0x27,
+    0x75, 0x01, 0xEC, 0xA7, 0x64, 0xDA, 0x74, 0xBF
+  },
+  {
+    0xAD, 0x68, 0x3E, 0x96, 0xB8, 0xAC, 0x65, 0x8C,
+    0x4F, 0x3F, 0x10, 0xAD, 0x22, 0xD9, 0x9B, 0x07,
+    0xCB, 0x5E, 0xF9, 0xE3, 0x1C, 0xBE, 0x11, 0xE7,
+    0xF7, 0xDC, 0x29, 0xF2, 0xAE, 0xE5, 0x02, 0x4C
+  },
+  {
+    0x78, 0xD3, 0xCE, 0xDA, 0x1C, 0xE0, 0x52, 0x93,
+    0xF4, 0x30, 0xF6, 0x16, 0x7B, 0x33, 0xC9, 0x9F,
+    0x0B, 0x1D, 0x6D, 0xAD, 0xE5, 0x21, 0x43, 0xC2,
+    0x92, 0x55, 0x77, 0xC0, 0xBA, 0x82, 0x53, 0xEB
+  },
+  {
+    0xE0, 0x06, 0x45, 0x63, 0x44, 0xF9, 0x0F, 0x50,
+    0x1C, 0x25, 0x81, 0x3F, 0x9B, 0xE2, 0xA3, 0xF4,
+    0x0B, 0x98, 0x74, 0xFA, 0x05, 0x63, 0x98, 0x1C,
+    0xD4, 0x56, 0xEE, 0x8D, 0x44, 0x80, 0x7C, 0x93
+  },
+  {
+    0x39, 0x08, 0xE8, 0xD5, 0x47, 0xC0, 0xAF, 0xB1,
+    0x13, 0x49, 0x49, 0x46, 0x63, 0x04, 0xA1, 0x45,
+    0x02, 0x7E, 0x6B, 0xB7, 0xA7, 0x4D, 0xD1, 0xC1,
+    0x62, 0xCD, 0xF0, 0xBC, 0xF7, 0x72, 0x37, 0xE8
+  },
+  {
+    0x1B, 0x6C, 0x87, 0xA3, 0x48, 0x38, 0xC7, 0xCD,
+    0x5F, 0xD0, 0x89, 0x14, 0x22, 0x4E, 0x90, 0xC2,
+    0x2A, 0xBF, 0x5A, 0x97, 0xB1, 0x06, 0x46, 0xD9,
+    0x8C, 0x49, 0x16, 0xD3, 0xA8, 0x93, 0x9E, 0x62
+  },
+  {
+    0xB0, 0xD3, 0x8F, 0x82, 0xF2, 0x48, 0x91, 0x69,
+    0x52, 0xB3, 0x16, 0xB6, 0xD3, 0x6D, 0x9E, 0x02,
+    0x2D, 0xF6, 0xEE, 0xCC, 0x26, 0xC7, 0x62, 0xA6,
+    0x55, 0xCF, 0x5F, 0x0A, 0xE6, 0x49, 0xE2, 0xBD
+  },
+  {
+    0x8D, 0x66, 0xFC, 0x9C, 0xED, 0xA5, 0xED, 0xDF,
+    0xB1, 0xE0, 0x4D, 0x09, 0x6C, 0xA7, 0x0E, 0xF5,
+    0x06, 0x50, 0xFB, 0x87, 0xCC, 0x6A, 0x9F, 0xFB,
+    0xB3, 0xD2, 0x0B, 0xCE, 0x7B, 0x5A, 0x60, 0x74
+  },
+  {
+    0x06, 0x43, 0x54, 0xE8, 0xE1, 0x1C, 0xF7, 0x13,
+    0xB2, 0xC7, 0x2B, 0xA6, 0x7A, 0xC7, 0xD7, 0x6E,
+    0x41, 0xBA, 0x61, 0xDB, 0x9C, 0x2D, 0xEA, 0x52,
+    0x2E, 0x0B, 0xDA, 0x17, 0xCB, 0xA5, 0xE3, 0x92
+  },
+  {
+    0xC8, 0xEF, 0x5F, 0x49, 0x8B, 0xD1, 0xBC, 0x70,
+    0x7F, 0xBC, 0x7B, 0x5C, 0xBC, 0x2D, 0xFF, 0x04,
+    0x93, 0x14, 0x4A, 0xC5, 0x27, 0x86, 0xDB, 0x3C,
+    0x79, 0x3E, 0xF4, 0xAE, 0x8A, 0x83, 0x88, 0x47
+  },
+  {
+    0x8A, 0x23, 0x97, 0xDF, 0x31, 0xE7, 0xF0, 0xCC,
+    0x29, 0x0D, 0xA9, 0xA8, 0xBB, 0xE4, 0xF5, 0xF7,
+    0xA3, 0xA1, 0x37, 0x50, 0x73, 0x0D, 0xB6, 0x2D,
+    0xC2, 0x54, 0x0F, 0xDB, 0xD6, 0x18, 0x85, 0x89
+  },
+  {
+    0xF1, 0x2D, 0x0B, 0x13, 0xC6, 0xAD, 0xFB, 0x3B,
+    0xE5, 0x0A, 0x51, 0xEB, 0x6B, 0xAF, 0x65, 0xAB,
+    0xFB, 0x17, 0x00, 0xBA, 0xA8, 0x7E, 0x52, 0x7D,
+    0xBE, 0x3E, 0x67, 0x5A, 0x7A, 0x99, 0x46, 0x61
+  },
+  {
+    0x10, 0x24, 0xC9, 0x40, 0xBE, 0x73, 0x41, 0x44,
+    0x9B, 0x50, 0x10, 0x52, 0x2B, 0x50, 0x9F, 0x65,
+    0xBB, 0xDC, 0x12, 0x87, 0xB4, 0x55, 0xC2, 0xBB,
+    0x7F, 0x72, 0xB2, 0xC9, 0x2F, 0xD0, 0xD1, 0x89
+  },
+  {
+    0x52, 0x60, 0x3B, 0x6C, 0xBF, 0xAD, 0x49, 0x66,
+    0xCB, 0x04, 0x4C, 0xB2, 0x67, 0x56, 0x83, 0x85,
+    0xCF, 0x35, 0xF2, 0x1E, 0x6C, 0x45, 0xCF, 0x30,
+    0xAE, 0xD1, 0x98, 0x32, 0xCB, 0x51, 0xE9, 0xF5
+  },
+  {
+    0xFF, 0xF2, 0x4D, 0x3C, 0xC7, 0x29, 0xD3, 0x95,
+    0xDA, 0xF9, 0x78, 0xB0, 0x15, 0x73, 0x06, 0xCB,
+    0x49, 0x57, 0x97, 0xE6, 0xC8, 0xDC, 0xA1, 0x73,
+    0x1D, 0x2F, 0x6F, 0x81, 0xB8, 0x49, 0xBA, 0xAE
+  },
+  {
+    0x41, 0xEE, 0xE9, 0x0D, 0x47, 0xEC, 0x27, 0x72,
+    0xCD, 0x35, 0x2D, 0xFD, 0x67, 0xE0, 0x60, 0x5F,
+    0xBD, 0xFC, 0x5F, 0xD6, 0xD8, 0x26, 0x45, 0x1E,
+    0x3D, 0x06, 0x4D, 0x38, 0x28, 0xBD, 0x3B, 0xAE
+  },
+  {
+    0x30, 0x0B, 0x6B, 0x36, 0xE5, 0x9F, 0x85, 0x1D,
+    0xDD, 0xC2, 0x9B, 0xFA, 0x93, 0x08, 0x25, 0x20,
+    0xCD, 0x77, 0xC5, 0x1E, 0x00, 0x7E, 0x00, 0xD2,
+    0xD7, 0x8B, 0x26, 0xF4, 0xAF, 0x96, 0x15, 0x32
+  },
+  {
+    0x9E, 0xF3, 0x03, 0x14, 0x83, 0x4E, 0x40, 0x1C,
+    0x87, 0x1A, 0x20, 0x04, 0xE3, 0x8D, 0x5C, 0xE3,
+    0x2E, 0xD2, 0x8E, 0x11, 0x37, 0xF1, 0x97, 0x0F,
+    0x4F, 0x43, 0x78, 0xC7, 0x37, 0x06, 0x76, 0x3D
+  },
+  {
+    0x3F, 0xBD, 0xCD, 0xE7, 0xB6, 0x43, 0x04, 0x02,
+    0x5E, 0xC0, 0x58, 0x26, 0x09, 0x03, 0x1E, 0xC2,
+    0x66, 0xD5, 0x0F, 0x56, 0x83, 0x5A, 0xE0, 0xCB,
+    0x72, 0xD8, 0xCD, 0xB4, 0xCF, 0xAF, 0x44, 0x19
+  },
+  {
+    0xE9, 0x0E, 0xAD, 0x3B, 0x98, 0x2B, 0x43, 0x5B,
+    0x66, 0x36, 0x6A, 0x49, 0x6C, 0x3F, 0x8A, 0xE6,
+    0x5B, 0x17, 0x61, 0x37, 0x00, 0xF5, 0x47, 0x67,
+    0x3F, 0x62, 0x15, 0x35, 0x41, 0x91, 0x28, 0x64
+  },
+  {
+    0xAB, 0xE3, 0x54, 0x7B, 0x33, 0x6D, 0x6E, 0x24,
+    0x0D, 0x7F, 0xE6, 0x82, 0xD7, 0x4B, 0x9C, 0xC7,
+    0xE8, 0xD7, 0xF9, 0xB5, 0x66, 0x48, 0x58, 0xB9,
+    0x4D, 0xF5, 0x9E, 0x9F, 0xC3, 0x30, 0xD9, 0xE5
+  },
+  {
+    0xB2, 0x99, 0x64, 0x20, 0x95, 0xB8, 0x28, 0x6C,
+    0x52, 0x1C, 0xDB, 0x21, 0xED, 0x0F, 0xE0, 0x57,
+    0x27, 0x80, 0x21, 0xBB, 0x40, 0x38, 0xEB, 0x5A,
+    0x3D, 0x79, 0x54, 0x2F, 0x5D, 0x75, 0x1F, 0x54
+  },
+  {
+    0xE4, 0xD7, 0x58, 0x35, 0x9F, 0x08, 0x67, 0x93,
+    0xA8, 0x37, 0x54, 0xAC, 0xA6, 0x96, 0x8C, 0x3E,
+    0x9F, 0xD9, 0x4B, 0x40, 0x49, 0x7F, 0x2E, 0xC2,
+    0x24, 0xA2, 0x91, 0x60, 0x63, 0xA2, 0x14, 0xA3
+  },
+  {
+    0x59, 0xA3, 0x04, 0xFC, 0x03, 0xAB, 0x75, 0xD5,
+    0x57, 0xDB, 0x04, 0xEB, 0xD0, 0x2D, 0xD4, 0xC6,
+    0xB8, 0x10, 0xA1, 0x38, 0xBB, 0xFE, 0xEA, 0x5D,
+    0xFC, 0xEE, 0xAA, 0x2B, 0x75, 0xB0, 0x64, 0x91
+  },
+  {
+    0x39, 0x95, 0x10, 0x22, 0x15, 0xF5, 0xFE, 0x92,
+    0x10, 0xEB, 0x30, 0xD9, 0x52, 0xD8, 0xC9, 0x19,
+    0x58, 0x9E, 0x71, 0x45, 0xFC, 0xD4, 0x95, 0xEA,
+    0x78, 0xD0, 0x2B, 0x9C, 0x14, 0x8F, 0xAF, 0x09
+  },
+  {
+    0x47, 0x2E, 0xE7, 0x11, 0x56, 0x35, 0x06, 0xA5,
+    0xF0, 0x08, 0x3F, 0xE8, 0x2B, 0x08, 0xB9, 0x92,
+    0x3C, 0xF6, 0xC8, 0x40, 0x4D, 0x0C, 0xBA, 0xCB,
+    0xF8, 0x48, 0x64, 0xF6, 0x48, 0x54, 0x2A, 0xC0
+  },
+  {
+    0x68, 0xFD, 0xB8, 0x2A, 0xDA, 0xE7, 0x9B, 0xEF,
+    0x59, 0x0A, 0xBA, 0x62, 0xD7, 0xAC, 0x55, 0x32,
+    0x12, 0x06, 0x1C, 0x36, 0xE3, 0x6F, 0x12, 0xC0,
+    0xEF, 0xA2, 0x9A, 0x17, 0x62, 0xDE, 0x3B, 0x6A
+  },
+  {
+    0x75, 0x85, 0xC0, 0x77, 0x33, 0x83, 0xF1, 0x74,
+    0xFD, 0x66, 0x65, 0x49, 0xA8, 0x35, 0x2B, 0x30,
+    0x5B, 0xF6, 0x85, 0x5B, 0xC9, 0x8B, 0xEA, 0x28,
+    0xC3, 0x91, 0xB3, 0xC0, 0x34, 0xDA, 0x5A, 0x5A
+  },
+  {
+    0xAC, 0xC5, 0x75, 0xFE, 0x2C, 0xD7, 0xBA, 0x2A,
+    0x31, 0xFC, 0x7D, 0x67, 0x0A, 0x92, 0x34, 0xAF,
+    0x68, 0x50, 0x33, 0x86, 0xE9, 0x59, 0x07, 0x3D,
+    0x16, 0xA8, 0x1B, 0x33, 0xB9, 0x22, 0xB5, 0x0E
+  },
+  {
+    0x9E, 0xC7, 0xD2, 0x99, 0x59, 0x43, 0xD3, 0x9D,
+    0x6B, 0x97, 0x14, 0x93, 0xB8, 0x97, 0xA0, 0xEE,
+    0x2D, 0x33, 0x92, 0xA7, 0x2D, 0xB8, 0x75, 0xC2,
+    0x40, 0x5D, 0x35, 0x71, 0x78, 0xFB, 0x69, 0x11
+  },
+  {
+    0x2D, 0x7E, 0xF1, 0x94, 0x01, 0x42, 0x5A, 0xBA,
+    0x45, 0x0E, 0x82, 0xD3, 0x6D, 0x0F, 0xE7, 0xB2,
+    0x08, 0x5E, 0xA0, 0xAF, 0x60, 0x45, 0xA5, 0x99,
+    0x4C, 0xF4, 0x31, 0xEA, 0x59, 0x93, 0x9C, 0xC9
+  },
+  {
+    0xF3, 0x2F, 0xD8, 0x55, 0xF0, 0x11, 0xC7, 0x18,
+    0x02, 0x7F, 0x2E, 0xBE, 0x37, 0x7D, 0x69, 0x39,
+    0xF1, 0x23, 0x70, 0xCA, 0xFF, 0x15, 0x1C, 0x1E,
+    0x5A, 0xCE, 0x43, 0x8D, 0x70, 0x3C, 0x6D, 0x9F
+  },
+  {
+    0xB2, 0xBD, 0x83, 0xD2, 0x31, 0x0D, 0x3D, 0x7B,
+    0x1D, 0x2D, 0x5A, 0xAF, 0x43, 0x59, 0xFA, 0xE2,
+    0x86, 0x12, 0x96, 0x27, 0x19, 0xFD, 0xDE, 0x4D,
+    0xDA, 0xF6, 0x9E, 0x78, 0x20, 0xF3, 0x3F, 0x61
+  },
+  {
+    0x1A, 0x7A, 0x9D, 0x0F, 0x44, 0xDD, 0xFA, 0x7F,
+    0xC2, 0xF4, 0x77, 0x0C, 0xAD, 0x74, 0x22, 0xFA,
+    0x6C, 0x4E, 0x37, 0xE6, 0xCB, 0x03, 0x6D, 0x89,
+    0x9E, 0x10, 0x27, 0x50, 0xE5, 0x94, 0xFF, 0xCD
+  },
+  {
+    0xDC, 0x69, 0xF6, 0x14, 0x1C, 0x8E, 0x10, 0x3F,
+    0xF6, 0x1F, 0x62, 0x98, 0xA2, 0xC4, 0x4F, 0x52,
+    0xD1, 0x47, 0x36, 0x6D, 0xDB, 0xD9, 0xC7, 0x9C,
+    0xC3, 0x08, 0xFE, 0x84, 0x33, 0x6A, 0x95, 0x64
+  },
+  {
+    0xE3, 0x4E, 0xD4, 0x17, 0xB0, 0x79, 0x1D, 0x9A,
+    0x77, 0xEE, 0x1E, 0x50, 0xCC, 0x2C, 0x20, 0x7E,
+    0x54, 0x0C, 0x77, 0x14, 0x04, 0x21, 0xC4, 0x6C,
+    0xE0, 0x86, 0x28, 0x78, 0xAA, 0xEB, 0x27, 0x09
+  },
+  {
+    0x21, 0x74, 0x42, 0x5C, 0x8C, 0xCA, 0xE3, 0x98,
+    0xC4, 0xFF, 0x06, 0xF8, 0x48, 0x99, 0x1C, 0x5E,
+    0x9B, 0xC0, 0xF3, 0x46, 0x11, 0x11, 0x70, 0x6F,
+    0xB9, 0x5D, 0x0B, 0xE1, 0xC6, 0x8E, 0x47, 0x60
+  },
+  {
+    0x18, 0x94, 0x58, 0x2A, 0x8A, 0x25, 0xFE, 0x8F,
+    0x84, 0x7A, 0x4A, 0x03, 0x25, 0x74, 0xB7, 0x7B,
+    0x8B, 0x36, 0xBF, 0x19, 0x99, 0x75, 0x26, 0xBB,
+    0x4B, 0xC8, 0x5F, 0x38, 0x24, 0x53, 0x7F, 0xEB
+  },
+  {
+    0x17, 0xED, 0x18, 0x8A, 0xE3, 0xC9, 0x53, 0xD6,
+    0x55, 0x44, 0x59, 0x83, 0xB8, 0x32, 0x5B, 0xAF,
+    0xFF, 0x32, 0xE2, 0x22, 0xB2, 0xDF, 0xEB, 0x16,
+    0xE8, 0x61, 0x7A, 0xBF, 0x86, 0xEE, 0x7C, 0xC5
+  },
+  {
+    0xF1, 0x48, 0x9A, 0xD1, 0xC3, 0x54, 0xCD, 0xE9,
+    0x78, 0x92, 0x37, 0xEA, 0x6D, 0xBF, 0x67, 0xFC,
+    0x1E, 0x44, 0xD1, 0xAC, 0xC8, 0xDC, 0x66, 0xAD,
+    0x83, 0x87, 0x27, 0xF4, 0x7D, 0x9A, 0x91, 0xFE
+  },
+  {
+    0x36, 0x7F, 0x22, 0x16, 0x5B, 0x8B, 0x66, 0xE9,
+    0x7F, 0x66, 0x70, 0xF3, 0x4E, 0xBA, 0x27, 0x49,
+    0xD2, 0x64, 0x3B, 0x21, 0xBE, 0xAD, 0xAD, 0xFE,
+    0xFE, 0xA2, 0x57, 0x4B, 0x7C, 0x9B, 0x21, 0x96
+  },
+  {
+    0x3D, 0x8D, 0xFE, 0xA1, 0x7E, 0xEA, 0x5D, 0x64,
+    0x5A, 0xC1, 0xD4, 0x1A, 0x5B, 0x59, 0x22, 0x6C,
+    0x48, 0x6C, 0x36, 0xBD, 0x77, 0xED, 0x44, 0xBB,
+    0x34, 0x91, 0x70, 0xD0, 0x80, 0xE3, 0x0E, 0x68
+  },
+  {
+    0x41, 0x15, 0xF8, 0x9E, 0x0B, 0x3B, 0x5C, 0x8F,
+    0x61, 0x22, 0xC0, 0x25, 0x00, 0x17, 0x1D, 0xCF,
+    0xFB, 0xCE, 0xA4, 0x66, 0x2A, 0x8C, 0x5F, 0x8C,
+    0x1C, 0x01, 0xA9, 0xCA, 0x7B, 0x10, 0x27, 0xBB
+  },
+  {
+    0xED, 0x6E, 0x91, 0x0B, 0x96, 0x02, 0x55, 0xD7,
+    0xD7, 0x92, 0xEB, 0xE6, 0x7F, 0x26, 0x0A, 0x14,
+    0x3C, 0xFA, 0xC1, 0x05, 0x1D, 0xFC, 0x05, 0x90,
+    0x25, 0xEE, 0x0C, 0x1B, 0xFC, 0xBC, 0x56, 0x81
+  },
+  {
+    0x55, 0x8F, 0xA8, 0xAF, 0xA1, 0x2B, 0xBE, 0xE5,
+    0x4A, 0xF7, 0x8F, 0x6B, 0x74, 0x45, 0xF9, 0x96,
+    0x65, 0xD4, 0xE3, 0x56, 0xBC, 0x07, 0xD3, 0xEF,
+    0xFD, 0x8F, 0xD6, 0x5A, 0xB9, 0xC7, 0x47, 0x16
+  },
+  {
+    0x5B, 0x60, 0x12, 0x76, 0x20, 0x53, 0xB8, 0x73,
+    0x4A, 0xF0, 0xE5, 0x55, 0xE6, 0xA2, 0xBB, 0x4F,
+    0xD4, 0x84, 0x0A, 0xF3, 0xB0, 0x4F, 0xCF, 0x63,
+    0x50, 0xA2, 0xB8, 0xA5, 0x1B, 0x67, 0x96, 0xAD
+  },
+  {
+    0xAB, 0x7A, 0xCC, 0xA5, 0xD7, 0x77, 0x10, 0xBA,
+    0xD3, 0x7B, 0xA0, 0xFF, 0x4C, 0xEA, 0xE2, 0x7E,
+    0x84, 0x71, 0x79, 0xF7, 0xFD, 0x7A, 0xEC, 0x88,
+    0x69, 0xC6, 0x49, 0xB3, 0x3F, 0x8D, 0x25, 0x77
+  },
+  {
+    0xFF, 0x77, 0x30, 0xB4, 0x74, 0xEC, 0x21, 0x45,
+    0xA9, 0x2D, 0xD1, 0xCF, 0xFE, 0x45, 0xC3, 0x42,
+    0xC6, 0xFD, 0x6B, 0xAC, 0x58, 0x0F, 0xF9, 0x5A,
+    0x75, 0xED, 0xA3, 0xBF, 0x90, 0xEB, 0x4F, 0x01
+  },
+  {
+    0xD1, 0x0F, 0x06, 0x1D, 0x5B, 0x9C, 0xB4, 0x4E,
+    0xE0, 0x78, 0xA9, 0x6B, 0x33, 0x18, 0x57, 0x9E,
+    0x5E, 0xF5, 0x0A, 0xEF, 0x3E, 0xD9, 0x6E, 0x4F,
+    0x62, 0x14, 0x9B, 0x2E, 0x9F, 0x7C, 0x66, 0x0C
+  },
+  {
+    0x67, 0xD2, 0x2B, 0x8E, 0xDF, 0x20, 0x01, 0xD8,
+    0x64, 0x22, 0x13, 0x6A, 0xC6, 0x51, 0x6C, 0xF3,
+    0x9F, 0x7F, 0xC6, 0xA7, 0x02, 0x98, 0x92, 0xFD,
+    0x75, 0xC9, 0x87, 0x90, 0x96, 0x4A, 0x72, 0x0B
+  },
+  {
+    0x7A, 0x5E, 0xC5, 0xBA, 0x76, 0x25, 0x9B, 0x07,
+    0xB4, 0xDA, 0x03, 0xF3, 0x81, 0xFE, 0x7B, 0xEA,
+    0x48, 0x65, 0xC8, 0x6C, 0x42, 0x4A, 0xBA, 0xA0,
+    0xDD, 0x1E, 0xCF, 0x74, 0xF8, 0x7D, 0x2A, 0xC0
+  },
+  {
+    0xE0, 0xFF, 0x60, 0xD6, 0x90, 0x29, 0xE6, 0xBD,
+    0x1C, 0x15, 0x95, 0x3E, 0x91, 0x50, 0x9C, 0x0C,
+    0x59, 0xED, 0x5D, 0xA5, 0x00, 0x01, 0x99, 0xF2,
+    0x16, 0xD2, 0x9F, 0x96, 0x07, 0x9C, 0x2F, 0xEF
+  },
+  {
+    0xFC, 0x13, 0xEA, 0xD8, 0x41, 0x01, 0x8F, 0x59,
+    0x90, 0x3B, 0x40, 0xF2, 0x02, 0x0C, 0x66, 0x38,
+    0xA6, 0x6A, 0x54, 0xC3, 0xA3, 0x38, 0x41, 0x4D,
+    0x97, 0xA5, 0xC3, 0x94, 0xF3, 0x26, 0x6F, 0x33
+  },
+  {
+    0x0C, 0x2F, 0x62, 0xB8, 0x98, 0xFB, 0x2F, 0x63,
+    0x61, 0x7E, 0x78, 0x73, 0x45, 0x26, 0x3C, 0xB9,
+    0xCF, 0x60, 0x65, 0x4B, 0x55, 0x3B, 0x20, 0x3E,
+    0xE4, 0x9D, 0xCB, 0xB8, 0xF2, 0xA6, 0xAF, 0xAC
+  },
+  {
+    0xD7, 0xD6, 0xCB, 0x55, 0x2A, 0xEB, 0x36, 0xEB,
+    0x96, 0xB1, 0xD5, 0xE0, 0x52, 0xF8, 0xD9, 0x21,
+    0xC3, 0x24, 0x5A, 0x97, 0x0D, 0x0B, 0xC8, 0x41,
+    0x0C, 0xD6, 0x5E, 0xA1, 0x04, 0xC8, 0xE7, 0x79
+  },
+  {
+    0xB7, 0x14, 0x1F, 0x30, 0x5E, 0xFD, 0xFE, 0xE5,
+    0x56, 0xBD, 0x13, 0xE0, 0x40, 0x0D, 0x1E, 0x8C,
+    0xFD, 0x65, 0x48, 0xBF, 0x81, 0xEE, 0x5D, 0x15,
+    0x32, 0x7E, 0x49, 0x95, 0xCA, 0x8A, 0xD6, 0xFD
+  },
+  {
+    0xB6, 0xB6, 0x38, 0xD2, 0x2B, 0x7A, 0x12, 0x82,
+    0x53, 0x74, 0xF7, 0x03, 0x48, 0xD7, 0x44, 0x8D,
+    0x4E, 0x7D, 0x90, 0x8C, 0xF6, 0xE7, 0xBB, 0xEF,
+    0x8C, 0x93, 0xEF, 0x67, 0x9B, 0x2A, 0x54, 0x78
+  },
+  {
+    0x0D, 0xF4, 0x58, 0x56, 0x41, 0xFA, 0x09, 0xF6,
+    0xCB, 0xA4, 0xCC, 0x16, 0x5A, 0x10, 0xAD, 0xDE,
+    0x34, 0xF8, 0x0D, 0x42, 0x5A, 0x70, 0xDB, 0x67,
+    0xE2, 0xFD, 0x23, 0x7B, 0x62, 0x7F, 0x43, 0x8A
+  },
+  {
+    0x10, 0x6B, 0x2B, 0x35, 0x4D, 0x95, 0xAC, 0xEC,
+    0xD0, 0xD9, 0x58, 0x8F, 0xBC, 0x23, 0x1F, 0x8B,
+    0xEA, 0x2E, 0x94, 0xEA, 0x66, 0x2D, 0xDD, 0x3F,
+    0x13, 0x9E, 0x1B, 0x67, 0x87, 0x46, 0x1E, 0xED
+  },
+  {
+    0xAE, 0x5C, 0x69, 0xEE, 0xFE, 0x90, 0x89, 0xB2,
+    0x9C, 0x6C, 0x1A, 0x23, 0x70, 0xD2, 0x05, 0x52,
+    0xBA, 0x40, 0xC3, 0xD5, 0xE3, 0x71, 0x3C, 0x12,
+    0xDE, 0xFC, 0xAE, 0x99, 0x7F, 0x43, 0x3E, 0xCD
+  },
+  {
+    0x1A, 0xAE, 0xF5, 0x5D, 0x4F, 0xA8, 0x92, 0xB6,
+    0x35, 0xFB, 0x2A, 0x7A, 0x25, 0xF9, 0xA8, 0xE0,
+    0x3B, 0x9F, 0xFB, 0x08, 0x2A, 0xE9, 0xC0, 0x7C,
+    0x20, 0x42, 0xA0, 0x49, 0xC6, 0x51, 0x5E, 0x45
+  },
+  {
+    0x29, 0x7D, 0xAA, 0xC4, 0xD5, 0x4D, 0xC4, 0x1C,
+    0x83, 0xE3, 0x23, 0x94, 0x59, 0x9F, 0x17, 0x1C,
+    0xDA, 0xA9, 0xDD, 0xB7, 0x17, 0x26, 0xDA, 0x4E,
+    0xCE, 0x3C, 0xCF, 0x95, 0xC1, 0x1F, 0x56, 0xDF
+  },
+  {
+    0x2C, 0x45, 0xAC, 0xF4, 0x91, 0xEC, 0x2F, 0x4B,
+    0x7E, 0x30, 0x9E, 0x7E, 0xDD, 0x81, 0x5B, 0xE5,
+    0xA5, 0x4C, 0x44, 0x58, 0xD1, 0xA5, 0x7C, 0x4F,
+    0x9B, 0x76, 0x3B, 0x0C, 0x67, 0x18, 0xD4, 0x3E
+  },
+  {
+    0x2F, 0x92, 0xF9, 0x01, 0x70, 0xD3, 0xAE, 0x95,
+    0xAB, 0xFA, 0xC3, 0xA6, 0x98, 0x9A, 0x2A, 0x60,
+    0xCB, 0x28, 0xB8, 0x58, 0x78, 0x2B, 0xE7, 0xEA,
+    0x17, 0x9B, 0x48, 0xA7, 0x27, 0x6D, 0xD8, 0x60
+  },
+  {
+    0xB4, 0x01, 0xE8, 0x4B, 0x15, 0xAC, 0xC4, 0x70,
+    0x93, 0x6D, 0x6E, 0x37, 0xF7, 0x88, 0x83, 0x33,
+    0x09, 0x27, 0x31, 0x13, 0x3B, 0x25, 0x1B, 0xEA,
+    0x22, 0x16, 0x58, 0xCA, 0x19, 0xA7, 0x56, 0x69
+  },
+  {
+    0xF8, 0xB3, 0x40, 0xD2, 0xB9, 0xB3, 0x3D, 0x43,
+    0xA0, 0xA6, 0x6F, 0x34, 0x97, 0x82, 0x0A, 0xFA,
+    0xAE, 0xE4, 0x34, 0xC4, 0xE3, 0xC0, 0xC1, 0x7E,
+    0x89, 0x8B, 0x83, 0x01, 0xC5, 0x7A, 0x26, 0xBD
+  },
+  {
+    0x56, 0x6D, 0xA2, 0x83, 0x99, 0x03, 0x89, 0x13,
+    0x8A, 0xA6, 0xF2, 0xAA, 0xA3, 0xB9, 0xE4, 0x0C,
+    0xBF, 0x90, 0x84, 0x0E, 0xC7, 0x62, 0xBD, 0x96,
+    0xB7, 0xE3, 0x3A, 0x31, 0x13, 0xB1, 0x01, 0x08
+  },
+  {
+    0x34, 0x06, 0x72, 0xB7, 0x04, 0x67, 0x60, 0x42,
+    0xC9, 0xBF, 0x3F, 0x33, 0x7B, 0xA7, 0x9F, 0x11,
+    0x33, 0x6A, 0xEB, 0xB5, 0xEC, 0x5D, 0x31, 0xDF,
+    0x54, 0xEB, 0x6A, 0xD3, 0xB0, 0x43, 0x04, 0x42
+  },
+  {
+    0x50, 0x50, 0xB7, 0x3B, 0x93, 0x16, 0xEE, 0xA2,
+    0xF1, 0x49, 0xBF, 0xFD, 0x22, 0xAE, 0xE3, 0x84,
+    0xDC, 0x54, 0x03, 0xB1, 0x8E, 0x16, 0xFA, 0x88,
+    0x82, 0x5E, 0x18, 0x16, 0x09, 0x49, 0x6F, 0xD2
+  },
+  {
+    0x13, 0x65, 0xCC, 0x6F, 0xB9, 0x26, 0x0E, 0x86,
+    0x88, 0x9B, 0x3A, 0xFB, 0xD1, 0xC8, 0xBC, 0x12,
+    0x92, 0x31, 0x97, 0x71, 0x5D, 0xB2, 0x66, 0xCC,
+    0x7A, 0x01, 0xCA, 0x57, 0x15, 0x9F, 0x75, 0x96
+  },
+  {
+    0x29, 0x46, 0x6F, 0x51, 0xC0, 0x11, 0xFD, 0x10,
+    0x18, 0x14, 0x94, 0xA9, 0x37, 0x9B, 0x61, 0x59,
+    0xB8, 0x08, 0xAE, 0x0F, 0xCB, 0x01, 0x61, 0xF8,
+    0xF0, 0x79, 0x09, 0xFF, 0x04, 0x1B, 0x19, 0x65
+  },
+  {
+    0x65, 0x91, 0xA3, 0xC3, 0xC7, 0x67, 0xB3, 0x8D,
+    0x80, 0x5E, 0xD3, 0xF7, 0xEB, 0x67, 0x63, 0xE8,
+    0xB3, 0xD2, 0xD6, 0x42, 0xE7, 0x30, 0x77, 0x45,
+    0xCD, 0x34, 0x18, 0xEF, 0xF6, 0x9A, 0x19, 0xED
+  },
+  {
+    0x1D, 0x84, 0xB0, 0x4B, 0x13, 0x38, 0xB0, 0xD2,
+    0xE3, 0xC9, 0x8F, 0x7A, 0xEA, 0x3E, 0x98, 0xEF,
+    0xFC, 0x53, 0x0A, 0x50, 0x44, 0xB9, 0x3B, 0x96,
+    0xC6, 0x7E, 0xE3, 0x79, 0xD6, 0x2E, 0x81, 0x5F
+  },
+  {
+    0x6F, 0xA2, 0x95, 0x27, 0x25, 0x32, 0xE9, 0x83,
+    0xE1, 0x66, 0xB1, 0x2E, 0x49, 0x99, 0xC0, 0x52,
+    0xF8, 0x9D, 0x9F, 0x30, 0xAE, 0x14, 0x81, 0xF3,
+    0xD6, 0x0E, 0xAE, 0x85, 0xF8, 0xEE, 0x17, 0x8A
+  },
+  {
+    0x4E, 0xD8, 0xCA, 0xA9, 0x8E, 0xC3, 0x9F, 0x6A,
+    0x62, 0x9F, 0x9A, 0x65, 0x4A, 0x44, 0x7E, 0x7E,
+    0x3E, 0x4F, 0xAE, 0xEC, 0xF3, 0x4D, 0xCF, 0x65,
+    0x8D, 0x2D, 0x4B, 0x98, 0xB7, 0xA2, 0xEC, 0x1A
+  },
+  {
+    0xCF, 0xAB, 0x82, 0x99, 0xA0, 0xDA, 0x0C, 0x2A,
+    0x7E, 0x8F, 0xF5, 0x4D, 0x0A, 0x67, 0x6D, 0x14,
+    0x1A, 0xB2, 0x6B, 0xC0, 0x01, 0x2E, 0x5F, 0x66,
+    0x8E, 0x85, 0xD8, 0x14, 0xBC, 0x98, 0x88, 0xB0
+  },
+  {
+    0xA6, 0x26, 0x54, 0x3C, 0x27, 0x1F, 0xCC, 0xC3,
+    0xE4, 0x45, 0x0B, 0x48, 0xD6, 0x6B, 0xC9, 0xCB,
+    0xDE, 0xB2, 0x5E, 0x5D, 0x07, 0x7A, 0x62, 0x13,
+    0xCD, 0x90, 0xCB, 0xBD, 0x0F, 0xD2, 0x20, 0x76
+  },
+  {
+    0x05, 0xCF, 0x3A, 0x90, 0x04, 0x91, 0x16, 0xDC,
+    0x60, 0xEF, 0xC3, 0x15, 0x36, 0xAA, 0xA3, 0xD1,
+    0x67, 0x76, 0x29, 0x94, 0x89, 0x28, 0x76, 0xDC,
+    0xB7, 0xEF, 0x3F, 0xBE, 0xCD, 0x74, 0x49, 0xC0
+  },
+  {
+    0xCC, 0xD6, 0x1C, 0x92, 0x6C, 0xC1, 0xE5, 0xE9,
+    0x12, 0x8C, 0x02, 0x1C, 0x0C, 0x6E, 0x92, 0xAE,
+    0xFC, 0x4F, 0xFB, 0xDE, 0x39, 0x4D, 0xD6, 0xF3,
+    0xB7, 0xD8, 0x7A, 0x8C, 0xED, 0x89, 0x60, 0x14
+  },
+  {
+    0x3F, 0xFA, 0x4F, 0x6D, 0xAF, 0xA5, 0x7F, 0x1C,
+    0x50, 0xF1, 0xAF, 0xA4, 0xF8, 0x12, 0x92, 0xAE,
+    0x71, 0xA0, 0x6F, 0xE4, 0xF8, 0xFF, 0x46, 0xC5,
+    0x1D, 0x32, 0xFF, 0x26, 0x13, 0x48, 0x9F, 0x2B
+  },
+  {
+    0x19, 0xD3, 0x92, 0x1C, 0xFC, 0x0F, 0x1A, 0x2B,
+    0xB8, 0x13, 0xB3, 0xDF, 0xA9, 0x6D, 0xF9, 0x0E,
+    0x2C, 0x6B, 0x87, 0xD7, 0x8E, 0x92, 0x38, 0xF8,
+    0x5B, 0xBC, 0x77, 0xAE, 0x9A, 0x73, 0xF9, 0x8F
+  },
+  {
+    0xF5, 0xC9, 0x16, 0xFF, 0x2B, 0xAD, 0xDE, 0x3E,
+    0x29, 0xA5, 0xF9, 0x40, 0x23, 0x3E, 0xA3, 0x40,
+    0x07, 0xD8, 0xF1, 0x82, 0xA4, 0x8A, 0x80, 0x8B,
+    0x46, 0xBB, 0x80, 0x58, 0x00, 0x3F, 0x19, 0x03
+  },
+  {
+    0x6B, 0xA0, 0x7A, 0x1A, 0xF7, 0x58, 0xE6, 0x82,
+    0xD3, 0xE0, 0x9A, 0xDD, 0x2D, 0x3D, 0xCD, 0xF3,
+    0x5D, 0x95, 0x53, 0xF6, 0x79, 0x98, 0x54, 0xA2,
+    0x7E, 0x53, 0x60, 0x63, 0xC5, 0x7F, 0x81, 0xA5
+  },
+  {
+    0xB7, 0x83, 0x78, 0xFB, 0x44, 0x6C, 0x54, 0x4B,
+    0x04, 0xD4, 0xA1, 0x52, 0xAC, 0x49, 0x57, 0x31,
+    0x61, 0xB3, 0xDD, 0xEB, 0xF6, 0x93, 0x86, 0x77,
+    0x0A, 0x55, 0xA7, 0xD4, 0x7B, 0x88, 0x0E, 0x5D
+  },
+  {
+    0xB5, 0x19, 0x53, 0x8F, 0xE1, 0x62, 0x6F, 0x0C,
+    0x59, 0x59, 0x45, 0xAD, 0xA5, 0x8A, 0x34, 0x4F,
+    0xAA, 0xC0, 0x06, 0x17, 0x61, 0xCC, 0x9D, 0x4A,
+    0x84, 0x14, 0x19, 0xBD, 0x32, 0xEE, 0xC0, 0xD9
+  },
+  {
+    0x96, 0xE4, 0x88, 0xB0, 0x27, 0x89, 0x64, 0x13,
+    0xF4, 0x03, 0x4B, 0x03, 0x54, 0xF4, 0x84, 0x84,
+    0xF6, 0xCF, 0xC1, 0x0F, 0x8E, 0xC5, 0x7B, 0x02,
+    0x6F, 0xD2, 0x1A, 0x3B, 0x88, 0x36, 0x1A, 0x74
+  },
+  {
+    0x77, 0x0C, 0x8A, 0x5F, 0x47, 0xBF, 0xD7, 0x69,
+    0xCE, 0xD3, 0x5A, 0x71, 0xAF, 0xC3, 0xCA, 0x1F,
+    0xF4, 0xC1, 0xF1, 0xE7, 0xCC, 0x3D, 0x23, 0x56,
+    0xDE, 0x94, 0x50, 0x04, 0x36, 0x8D, 0x81, 0x45
+  },
+  {
+    0x6D, 0xF9, 0xD8, 0xD0, 0xD3, 0xA8, 0xD9, 0x8C,
+    0x83, 0x50, 0xD7, 0x16, 0x2B, 0xD1, 0x55, 0x79,
+    0xD5, 0x70, 0x7A, 0xDD, 0x76, 0x11, 0xA0, 0x0E,
+    0xEB, 0x6C, 0xA5, 0x74, 0x3E, 0xD7, 0x8C, 0xB7
+  },
+  {
+    0x4F, 0x0F, 0xE8, 0xFC, 0x17, 0x90, 0x15, 0x91,
+    0xCF, 0x34, 0x87, 0x30, 0xE1, 0x87, 0xDE, 0x52,
+    0x3D, 0x6D, 0x75, 0x68, 0xC1, 0xFB, 0xD8, 0x24,
+    0x85, 0x91, 0x39, 0x85, 0xEB, 0x67, 0x97, 0x1C
+  },
+  {
+    0x0E, 0xF3, 0xBB, 0x35, 0xCF, 0x37, 0x2B, 0xD9,
+    0x4E, 0x3F, 0x80, 0xEE, 0xCE, 0xBD, 0x50, 0xEF,
+    0x0D, 0x03, 0x08, 0xE0, 0x1E, 0x0E, 0xD6, 0xDE,
+    0x0F, 0x5A, 0x8A, 0x8C, 0x81, 0x8A, 0x00, 0x74
+  },
+  {
+    0xC0, 0x38, 0xD3, 0xE8, 0x09, 0xA5, 0xE3, 0xA5,
+    0x8D, 0xB2, 0xF9, 0x1C, 0x15, 0xAE, 0x12, 0x43,
+    0x95, 0x78, 0xF7, 0x54, 0x85, 0xCD, 0x84, 0xF5,
+    0x56, 0xC6, 0x97, 0x1E, 0x8E, 0x25, 0x06, 0x20
+  },
+  {
+    0xCE, 0x39, 0x9A, 0x0F, 0x08, 0x27, 0x7D, 0x8D,
+    0x48, 0x16, 0x09, 0x50, 0x60, 0xEB, 0xBF, 0x33,
+    0xDA, 0x01, 0x6F, 0xB4, 0x3A, 0x6C, 0x35, 0x6D,
+    0x5A, 0x3F, 0xE4, 0xBB, 0x57, 0x4C, 0x5E, 0x7B
+  },
+  {
+    0x86, 0x9F, 0x7E, 0x31, 0x6B, 0x19, 0x4F, 0x95,
+    0x31, 0xBC, 0xAF, 0x33, 0xF7, 0x91, 0x3F, 0x1B,
+    0x9C, 0xFC, 0x6B, 0xB5, 0xDC, 0xF8, 0x6B, 0x69,
+    0x2B, 0xF8, 0xCA, 0xB2, 0x9B, 0x8A, 0xA9, 0x6F
+  },
+  {
+    0x32, 0x7D, 0xFA, 0x46, 0x44, 0x59, 0xD9, 0xE4,
+    0x8F, 0x5E, 0x55, 0xC7, 0xF5, 0xBA, 0xA6, 0x8F,
+    0xC4, 0xA2, 0x5A, 0xD6, 0x22, 0xBC, 0x7B, 0xF0,
+    0x1A, 0xCA, 0x82, 0xFD, 0x5E, 0x72, 0x31, 0x4C
+  },
+  {
+    0xE0, 0x0D, 0xAD, 0x31, 0x51, 0xB9, 0x08, 0x5E,
+    0xAE, 0x78, 0x69, 0x84, 0xFE, 0x20, 0x73, 0x52,
+    0x32, 0xB7, 0xFF, 0x7F, 0x1B, 0x1D, 0xB7, 0x96,
+    0x1F, 0xD0, 0xD0, 0xE0, 0xF6, 0x05, 0xDB, 0x9A
+  },
+  {
+    0x07, 0x6F, 0x64, 0x45, 0x20, 0xD0, 0xB4, 0x73,
+    0x2D, 0x6C, 0x53, 0x1C, 0x93, 0x49, 0x08, 0x90,
+    0x26, 0x93, 0x6D, 0x99, 0x82, 0x04, 0x61, 0xDA,
+    0x87, 0x74, 0x9A, 0x52, 0x0F, 0xBE, 0x90, 0xCE
+  },
+  {
+    0xB4, 0x41, 0x4C, 0xA1, 0x37, 0x3B, 0xE4, 0x6F,
+    0x15, 0xCE, 0xA6, 0xB1, 0x25, 0x5A, 0x7D, 0x18,
+    0x86, 0xC6, 0xFD, 0xB0, 0x8E, 0xD5, 0xAF, 0x96,
+    0x57, 0xD5, 0xAA, 0xC3, 0x17, 0xDE, 0x3A, 0x29
+  },
+  {
+    0x8D, 0x1A, 0xB0, 0x26, 0x3D, 0xAB, 0x7B, 0x86,
+    0xEC, 0xEE, 0x21, 0x91, 0x62, 0xD9, 0x99, 0xA0,
+    0x12, 0x45, 0x57, 0x22, 0x69, 0xDE, 0x31, 0x10,
+    0x0E, 0x5D, 0x88, 0xFC, 0x1B, 0x1E, 0xAA, 0x69
+  },
+  {
+    0xB4, 0x8D, 0x1C, 0x1F, 0x83, 0x92, 0x4A, 0x02,
+    0xA2, 0x3E, 0x5E, 0x0F, 0x97, 0x1E, 0x16, 0xE8,
+    0x7F, 0xC4, 0x88, 0x48, 0x53, 0x83, 0x34, 0x85,
+    0x19, 0x1A, 0x2B, 0x60, 0x72, 0x2F, 0xE2, 0x69
+  },
+  {
+    0xF2, 0xED, 0xD5, 0xF7, 0x50, 0xA2, 0x0A, 0x54,
+    0x1D, 0x3F, 0x6B, 0xD5, 0xDF, 0x80, 0x83, 0x8F,
+    0x11, 0x82, 0x5B, 0x25, 0xA9, 0x8F, 0x3D, 0xA5,
+    0xE1, 0x52, 0x3B, 0xFF, 0x81, 0x3B, 0xB5, 0x60
+  },
+  {
+    0x07, 0x16, 0x60, 0x04, 0xEF, 0x88, 0xE1, 0x61,
+    0x4E, 0xBD, 0xC8, 0x87, 0xDF, 0xC7, 0xDA, 0x42,
+    0xEB, 0xCD, 0xA0, 0x2D, 0x92, 0xC1, 0x2F, 0x18,
+    0xD1, 0x18, 0x6C, 0xE3, 0xC9, 0x87, 0x10, 0xE4
+  },
+  {
+    0x69, 0xF8, 0x3A, 0xA1, 0x01, 0xD6, 0x9B, 0x8F,
+    0x12, 0x20, 0xDC, 0x1C, 0x53, 0x8D, 0x89, 0x34,
+    0x45, 0x84, 0x20, 0xBE, 0x33, 0x5F, 0xEB, 0x46,
+    0xFF, 0xC4, 0x7A, 0x2C, 0x8E, 0x2E, 0x6A, 0x8A
+  },
+  {
+    0xE1, 0x46, 0x9F, 0x16, 0xC6, 0xFC, 0xA1, 0x51,
+    0x19, 0xA2, 0x72, 0xE5, 0x85, 0xC7, 0xF5, 0x04,
+    0x21, 0xBC, 0x8A, 0x41, 0x4C, 0x86, 0x4F, 0xC7,
+    0x6B, 0x01, 0x04, 0x8D, 0x4C, 0x6F, 0xC5, 0xD2
+  },
+  {
+    0x67, 0x63, 0x34, 0x3A, 0x1C, 0x80, 0xF1, 0x92,
+    0x83, 0xA8, 0x0A, 0xF8, 0x54, 0xE7, 0xE9, 0x06,
+    0x5C, 0x2A, 0x83, 0x49, 0xEF, 0x11, 0xF1, 0x1B,
+    0xFB, 0x76, 0xBA, 0x9F, 0x97, 0x04, 0x85, 0x39
+  },
+  {
+    0x1A, 0xE3, 0xA0, 0xB8, 0xB2, 0xC7, 0x88, 0x5B,
+    0xA3, 0x18, 0xAD, 0x6F, 0xD4, 0x49, 0xFC, 0x4D,
+    0x7F, 0x84, 0x04, 0xB5, 0x9C, 0xF3, 0x27, 0x5F,
+    0xCD, 0xEA, 0x13, 0x56, 0x34, 0x25, 0x77, 0x2D
+  },
+  {
+    0x3A, 0x71, 0x18, 0x4C, 0xBE, 0x8E, 0xB5, 0x8E,
+    0x68, 0x12, 0xBA, 0x7A, 0x7A, 0x1D, 0xCA, 0x0C,
+    0xA2, 0x8E, 0xEC, 0x63, 0x78, 0x2F, 0x2E, 0x6E,
+    0x3C, 0x0B, 0x87, 0x07, 0x3F, 0x53, 0x3F, 0xFD
+  },
+  {
+    0x18, 0x4C, 0xCF, 0x2A, 0x52, 0xF3, 0x88, 0xC9,
+    0xF8, 0x97, 0xA8, 0x57, 0xFE, 0x7C, 0xCE, 0xC2,
+    0x95, 0x99, 0x11, 0xA8, 0xD1, 0xE0, 0x9E, 0xE8,
+    0x80, 0x4D, 0x8D, 0x5D, 0x50, 0x8D, 0xD9, 0x18
+  },
+  {
+    0xA6, 0x6D, 0x40, 0x9A, 0xF7, 0xAF, 0xD7, 0x5B,
+    0xE8, 0x31, 0xDD, 0x49, 0x8C, 0x19, 0x6E, 0xF1,
+    0x2C, 0x73, 0xC3, 0x11, 0x29, 0xEC, 0x02, 0xD5,
+    0xF1, 0x2A, 0xB0, 0x2A, 0x2C, 0x63, 0xA2, 0x5E
+  },
+  {
+    0x58, 0xB3, 0x74, 0x97, 0xFC, 0xF0, 0xBE, 0x0E,
+    0x0C, 0xF1, 0x73, 0x40, 0x45, 0xC2, 0x95, 0xB2,
+    0x86, 0xC7, 0x6A, 0x7C, 0x04, 0x8E, 0x87, 0xC5,
+    0x40, 0x28, 0xED, 0x36, 0x91, 0x5B, 0x5D, 0xF3
+  },
+  {
+    0x2C, 0x73, 0x33, 0x54, 0x0A, 0x83, 0x2D, 0x64,
+    0x45, 0x6E, 0x43, 0x05, 0x8C, 0x50, 0xD9, 0x3C,
+    0x93, 0x2A, 0xD9, 0xB1, 0x8B, 0x3F, 0xC3, 0xA0,
+    0x59, 0x92, 0x07, 0xCD, 0xA3, 0xB3, 0xC7, 0xA6
+  },
+  {
+    0x3D, 0xC0, 0x62, 0xFF, 0xB5, 0x7D, 0x83, 0x5F,
+    0xE3, 0xAA, 0x40, 0x94, 0x66, 0x82, 0x2F, 0x91,
+    0x86, 0x91, 0x84, 0x23, 0x94, 0x75, 0x05, 0x16,
+    0x5F, 0xDC, 0xDF, 0xB7, 0x30, 0x6F, 0x72, 0x59
+  },
+  {
+    0x89, 0x20, 0x48, 0x44, 0xAC, 0xB9, 0x2F, 0x35,
+    0x3B, 0xFC, 0x89, 0xA3, 0xCE, 0x8A, 0x98, 0x17,
+    0x21, 0x9C, 0x10, 0x13, 0x85, 0xC5, 0x93, 0xCF,
+    0x60, 0xE0, 0xBE, 0xFA, 0x96, 0x38, 0xE1, 0x4E
+  },
+  {
+    0x78, 0x2B, 0xA9, 0x02, 0xE9, 0x12, 0x32, 0x94,
+    0x1C, 0x78, 0xC4, 0x9C, 0xD9, 0x77, 0x1A, 0x5D,
+    0x99, 0x92, 0xF9, 0xB0, 0x7D, 0x9C, 0x0A, 0x2D,
+    0xF8, 0x2D, 0x38, 0x5D, 0x15, 0xC4, 0x2B, 0xB3
+  },
+  {
+    0x0D, 0xC3, 0xFF, 0x7D, 0xF0, 0xDF, 0xC0, 0x23,
+    0x76, 0x3D, 0x76, 0x34, 0xE1, 0x8D, 0xA2, 0x73,
+    0x93, 0xFC, 0x9F, 0xDB, 0x1C, 0x15, 0x46, 0x46,
+    0x86, 0x10, 0x75, 0xF0, 0xA8, 0x7D, 0x0E, 0x90
+  },
+  {
+    0xB9, 0x5C, 0x65, 0xFB, 0x6F, 0x25, 0x4E, 0xDB,
+    0xDE, 0x8C, 0x03, 0x7D, 0x5C, 0x8B, 0x20, 0x39,
+    0x34, 0x0F, 0x4A, 0xC2, 0xB0, 0x23, 0xA6, 0xAA,
+    0x28, 0xA8, 0xFC, 0xD2, 0xD2, 0x68, 0x9C, 0xF4
+  },
+  {
+    0x87, 0xE8, 0xF5, 0x15, 0x72, 0xA5, 0xD6, 0xA2,
+    0x39, 0xF8, 0x5B, 0xC5, 0x3E, 0x11, 0x74, 0xE1,
+    0x5B, 0xE1, 0x2F, 0xCD, 0xF1, 0x51, 0xA0, 0xB9,
+    0xA2, 0xB4, 0x36, 0x40, 0xCA, 0xF7, 0x4C, 0x1D
+  },
+  {
+    0x2A, 0x6F, 0x3E, 0x46, 0x2C, 0x40, 0x5C, 0x35,
+    0x4F, 0xE8, 0x0F, 0xCC, 0xCE, 0xD1, 0xC9, 0xBE,
+    0x44, 0x32, 0x5D, 0x29, 0xE0, 0x7D, 0xA3, 0x09,
+    0x60, 0xB6, 0x25, 0xA7, 0x6E, 0xA4, 0x2F, 0x83
+  },
+  {
+    0x20, 0xB4, 0x6C, 0x8F, 0xBF, 0xCA, 0x97, 0x45,
+    0x32, 0x62, 0x46, 0x0F, 0x84, 0x98, 0xA7, 0xE2,
+    0xAF, 0x15, 0xAC, 0x79, 0xB5, 0x9D, 0xDF, 0xB0,
+    0x27, 0xBB, 0x52, 0xF2, 0xD6, 0x8E, 0x8F, 0x51
+  },
+  {
+    0x31, 0xB0, 0x76, 0x3C, 0xB9, 0xBA, 0x92, 0x40,
+    0x3D, 0xCA, 0x1A, 0xBD, 0xD7, 0x34, 0x2D, 0x7D,
+    0xE9, 0x4C, 0x58, 0x1E, 0x76, 0xF7, 0xC9, 0xA6,
+    0x1E, 0x51, 0x59, 0x28, 0xE1, 0x0B, 0x4E, 0x77
+  },
+  {
+    0xE1, 0x91, 0xE1, 0x17, 0x06, 0x3C, 0xFA, 0xC9,
+    0x64, 0x2C, 0xD9, 0x3C, 0xB4, 0x2B, 0x39, 0xED,
+    0xDD, 0x9E, 0x4A, 0xB6, 0x5F, 0x1D, 0x03, 0x97,
+    0xE3, 0xE1, 0x7D, 0xD0, 0x4C, 0xAB, 0x11, 0x80
+  },
+  {
+    0x22, 0x5A, 0x20, 0x21, 0x07, 0xA7, 0x47, 0x03,
+    0xE0, 0x41, 0xC6, 0xCC, 0xA4, 0xEA, 0xCF, 0x4F,
+    0x21, 0xEE, 0xA6, 0xF2, 0x2A, 0x14, 0x6D, 0x8D,
+    0xA2, 0xAB, 0x8C, 0xF6, 0x19, 0x72, 0x29, 0xA5
+  },
+  {
+    0xEF, 0xC4, 0x83, 0x6B, 0xE4, 0xAC, 0x3E, 0x97,
+    0x91, 0xD2, 0xEC, 0x62, 0x22, 0x6E, 0x7D, 0xF6,
+    0x41, 0x18, 0xF4, 0x56, 0x5C, 0x19, 0xE6, 0xC9,
+    0xE8, 0x40, 0x63, 0xF5, 0x66, 0x1C, 0x7B, 0x2F
+  },
+  {
+    0x3A, 0x76, 0xB0, 0x15, 0x2C, 0x0E, 0x1D, 0x1F,
+    0xD7, 0xAC, 0x9D, 0x91, 0xA2, 0x8A, 0x18, 0xE1,
+    0xA4, 0xC0, 0x60, 0x80, 0xF2, 0xB7, 0xEC, 0xEF,
+    0xB6, 0xEF, 0xFE, 0x28, 0xB8, 0xCF, 0xC7, 0x65
+  },
+  {
+    0x0D, 0x46, 0xAD, 0x03, 0x90, 0x70, 0x11, 0x58,
+    0x28, 0xF9, 0x4E, 0xB6, 0xB7, 0x29, 0x63, 0xE6,
+    0x0A, 0x7D, 0x2D, 0xB7, 0xCA, 0x89, 0x91, 0xD2,
+    0x25, 0xC3, 0x87, 0x7B, 0x14, 0x9B, 0x0A, 0x8A
+  },
+  {
+    0xE4, 0x4C, 0xFC, 0x42, 0x11, 0x8F, 0x09, 0x6B,
+    0xFC, 0x51, 0x52, 0x1C, 0xB1, 0x8D, 0x5D, 0x65,
+    0x25, 0x58, 0x6B, 0x98, 0x9F, 0x4E, 0xE2, 0xB8,
+    0x28, 0xC5, 0x19, 0x9F, 0xEA, 0xB9, 0x4B, 0x82
+  },
+  {
+    0x6D, 0x4B, 0xD2, 0xE0, 0x73, 0xEC, 0x49, 0x66,
+    0x84, 0x7F, 0x5C, 0xBE, 0x88, 0xDD, 0xFA, 0xBA,
+    0x2B, 0xE4, 0xCA, 0xF2, 0xF3, 0x33, 0x55, 0x2B,
+    0x85, 0x53, 0xDA, 0x53, 0x34, 0x87, 0xC2, 0x5B
+  },
+  {
+    0xBB, 0xC4, 0x6D, 0xB4, 0x37, 0xD1, 0x07, 0xC9,
+    0x67, 0xCA, 0x6D, 0x91, 0x45, 0x5B, 0xBD, 0xFE,
+    0x05, 0x21, 0x18, 0xAB, 0xD1, 0xD0, 0x69, 0xF0,
+    0x43, 0x59, 0x48, 0x7E, 0x13, 0xAE, 0xA0, 0xE1
+  },
+  {
+    0xB9, 0x74, 0xC1, 0x4D, 0xB7, 0xD3, 0x17, 0x4D,
+    0xD0, 0x60, 0x84, 0xBB, 0x30, 0x31, 0x08, 0xB2,
+    0xF0, 0xDA, 0xF5, 0x0E, 0xCC, 0xC3, 0x29, 0x35,
+    0x43, 0x79, 0x5C, 0x96, 0x36, 0xC6, 0x24, 0x82
+  },
+  {
+    0x0E, 0xEE, 0x23, 0x5B, 0x06, 0x93, 0x6A, 0xED,
+    0x71, 0x73, 0xC8, 0xC1, 0x9A, 0xA7, 0xC2, 0x17,
+    0xB9, 0xEE, 0xDA, 0xEB, 0x1A, 0x88, 0xF3, 0x05,
+    0x52, 0xE9, 0x22, 0x51, 0x45, 0x14, 0x9E, 0x82
+  },
+  {
+    0x36, 0xD0, 0x89, 0xE0, 0x25, 0xB5, 0x68, 0x69,
+    0x37, 0x74, 0x28, 0x25, 0xE6, 0xEE, 0x3D, 0x83,
+    0xE7, 0xD7, 0xA5, 0x0C, 0x82, 0x3C, 0x82, 0x88,
+    0x34, 0x60, 0xF3, 0x85, 0x14, 0x7D, 0xC1, 0x7B
+  },
+  {
+    0x77, 0xEE, 0x4F, 0xFC, 0x9F, 0x5D, 0xD6, 0x05,
+    0x47, 0x0D, 0xC0, 0xE7, 0x4D, 0x6B, 0x17, 0xC5,
+    0x13, 0x0D, 0x8B, 0x73, 0x91, 0x3F, 0x36, 0xD5,
+    0xF8, 0x78, 0x7E, 0x61, 0x9A, 0x94, 0x7C, 0xA0
+  },
+  {
+    0x0F, 0xE6, 0xC2, 0xAB, 0x75, 0x42, 0x33, 0x36,
+    0x0D, 0x68, 0xB9, 0xAC, 0x80, 0xCD, 0x61, 0x18,
+    0x4B, 0xFA, 0xA7, 0xD3, 0x56, 0x29, 0x41, 0x80,
+    0x02, 0x5F, 0xE4, 0x06, 0x39, 0xC7, 0x6C, 0x36
+  },
+  {
+    0x99, 0x60, 0x88, 0xC7, 0x94, 0x56, 0xEC, 0xDD,
+    0xA1, 0xFB, 0xC0, 0x2E, 0xE1, 0xBA, 0x42, 0xD9,
+    0x1D, 0x85, 0x8C, 0x31, 0x0A, 0x5A, 0x8B, 0x46,
+    0x74, 0xFE, 0x6A, 0x7C, 0x14, 0x44, 0x14, 0xA1
+  },
+  {
+    0x9E, 0x33, 0x8A, 0xED, 0x0B, 0xC7, 0x1C, 0x0C,
+    0x97, 0xF1, 0x98, 0x55, 0xBF, 0x49, 0x17, 0x4F,
+    0x70, 0xA9, 0xD7, 0x70, 0x14, 0x87, 0x36, 0x63,
+    0x21, 0x34, 0x27, 0x50, 0x2B, 0xD8, 0x5D, 0x9F
+  },
+  {
+    0x4A, 0x84, 0x3D, 0x26, 0xAD, 0xEC, 0x52, 0x0E,
+    0x4B, 0x5D, 0xBF, 0x01, 0x45, 0xCC, 0x4F, 0x50,
+    0x24, 0xFA, 0xFC, 0xDC, 0x20, 0x25, 0x82, 0x4A,
+    0x8C, 0x64, 0x65, 0x06, 0x17, 0x68, 0x7E, 0xE7
+  },
+  {
+    0xC9, 0x16, 0x78, 0xC4, 0xA6, 0x4E, 0x2F, 0xA4,
+    0xB7, 0x4D, 0xE6, 0x1A, 0xD0, 0xC0, 0x6F, 0xF0,
+    0x6B, 0x5D, 0x67, 0x2F, 0xA7, 0xC6, 0x87, 0x7A,
+    0x40, 0x14, 0xCE, 0x9E, 0x91, 0xBE, 0x38, 0xD7
+  },
+  {
+    0xFF, 0x77, 0x77, 0x40, 0x5D, 0x32, 0x7A, 0xDB,
+    0x58, 0x30, 0x1C, 0x71, 0x1E, 0xCD, 0xC2, 0xBC,
+    0xE1, 0xBF, 0xA8, 0x29, 0xFF, 0xC9, 0xB1, 0x17,
+    0xF2, 0x1A, 0x2B, 0x19, 0x8D, 0x0D, 0x68, 0x84
+  },
+  {
+    0x0A, 0x8D, 0xDA, 0xF1, 0x72, 0x8C, 0x5C, 0xD9,
+    0x3A, 0x25, 0x5D, 0x56, 0x23, 0xC3, 0xDA, 0xDA,
+    0x2D, 0x3D, 0x05, 0x71, 0xBF, 0x14, 0x38, 0xAD,
+    0xC8, 0xC9, 0x64, 0xA9, 0xAA, 0xD1, 0x18, 0xCB
+  },
+  {
+    0xC1, 0x33, 0xAB, 0xBD, 0x0D, 0x2D, 0x80, 0x8A,
+    0x67, 0xB6, 0x74, 0x5B, 0x4B, 0x36, 0x50, 0xB4,
+    0xA6, 0x4D, 0xC2, 0x76, 0xCF, 0x98, 0xE3, 0x03,
+    0x57, 0xB6, 0xAB, 0xD5, 0xC1, 0xD2, 0x2A, 0x9B
+  },
+  {
+    0xC5, 0x9E, 0xE5, 0xC1, 0x96, 0xBA, 0x3C, 0xFE,
+    0xF9, 0x40, 0x87, 0x79, 0x82, 0x07, 0xBD, 0xCE,
+    0xF1, 0x39, 0xCE, 0x2C, 0xF7, 0x8D, 0xCE, 0xD6,
+    0x19, 0x8F, 0x0F, 0xA3, 0xA4, 0x09, 0x13, 0x1C
+  },
+  {
+    0xC7, 0xFD, 0xAD, 0xE5, 0x9C, 0x46, 0x99, 0x38,
+    0x5E, 0xBA, 0x59, 0xE7, 0x56, 0xC2, 0xB1, 0x71,
+    0xB0, 0x23, 0xDE, 0xAE, 0x08, 0x2E, 0x5A, 0x6E,
+    0x3B, 0xFB, 0xDC, 0x10, 0x73, 0xA3, 0x20, 0x03
+  },
+  {
+    0x97, 0x53, 0x27, 0xC5, 0xF4, 0xDE, 0xC6, 0x41,
+    0x4B, 0x6E, 0x00, 0xCB, 0x04, 0x23, 0x37, 0xB8,
+    0xD2, 0xA6, 0x56, 0x46, 0x37, 0xA7, 0x44, 0x2A,
+    0xEC, 0x7B, 0xE8, 0xF8, 0xC8, 0x9A, 0x2F, 0x1C
+  },
+  {
+    0xA2, 0xF7, 0x24, 0x6D, 0xF4, 0xA2, 0x4E, 0xFB,
+    0xAC, 0xD3, 0xFD, 0x60, 0x68, 0x3A, 0xBC, 0x86,
+    0x8B, 0xEF, 0x25, 0x32, 0x70, 0x52, 0xCF, 0x2F,
+    0x1D, 0x93, 0xEC, 0xE4, 0xFF, 0xCD, 0x73, 0xC6
+  },
+  {
+    0x49, 0x7F, 0xB2, 0xAC, 0xAC, 0xF1, 0x23, 0xF3,
+    0x59, 0x5E, 0x40, 0xFC, 0x51, 0xA7, 0xBD, 0x24,
+    0x45, 0x8B, 0xBC, 0xBA, 0x4A, 0x29, 0x40, 0xA5,
+    0xCB, 0x03, 0xD6, 0x08, 0xFB, 0xDF, 0x28, 0x25
+  },
+  {
+    0x0E, 0x97, 0xD2, 0x27, 0x93, 0xCE, 0x6F, 0x28,
+    0x3D, 0x5C, 0x74, 0x0D, 0x30, 0x8A, 0x27, 0xAD,
+    0x7C, 0x3B, 0x0D, 0x9A, 0xFC, 0xD3, 0xD9, 0xE9,
+    0xB9, 0xCA, 0xC5, 0x6B, 0x10, 0x29, 0x0C, 0x8F
+  },
+  {
+    0x66, 0x30, 0xB3, 0x56, 0x18, 0xE7, 0x00, 0xD9,
+    0x10, 0x68, 0x38, 0x93, 0x79, 0x5E, 0xF7, 0x0B,
+    0xF0, 0x7E, 0xB1, 0x56, 0xF5, 0x5F, 0xFE, 0x3B,
+    0x69, 0xAD, 0x88, 0xA4, 0xB8, 0xB0, 0xBF, 0xA1
+  },
+  {
+    0x02, 0xF7, 0x42, 0xC6, 0xE9, 0x52, 0x78, 0x12,
+    0x1A, 0x05, 0xE4, 0x42, 0x05, 0x44, 0x4F, 0xC5,
+    0xEA, 0x6A, 0xF5, 0xE7, 0x41, 0xC5, 0x35, 0xBC,
+    0x2C, 0xBC, 0x3B, 0x23, 0x5A, 0x2E, 0xA2, 0xB0
+  },
+  {
+    0x46, 0x22, 0xF3, 0x6E, 0xB8, 0x98, 0x38, 0x3F,
+    0x60, 0xD5, 0xBE, 0xD8, 0x09, 0xAC, 0x5C, 0x47,
+    0x45, 0xC5, 0xD6, 0xAB, 0x84, 0xBC, 0xAD, 0xF7,
+    0x9C, 0xF2, 0xA9, 0x6D, 0x4E, 0xC8, 0x88, 0x18
+  },
+  {
+    0xCC, 0xD1, 0x1F, 0xAA, 0xA0, 0x58, 0x1E, 0xC3,
+    0x2C, 0x3A, 0x40, 0x3F, 0x92, 0xEF, 0x43, 0xD5,
+    0xDC, 0xF1, 0x95, 0xC1, 0xA1, 0x01, 0xDB, 0xFD,
+    0x49, 0x5D, 0xBB, 0x4D, 0xCE, 0x80, 0x69, 0xE0
+  },
+  {
+    0x06, 0x02, 0x4D, 0x6B, 0x07, 0xE0, 0x00, 0xBC,
+    0xE6, 0x13, 0x47, 0x0A, 0x28, 0x80, 0x51, 0x9B,
+    0x8B, 0xE4, 0xA3, 0x6B, 0xF3, 0x3C, 0x99, 0xC9,
+    0x17, 0x89, 0x3E, 0xC7, 0x5D, 0xD9, 0x0F, 0xE3
+  },
+  {
+    0xD9, 0x3A, 0xF9, 0x47, 0xB1, 0x46, 0x3A, 0x81,
+    0x7D, 0xB4, 0x41, 0xA4, 0x74, 0x58, 0x8D, 0x6F,
+    0x99, 0x6D, 0x24, 0x39, 0x83, 0xE8, 0x3C, 0x7E,
+    0xEE, 0x90, 0xE1, 0xEF, 0xA4, 0x40, 0xD9, 0xBA
+  },
+  {
+    0x94, 0x89, 0x89, 0x45, 0xA7, 0xDB, 0x25, 0x9E,
+    0x1B, 0x2E, 0x7C, 0xBE, 0xA4, 0x8A, 0xA0, 0xC6,
+    0xD6, 0x57, 0x0D, 0x18, 0x17, 0x9F, 0x06, 0x18,
+    0x47, 0x1C, 0x88, 0xF3, 0xEC, 0x3B, 0x0F, 0xC3
+  },
+  {
+    0x4C, 0x2D, 0x93, 0x52, 0x56, 0x39, 0x2A, 0xA2,
+    0xBE, 0x6E, 0x10, 0x78, 0xC0, 0x59, 0x38, 0x15,
+    0xAB, 0xEF, 0x46, 0x9D, 0xE9, 0x69, 0xB5, 0x7B,
+    0x88, 0x1B, 0x93, 0xAF, 0x55, 0x84, 0x65, 0xFA
+  },
+  {
+    0xAA, 0xC7, 0xBE, 0x16, 0xE5, 0x2F, 0x79, 0x0E,
+    0x4F, 0xF7, 0x0B, 0x24, 0x01, 0x5C, 0xB1, 0x1B,
+    0x40, 0x61, 0x6E, 0x94, 0xDB, 0x13, 0x88, 0x2B,
+    0x41, 0xD3, 0xDD, 0x8C, 0x8C, 0x19, 0x52, 0xB7
+  },
+  {
+    0x04, 0x34, 0xB4, 0x7C, 0x0E, 0xE7, 0xE6, 0xF5,
+    0x39, 0x06, 0x79, 0x9A, 0x43, 0x20, 0x9D, 0x3F,
+    0xC3, 0x7D, 0x3F, 0xD1, 0xF7, 0x45, 0x55, 0xDE,
+    0x67, 0xAB, 0xAC, 0xB9, 0x51, 0xB0, 0x06, 0xF4
+  },
+  {
+    0x04, 0x42, 0xFB, 0xDD, 0x5B, 0x58, 0x49, 0x6E,
+    0xC7, 0x81, 0x59, 0xCC, 0xAA, 0x88, 0x7C, 0x88,
+    0xA8, 0x61, 0xFC, 0xCA, 0x70, 0xE7, 0xAB, 0xC9,
+    0x76, 0xF2, 0x4C, 0x11, 0x58, 0x8B, 0xE6, 0xEE
+  },
+  {
+    0xA7, 0x3E, 0x68, 0xBB, 0x18, 0xB0, 0x07, 0x64,
+    0x8E, 0x76, 0xB5, 0x52, 0x8D, 0x1E, 0x50, 0xE7,
+    0xFA, 0x65, 0x4D, 0xA3, 0x97, 0x0E, 0xC3, 0x49,
+    0xBF, 0x59, 0x1A, 0x30, 0xD9, 0x32, 0xC8, 0xF6
+  },
+  {
+    0x84, 0x9C, 0xF8, 0x73, 0x16, 0x2B, 0xA7, 0x2C,
+    0x4B, 0x80, 0x08, 0xE6, 0x8F, 0x93, 0x2F, 0xB3,
+    0xA0, 0x15, 0xA7, 0x4F, 0xCF, 0x95, 0x71, 0x98,
+    0xD5, 0x6A, 0x0D, 0xC4, 0x62, 0x5A, 0x74, 0xF5
+  },
+  {
+    0xA6, 0xDE, 0xC6, 0xFC, 0x89, 0x49, 0x34, 0x9C,
+    0x4E, 0x9A, 0x9C, 0x62, 0x36, 0x87, 0xFB, 0xA4,
+    0xC9, 0xB2, 0x75, 0xBD, 0xB2, 0x30, 0x50, 0x9B,
+    0x72, 0xE3, 0xD6, 0x71, 0x19, 0x14, 0xE2, 0xD8
+  },
+  {
+    0x58, 0xAF, 0xC2, 0xB2, 0x4A, 0x19, 0xFD, 0xBF,
+    0x76, 0xA0, 0x9B, 0x70, 0xB1, 0xE3, 0xB7, 0x7F,
+    0xCB, 0xD4, 0x06, 0x50, 0x01, 0xD9, 0x63, 0x66,
+    0x40, 0xEB, 0x5A, 0x26, 0x28, 0xF4, 0x42, 0xCC
+  },
+  {
+    0x47, 0x3A, 0x43, 0xAA, 0x1D, 0x6A, 0x02, 0x87,
+    0x67, 0x43, 0x2A, 0x83, 0x0A, 0xD1, 0x22, 0x1E,
+    0x02, 0x9C, 0x58, 0x9A, 0xF9, 0xFD, 0x4D, 0x68,
+    0xD5, 0x6C, 0x4F, 0xB8, 0x20, 0x25, 0x93, 0x52
+  },
+  {
+    0xA0, 0xAE, 0xB4, 0xA5, 0xAD, 0x89, 0x9A, 0xF2,
+    0xE2, 0x91, 0xB2, 0xE7, 0x9D, 0xBB, 0x6B, 0x0B,
+    0xF5, 0x6B, 0x58, 0x44, 0x67, 0x6B, 0x95, 0x5D,
+    0x94, 0x5B, 0x6C, 0x4A, 0xE1, 0xC0, 0x1E, 0xED
+  },
+  {
+    0xCF, 0xC3, 0x02, 0x9A, 0x9E, 0xEB, 0x15, 0x22,
+    0x22, 0xD9, 0x66, 0x53, 0x49, 0x2E, 0x46, 0xCA,
+    0x64, 0xCA, 0x4F, 0x0D, 0x64, 0x68, 0x30, 0x28,
+    0xD3, 0xAE, 0xE5, 0xA4, 0x9C, 0xB4, 0x71, 0x63
+  },
+  {
+    0x74, 0x67, 0xCF, 0x77, 0x61, 0xCD, 0x9F, 0x55,
+    0x61, 0x8D, 0x30, 0xC9, 0xD8, 0xC5, 0xB4, 0x1E,
+    0x47, 0x01, 0x51, 0x0C, 0x7D, 0x16, 0xAB, 0x4E,
+    0x5D, 0x89, 0xA5, 0xD7, 0x71, 0x46, 0xB0, 0x92
+  },
+  {
+    0xC0, 0x16, 0xD8, 0x42, 0x4E, 0x53, 0x1E, 0xFC,
+    0x57, 0x37, 0xC0, 0x3F, 0xC9, 0x0A, 0x5E, 0xFC,
+    0x9F, 0x90, 0x22, 0xE4, 0xD5, 0xBA, 0x3B, 0x06,
+    0x95, 0xF7, 0xAE, 0x53, 0x82, 0x60, 0xC2, 0xEE
+  },
+  {
+    0x5D, 0x38, 0x11, 0x89, 0xE6, 0x00, 0x0F, 0xC1,
+    0x17, 0xC7, 0x1F, 0x59, 0xF7, 0x86, 0xFB, 0x4B,
+    0x79, 0xFD, 0xD4, 0xEC, 0x5D, 0x4C, 0xD3, 0x0A,
+    0xAC, 0x21, 0x57, 0xF7, 0x5D, 0xEA, 0xD7, 0x78
+  },
+  {
+    0x7C, 0x9C, 0xDD, 0x15, 0xC4, 0xC9, 0xAB, 0xCA,
+    0xCB, 0xFE, 0x6F, 0x66, 0x4A, 0x7F, 0x5F, 0x8B,
+    0x2E, 0x25, 0x91, 0x83, 0x29, 0x1A, 0xE5, 0xCC,
+    0x91, 0x30, 0xA0, 0xB2, 0x41, 0xE5, 0x73, 0x7F
+  },
+  {
+    0xB8, 0x81, 0x31, 0x72, 0xF5, 0x21, 0x8A, 0xC3,
+    0xEB, 0x68, 0x7B, 0xC4, 0xAF, 0xAF, 0xF8, 0x3F,
+    0xBC, 0xA4, 0xE9, 0xC1, 0xA4, 0x62, 0x96, 0x33,
+    0x01, 0xDD, 0x44, 0x59, 0x85, 0x01, 0x50, 0xA2
+  },
+  {
+    0xE3, 0xD1, 0x30, 0xE3, 0x6A, 0x02, 0x8E, 0xA8,
+    0x0C, 0x57, 0xA2, 0xAA, 0x48, 0x19, 0xFD, 0x34,
+    0xE4, 0xDB, 0xBE, 0xB1, 0x4A, 0x49, 0x58, 0x94,
+    0xB1, 0x5A, 0x87, 0x87, 0xDB, 0x1A, 0x9F, 0x9C
+  },
+  {
+    0xFF, 0xF1, 0xB4, 0x40, 0x0F, 0x48, 0x9E, 0x07,
+    0xD2, 0x23, 0x51, 0xC1, 0xF0, 0x95, 0x65, 0xE2,
+    0x65, 0xB6, 0x8A, 0xD2, 0x9F, 0x63, 0x29, 0x87,
+    0x9E, 0x6B, 0x5F, 0x7F, 0x6B, 0x41, 0x93, 0x50
+  },
+  {
+    0x55, 0x9E, 0xD5, 0xBB, 0x3E, 0x5F, 0x39, 0x85,
+    0xFB, 0x57, 0x82, 0x28, 0xBF, 0x8C, 0x0F, 0x0B,
+    0x17, 0x3F, 0x8D, 0x11, 0x53, 0xFA, 0xEB, 0x9F,
+    0xEC, 0x75, 0x6F, 0xFD, 0x18, 0xA8, 0x72, 0x38
+  },
+  {
+    0x88, 0x13, 0x12, 0x53, 0x01, 0x4D, 0x23, 0xC5,
+    0xE3, 0x8E, 0x78, 0xBD, 0xA1, 0x94, 0x55, 0xD8,
+    0xA0, 0x23, 0xBD, 0x7A, 0x7E, 0x72, 0x74, 0x57,
+    0xA1, 0x52, 0xA8, 0x1D, 0x0B, 0x17, 0x18, 0xA7
+  },
+  {
+    0xF4, 0xD3, 0xFA, 0xE7, 0xCD, 0xE6, 0xBB, 0x66,
+    0x71, 0x5A, 0x19, 0x8F, 0xA4, 0x8D, 0x21, 0x0C,
+    0x10, 0xF8, 0xDF, 0x32, 0x04, 0xAE, 0x5E, 0x33,
+    0xA6, 0x02, 0x46, 0x7F, 0x1B, 0x62, 0x26, 0x85
+  },
+  {
+    0xE6, 0x2B, 0x62, 0x2A, 0xC8, 0xA2, 0x13, 0x66,
+    0xBF, 0x2D, 0xED, 0x30, 0xF4, 0x08, 0x2A, 0x53,
+    0xE7, 0x7A, 0x9A, 0xA6, 0x96, 0xB1, 0xF3, 0xEE,
+    0x8C, 0xFE, 0x99, 0xC5, 0x93, 0x12, 0xD9, 0xC7
+  },
+  {
+    0x3D, 0x39, 0xFF, 0xA8, 0x55, 0x12, 0xC3, 0xC8,
+    0x89, 0x0D, 0x4B, 0xDF, 0x31, 0x88, 0x9C, 0xA6,
+    0x6E, 0x5C, 0xEC, 0xB6, 0x3C, 0xFE, 0xED, 0x57,
+    0xB9, 0x26, 0x37, 0x08, 0xE7, 0x4C, 0x55, 0x0B
+  },
+  {
+    0xB1, 0x70, 0x3B, 0x8A, 0x00, 0xE2, 0x61, 0x24,
+    0x97, 0xD1, 0x1C, 0x64, 0x9D, 0x15, 0x0A, 0x6C,
+    0x96, 0x3B, 0xF4, 0xFD, 0x38, 0xFE, 0xB1, 0xC3,
+    0x81, 0xFE, 0x0D, 0x9B, 0x04, 0xC0, 0x2B, 0x22
+  },
+  {
+    0x12, 0xFB, 0xAD, 0x9D, 0x37, 0x82, 0x81, 0x2D,
+    0x71, 0x17, 0x9A, 0x50, 0xFB, 0xD9, 0xB4, 0x56,
+    0x6C, 0x7B, 0x06, 0xF5, 0xD7, 0x7C, 0x6F, 0x32,
+    0x97, 0x17, 0xFB, 0x4A, 0xE2, 0xC5, 0xB4, 0xEC
+  },
+  {
+    0x76, 0x8B, 0x65, 0x9A, 0x82, 0x4B, 0x43, 0xF9,
+    0xCA, 0x56, 0x60, 0xB9, 0xDD, 0xF0, 0x5F, 0x8B,
+    0xA2, 0xBC, 0x49, 0x93, 0x86, 0x6B, 0x7C, 0x9B,
+    0xE6, 0x87, 0x91, 0xF5, 0xB2, 0x46, 0x44, 0xB3
+  },
+  {
+    0xC0, 0x20, 0x4E, 0x23, 0xCA, 0x86, 0xBE, 0x20,
+    0x5E, 0xED, 0x0C, 0xC3, 0xDD, 0x72, 0x25, 0xCE,
+    0x5F, 0xFE, 0x1E, 0xE1, 0x2D, 0xAC, 0xB9, 0x3C,
+    0x5D, 0x06, 0x29, 0xB7, 0x69, 0x9C, 0xD7, 0x33
+  },
+  {
+    0xF4, 0x32, 0x96, 0x96, 0x1F, 0x8E, 0xAE, 0xCC,
+    0xD8, 0x54, 0x41, 0x3D, 0xC5, 0xAD, 0xDA, 0x62,
+    0x39, 0x3A, 0x34, 0x46, 0x27, 0xE8, 0x6C, 0x06,
+    0x6E, 0x79, 0x07, 0x55, 0x00, 0x40, 0x74, 0x4F
+  },
+  {
+    0x82, 0xF4, 0x46, 0x9E, 0x80, 0x78, 0x90, 0x21,
+    0xC6, 0x1D, 0xB7, 0xE3, 0x2F, 0x36, 0xAC, 0xBE,
+    0x59, 0x1A, 0x64, 0xF2, 0x60, 0x59, 0x26, 0x57,
+    0x70, 0xAE, 0x65, 0x8D, 0x62, 0xBD, 0xE7, 0xEF
+  },
+  {
+    0x2A, 0x85, 0x67, 0x1A, 0x55, 0xC8, 0x9F, 0xA1,
+    0x56, 0xE2, 0x96, 0xF7, 0x5D, 0xF1, 0xC7, 0xDB,
+    0xAB, 0x17, 0x8E, 0xBB, 0xA6, 0x52, 0x04, 0xA7,
+    0xE8, 0x17, 0x8C, 0x91, 0x6A, 0xD0, 0x87, 0xF8
+  },
+  {
+    0x33, 0xE2, 0x45, 0x00, 0x28, 0x08, 0xF6, 0x93,
+    0x4B, 0x9B, 0xE3, 0xA6, 0xFA, 0x8E, 0x86, 0x70,
+    0xC9, 0x0B, 0xAA, 0x62, 0x57, 0x17, 0xB9, 0x20,
+    0x1E, 0xB9, 0xB9, 0xDD, 0x91, 0x2F, 0x5C, 0xE2
+  },
+  {
+    0x58, 0xEE, 0x5E, 0x79, 0x91, 0x84, 0xAD, 0x9D,
+    0xA9, 0xA1, 0x7C, 0x5B, 0x46, 0xA4, 0x81, 0x0E,
+    0x28, 0xBD, 0xD0, 0x8C, 0x35, 0x81, 0x63, 0x4C,
+    0x83, 0x50, 0x30, 0x53, 0x9B, 0x79, 0x54, 0x4D
+  },
+  {
+    0x26, 0xD8, 0xFA, 0x08, 0xDB, 0x30, 0x8E, 0xDF,
+    0x2F, 0x96, 0xF8, 0x2A, 0xF6, 0xB6, 0x0C, 0x17,
+    0xD8, 0xF1, 0xFF, 0x85, 0x8C, 0x52, 0xF2, 0xD0,
+    0xF3, 0x83, 0x10, 0x78, 0x12, 0x75, 0x26, 0xA3
+  },
+  {
+    0x25, 0xA5, 0x8D, 0xF4, 0x03, 0x92, 0x47, 0xA2,
+    0x2F, 0x68, 0xFF, 0x2B, 0x71, 0x76, 0x6B, 0x7B,
+    0x56, 0x00, 0xDD, 0xF4, 0x01, 0xD9, 0x9F, 0xF2,
+    0xC1, 0x95, 0x5A, 0xE7, 0xBB, 0x43, 0xE5, 0x6A
+  },
+  {
+    0xBE, 0x43, 0xE8, 0x68, 0x61, 0x60, 0xE9, 0x07,
+    0xBA, 0x54, 0x7D, 0x5A, 0x87, 0x9D, 0x10, 0xF7,
+    0x88, 0xAF, 0xC8, 0x42, 0xB8, 0xEB, 0xB9, 0xF3,
+    0xF7, 0x88, 0x53, 0x25, 0x15, 0x91, 0x2A, 0xE4
+  },
+  {
+    0xAA, 0x4A, 0xCB, 0x95, 0xD8, 0x79, 0x19, 0x2A,
+    0x69, 0x08, 0xE8, 0x8A, 0xE3, 0xD6, 0x58, 0x9F,
+    0x4E, 0x3E, 0xB3, 0xD4, 0xE0, 0x3A, 0x80, 0x6C,
+    0xCD, 0xB9, 0xB5, 0xD6, 0xA9, 0x58, 0x6F, 0xDF
+  },
+  {
+    0x84, 0x66, 0xD5, 0xE4, 0x4C, 0xE9, 0x5B, 0x4F,
+    0xA1, 0x79, 0x99, 0x24, 0x44, 0xB8, 0xC2, 0x48,
+    0x5B, 0x88, 0x64, 0x48, 0xA6, 0xDC, 0xCF, 0xCF,
+    0x0B, 0xC3, 0x0B, 0xC5, 0xF0, 0xF5, 0x6B, 0x01
+  },
+  {
+    0x00, 0x56, 0xD7, 0xE0, 0xAC, 0x33, 0x35, 0x57,
+    0x83, 0x65, 0x9B, 0x38, 0xEC, 0x8B, 0xEC, 0xCB,
+    0xF7, 0x83, 0x93, 0x99, 0x67, 0xFE, 0x37, 0xAE,
+    0xAC, 0xF3, 0x69, 0xDD, 0xB6, 0x70, 0xAD, 0xA0
+  },
+  {
+    0x90, 0x4F, 0x42, 0xF3, 0x45, 0x53, 0x0A, 0xC8,
+    0xA3, 0x52, 0xD0, 0x9B, 0x68, 0x72, 0xC5, 0xBC,
+    0xA3, 0x66, 0x1A, 0xBC, 0xA6, 0xCA, 0x64, 0xC8,
+    0x09, 0x9F, 0x2F, 0xB6, 0x86, 0x7C, 0x30, 0xFE
+  },
+  {
+    0xA8, 0xC3, 0xBF, 0x46, 0xF0, 0xB8, 0x8B, 0xBD,
+    0x16, 0xFD, 0xA4, 0xA8, 0xB5, 0xCA, 0x81, 0xF5,
+    0x24, 0x35, 0x20, 0xC3, 0x85, 0xD3, 0x8C, 0x0B,
+    0x4D, 0x23, 0x52, 0xAB, 0x34, 0xEA, 0x35, 0xE6
+  },
+  {
+    0x8D, 0x33, 0x17, 0xFC, 0x60, 0x6E, 0x56, 0x6D,
+    0x30, 0x2E, 0xDA, 0xB5, 0x5E, 0x80, 0x16, 0x11,
+    0xD8, 0xC1, 0x3F, 0x4A, 0x9A, 0x19, 0xD1, 0x85,
+    0x97, 0x8D, 0xEF, 0x72, 0x83, 0x9C, 0xDA, 0xA3
+  },
+  {
+    0x97, 0x38, 0x80, 0x11, 0xF5, 0x7A, 0x49, 0x86,
+    0x90, 0xEC, 0x79, 0x88, 0xEF, 0xF9, 0x03, 0xFF,
+    0x9B, 0x23, 0x58, 0xF5, 0xB6, 0x1B, 0xAA, 0x20,
+    0xF7, 0x32, 0x90, 0xD6, 0x29, 0x6C, 0x1C, 0x0B
+  },
+  {
+    0xCF, 0xB8, 0x0C, 0xAB, 0x89, 0x90, 0x95, 0x08,
+    0x09, 0x12, 0x3F, 0xBF, 0x85, 0xE9, 0x76, 0x45,
+    0x47, 0x08, 0xE0, 0xAF, 0xED, 0x69, 0x8E, 0x33,
+    0x52, 0xA3, 0x16, 0x35, 0x90, 0x9D, 0xB3, 0xE5
+  },
+  {
+    0x0D, 0xAA, 0xCA, 0x55, 0x13, 0x2A, 0x23, 0x5B,
+    0x83, 0x1A, 0x5E, 0xFF, 0x4E, 0xA4, 0x67, 0xCD,
+    0x10, 0xAF, 0x44, 0x20, 0x08, 0x47, 0x73, 0x5A,
+    0x1F, 0xFD, 0x51, 0xFA, 0x37, 0xEA, 0xA2, 0xA2
+  },
+  {
+    0x69, 0xB2, 0x14, 0x97, 0xEB, 0xB8, 0x24, 0xBA,
+    0x66, 0x53, 0x68, 0x18, 0x88, 0x25, 0xE6, 0xF6,
+    0xF1, 0x4C, 0xF2, 0xC3, 0xF7, 0xB5, 0x53, 0x0B,
+    0xB3, 0x4F, 0xA6, 0x58, 0xEE, 0xD9, 0xA7, 0x39
+  },
+  {
+    0xB9, 0xA1, 0x9F, 0x50, 0x9B, 0xE0, 0x3F, 0xBC,
+    0x40, 0xE2, 0x43, 0xA5, 0x8A, 0x3D, 0xED, 0x11,
+    0xF0, 0xD5, 0x1F, 0x80, 0xE3, 0xE2, 0x9A, 0x50,
+    0x56, 0x44, 0xCC, 0x05, 0x74, 0x38, 0x14, 0xEC
+  },
+  {
+    0xC4, 0xBC, 0xB2, 0x00, 0x25, 0x55, 0xD5, 0x44,
+    0xFD, 0x0B, 0x02, 0x77, 0x06, 0x23, 0x89, 0x1E,
+    0x70, 0xEE, 0xEC, 0x77, 0x44, 0x86, 0x5D, 0xD6,
+    0x45, 0x5A, 0xD6, 0x65, 0xCC, 0x82, 0xE8, 0x61
+  },
+  {
+    0x91, 0x2D, 0x24, 0xDC, 0x3D, 0x69, 0x23, 0xA4,
+    0x83, 0xC2, 0x63, 0xEB, 0xA8, 0x1B, 0x7A, 0x87,
+    0x97, 0xF2, 0x3C, 0xBF, 0x2F, 0x78, 0xB5, 0x1E,
+    0x22, 0x26, 0x63, 0x9F, 0x84, 0xA5, 0x90, 0x47
+  },
+  {
+    0x56, 0x82, 0x7A, 0x18, 0x88, 0x3A, 0xFD, 0xF9,
+    0xCE, 0xEC, 0x56, 0x2B, 0x20, 0x66, 0xD8, 0xAC,
+    0xB2, 0xC1, 0x95, 0x05, 0xEC, 0xE6, 0xF7, 0xA8,
+    0x3E, 0x9F, 0x33, 0x46, 0xCB, 0xB8, 0x28, 0xC9
+  },
+  {
+    0x25, 0x1D, 0x8D, 0x09, 0xFC, 0x48, 0xDD, 0x1D,
+    0x6A, 0xF8, 0xFF, 0xDF, 0x39, 0x50, 0x91, 0xA4,
+    0x6E, 0x05, 0xB8, 0xB7, 0xC5, 0xEC, 0x0C, 0x79,
+    0xB6, 0x8A, 0x89, 0x04, 0xC8, 0x27, 0xBD, 0xEA
+  },
+  {
+    0xC2, 0xD1, 0x4D, 0x69, 0xFD, 0x0B, 0xBD, 0x1C,
+    0x0F, 0xE8, 0xC8, 0x45, 0xD5, 0xFD, 0x6A, 0x8F,
+    0x74, 0x01, 0x51, 0xB1, 0xD8, 0xEB, 0x4D, 0x26,
+    0x36, 0x4B, 0xB0, 0x2D, 0xAE, 0x0C, 0x13, 0xBC
+  },
+  {
+    0x2E, 0x5F, 0xE2, 0x1F, 0x8F, 0x1B, 0x63, 0x97,
+    0xA3, 0x8A, 0x60, 0x3D, 0x60, 0xB6, 0xF5, 0x3C,
+    0x3B, 0x5D, 0xB2, 0x0A, 0xA5, 0x6C, 0x6D, 0x44,
+    0xBE, 0xBD, 0x48, 0x28, 0xCE, 0x28, 0xF9, 0x0F
+  },
+  {
+    0x25, 0x05, 0x9F, 0x10, 0x60, 0x5E, 0x67, 0xAD,
+    0xFE, 0x68, 0x13, 0x50, 0x66, 0x6E, 0x15, 0xAE,
+    0x97, 0x6A, 0x5A, 0x57, 0x1C, 0x13, 0xCF, 0x5B,
+    0xC8, 0x05, 0x3F, 0x43, 0x0E, 0x12, 0x0A, 0x52
+  },
+};
+
+static const uint8_t blake2sp_keyed_kat[BLAKE2_KAT_LENGTH][BLAKE2S_OUTBYTES] =
+{
+  {
+    0x71, 0x5C, 0xB1, 0x38, 0x95, 0xAE, 0xB6, 0x78,
+    0xF6, 0x12, 0x41, 0x60, 0xBF, 0xF2, 0x14, 0x65,
+    0xB3, 0x0F, 0x4F, 0x68, 0x74, 0x19, 0x3F, 0xC8,
+    0x51, 0xB4, 0x62, 0x10, 0x43, 0xF0, 0x9C, 0xC6
+  },
+  {
+    0x40, 0x57, 0x8F, 0xFA, 0x52, 0xBF, 0x51, 0xAE,
+    0x18, 0x66, 0xF4, 0x28, 0x4D, 0x3A, 0x15, 0x7F,
+    0xC1, 0xBC, 0xD3, 0x6A, 0xC1, 0x3C, 0xBD, 0xCB,
+    0x03, 0x77, 0xE4, 0xD0, 0xCD, 0x0B, 0x66, 0x03
+  },
+  {
+    0x67, 0xE3, 0x09, 0x75, 0x45, 0xBA, 0xD7, 0xE8,
+    0x52, 0xD7, 0x4D, 0x4E, 0xB5, 0x48, 0xEC, 0xA7,
+    0xC2, 0x19, 0xC2, 0x02, 0xA7, 0xD0, 0x88, 0xDB,
+    0x0E, 0xFE, 0xAC, 0x0E, 0xAC, 0x30, 0x42, 0x49
+  },
+  {
+    0x8D, 0xBC, 0xC0, 0x58, 0x9A, 0x3D, 0x17, 0x29,
+    0x6A, 0x7A, 0x58, 0xE2, 0xF1, 0xEF, 0xF0, 0xE2,
+    0xAA, 0x42, 0x10, 0xB5, 0x8D, 0x1F, 0x88, 0xB8,
+    0x6D, 0x7B, 0xA5, 0xF2, 0x9D, 0xD3, 0xB5, 0x83
+  },
+  {
+    0xA9, 0xA9, 0x65, 0x2C, 0x8C, 0x67, 0x75, 0x94,
+    0xC8, 0x72, 0x12, 0xD8, 0x9D, 0x5A, 0x75, 0xFB,
+    0x31, 0xEF, 0x4F, 0x47, 0xC6, 0x58, 0x2C, 0xDE,
+    0x5F, 0x1E, 0xF6, 0x6B, 0xD4, 0x94, 0x53, 0x3A
+  },
+  {
+    0x05, 0xA7, 0x18, 0x0E, 0x59, 0x50, 0x54, 0x73,
+    0x99, 0x48, 0xC5, 0xE3, 0x38, 0xC9, 0x5F, 0xE0,
+    0xB7, 0xFC, 0x61, 0xAC, 0x58, 0xA7, 0x35, 0x74,
+    0x74, 0x56, 0x33, 0xBB, 0xC1, 0xF7, 0x70, 0x31
+  },
+  {
+    0x81, 0x4D, 0xE8, 0x31, 0x53, 0xB8, 0xD7, 0x5D,
+    0xFA, 0xDE, 0x29, 0xFD, 0x39, 0xAC, 0x72, 0xDD,
+    0x09, 0xCA, 0x0F, 0x9B, 0xC8, 0xB7, 0xAB, 0x6A,
+    0x06, 0xBA, 0xEE, 0x7D, 0xD0, 0xF9, 0xF0, 0x83
+  },
+  {
+    0xDF, 0xD4, 0x19, 0x44, 0x91, 0x29, 0xFF, 0x60,
+    0x4F, 0x0A, 0x14, 0x8B, 0x4C, 0x7D, 0x68, 0xF1,
+    0x17, 0x4F, 0x7D, 0x0F, 0x8C, 0x8D, 0x2C, 0xE7,
+    0x7F, 0x44, 0x8F, 0xD3, 0x41, 0x9C, 0x6F, 0xB0
+  },
+  {
+    0xB9, 0xED, 0x22, 0xE7, 0xDD, 0x8D, 0xD1, 0x4E,
+    0xE8, 0xC9, 0x5B, 0x20, 0xE7, 0x63, 0x2E, 0x85,
+    0x53, 0xA2, 0x68, 0xD9, 0xFF, 0x86, 0x33, 0xED,
+    0x3C, 0x21, 0xD1, 0xB8, 0xC9, 0xA7, 0x0B, 0xE1
+  },
+  {
+    0x95, 0xF0, 0x31, 0x67, 0x1A, 0x4E, 0x3C, 0x54,
+    0x44, 0x1C, 0xEE, 0x9D, 0xBE, 0xF4, 0xB7, 0xAC,
+    0xA4, 0x46, 0x18, 0xA3, 0xA3, 0x33, 0xAD, 0x74,
+    0x06, 0xD1, 0x97, 0xAC, 0x5B, 0xA0, 0x79, 0x1A
+  },
+  {
+    0xE2, 0x92, 0x5B, 0x9D, 0x5C, 0xA0, 0xFF, 0x62,
+    0x88, 0xC5, 0xEA, 0x1A, 0xF2, 0xD2, 0x2B, 0x0A,
+    0x6B, 0x79, 0xE2, 0xDA, 0xE0, 0x8B, 0xFD, 0x36,
+    0xC3, 0xBE, 0x10, 0xBB, 0x8D, 0x71, 0xD8, 0x39
+  },
+  {
+    0x16, 0x24, 0x9C, 0x74, 0x4E, 0x49, 0x51, 0x45,
+    0x1D, 0x4C, 0x89, 0x4F, 0xB5, 0x9A, 0x3E, 0xCB,
+    0x3F, 0xBF, 0xB7, 0xA4, 0x5F, 0x96, 0xF8, 0x5D,
+    0x15, 0x80, 0xAC, 0x0B, 0x84, 0x2D, 0x96, 0xDA
+  },
+  {
+    0x43, 0x2B, 0xC9, 0x1C, 0x52, 0xAC, 0xEB, 0x9D,
+    0xAE, 0xD8, 0x83, 0x28, 0x81, 0x64, 0x86, 0x50,
+    0xC1, 0xB8, 0x1D, 0x11, 0x7A, 0xBD, 0x68, 0xE0,
+    0x84, 0x51, 0x50, 0x8A, 0x63, 0xBE, 0x00, 0x81
+  },
+  {
+    0xCD, 0xE8, 0x20, 0x2B, 0xCF, 0xA3, 0xF3, 0xE9,
+    0x5D, 0x79, 0xBA, 0xCC, 0x16, 0x5D, 0x52, 0x70,
+    0x0E, 0xF7, 0x1D, 0x87, 0x4A, 0x3C, 0x63, 0x7E,
+    0x63, 0x4F, 0x64, 0x44, 0x73, 0x72, 0x0D, 0x6B
+  },
+  {
+    0x16, 0x21, 0x62, 0x1F, 0x5C, 0x3E, 0xE4, 0x46,
+    0x89, 0x9D, 0x3C, 0x8A, 0xAE, 0x49, 0x17, 0xB1,
+    0xE6, 0xDB, 0x4A, 0x0E, 0xD0, 0x42, 0x31, 0x5F,
+    0xB2, 0xC1, 0x74, 0x82, 0x5E, 0x0A, 0x18, 0x19
+  },
+  {
+    0x33, 0x6E, 0x8E, 0xBC, 0x71, 0xE2, 0x09, 0x5C,
+    0x27, 0xF8, 0x64, 0xA3, 0x12, 0x1E, 0xFD, 0x0F,
+    0xAA, 0x7A, 0x41, 0x28, 0x57, 0x25, 0xA5, 0x92,
+    0xF6, 0x1B, 0xED, 0xED, 0x9D, 0xDE, 0x86, 0xED
+  },
+  {
+    0x07, 0x9B, 0xE0, 0x41, 0x0E, 0x78, 0x9B, 0x36,
+    0xEE, 0x7F, 0x55, 0xC1, 0x9F, 0xAA, 0xC6, 0x91,
+    0x65, 0x6E, 0xB0, 0x52, 0x1F, 0x42, 0x94, 0x9B,
+    0x84, 0xEE, 0x29, 0xFE, 0x2A, 0x0E, 0x7F, 0x36
+  },
+  {
+    0x17, 0x27, 0x0C, 0x4F, 0x34, 0x88, 0x08, 0x2D,
+    0x9F, 0xF9, 0x93, 0x7E, 0xAB, 0x3C, 0xA9, 0x9C,
+    0x97, 0xC5, 0xB4, 0x59, 0x61, 0x47, 0x37, 0x2D,
+    0xD4, 0xE9, 0x8A, 0xCF, 0x13, 0xDB, 0x28, 0x10
+  },
+  {
+    0x18, 0x3C, 0x38, 0x75, 0x4D, 0x03, 0x41, 0xCE,
+    0x07, 0xC1, 0x7A, 0x6C, 0xB6, 0xC2, 0xFD, 0x8B,
+    0xBC, 0xC1, 0x40, 0x4F, 0xDD, 0x01, 0x41, 0x99,
+    0xC7, 0x8B, 0xE1, 0xA9, 0x75, 0x59, 0xA9, 0x28
+  },
+  {
+    0x6E, 0x52, 0xD7, 0x28, 0xA4, 0x05, 0xA6, 0xE1,
+    0xF8, 0x75, 0x87, 0xBB, 0xC2, 0xAC, 0x91, 0xC5,
+    0xC0, 0x9B, 0x2D, 0x82, 0x8A, 0xC8, 0x1E, 0x5C,
+    0x4A, 0x81, 0xD0, 0x3D, 0xD4, 0xAA, 0x8D, 0x5C
+  },
+  {
+    0xF4, 0xE0, 0x8E, 0x05, 0x9B, 0x74, 0x14, 0x4B,
+    0xF9, 0x48, 0x14, 0x6D, 0x14, 0xA2, 0xC8, 0x1E,
+    0x46, 0xDC, 0x15, 0xFF, 0x26, 0xEB, 0x52, 0x34,
+    0x4C, 0xDD, 0x47, 0x4A, 0xBE, 0xA1, 0x4B, 0xC0
+  },
+  {
+    0x0F, 0x2E, 0x0A, 0x10, 0x0E, 0xD8, 0xA1, 0x17,
+    0x85, 0x96, 0x2A, 0xD4, 0x59, 0x6A, 0xF9, 0x55,
+    0xE3, 0x0B, 0x9A, 0xEF, 0x93, 0x0A, 0x24, 0x8D,
+    0xA9, 0x32, 0x2B, 0x70, 0x2D, 0x4B, 0x68, 0x72
+  },
+  {
+    0x51, 0x90, 0xFC, 0xC7, 0x32, 0xF4, 0x04, 0xAA,
+    0xD4, 0x36, 0x4A, 0xC7, 0x96, 0x0C, 0xFD, 0x5B,
+    0x4E, 0x34, 0x86, 0x29, 0xC3, 0x72, 0xEE, 0xB3,
+    0x25, 0xB5, 0xC6, 0xC7, 0xCB, 0xCE, 0x59, 0xAB
+  },
+  {
+    0xC0, 0xC4, 0xCB, 0x86, 0xEA, 0x25, 0xEA, 0x95,
+    0x7E, 0xEC, 0x5B, 0x22, 0xD2, 0x55, 0x0A, 0x16,
+    0x49, 0xE6, 0xDF, 0xFA, 0x31, 0x6B, 0xB8, 0xF4,
+    0xC9, 0x1B, 0x8F, 0xF7, 0xA2, 0x4B, 0x25, 0x31
+  },
+  {
+    0x2C, 0x9E, 0xDA, 0x13, 0x5A, 0x30, 0xAE, 0xCA,
+    0xF3, 0xAC, 0xB3, 0xD2, 0x3A, 0x30, 0x35, 0xFB,
+    0xAB, 0xBA, 0x98, 0x33, 0x31, 0x65, 0xD8, 0x7F,
+    0xCB, 0xF8, 0xFE, 0x10, 0x33, 0x6E, 0xCF, 0x20
+  },
+  {
+    0x3C, 0xD6, 0x69, 0xE8, 0xD5, 0x62, 0x62, 0xA2,
+    0x37, 0x13, 0x67, 0x22, 0x4D, 0xAE, 0x6D, 0x75,
+    0x9E, 0xE1, 0x52, 0xC3, 0x15, 0x33, 0xB2, 0x63,
+    0xFA, 0x2E, 0x64, 0x92, 0x08, 0x77, 0xB2, 0xA7
+  },
+  {
+    0x18, 0xA9, 0xA0, 0xC2, 0xD0, 0xEA, 0x6C, 0x3B,
+    0xB3, 0x32, 0x83, 0x0F, 0x89, 0x18, 0xB0, 0x68,
+    0x4F, 0x5D, 0x39, 0x94, 0xDF, 0x48, 0x67, 0x46,
+    0x2D, 0xD0, 0x6E, 0xF0, 0x86, 0x24, 0x24, 0xCC
+  },
+  {
+    0x73, 0x90, 0xEA, 0x41, 0x04, 0xA9, 0xF4, 0xEE,
+    0xA9, 0x0F, 0x81, 0xE2, 0x6A, 0x12, 0x9D, 0xCF,
+    0x9F, 0x4A, 0xF3, 0x83, 0x52, 0xD9, 0xCB, 0x6A,
+    0x81, 0x2C, 0xC8, 0x05, 0x69, 0x09, 0x05, 0x0E
+  },
+  {
+    0xE4, 0x9E, 0x01, 0x14, 0xC6, 0x29, 0xB4, 0x94,
+    0xB1, 0x1E, 0xA9, 0x8E, 0xCD, 0x40, 0x32, 0x73,
+    0x1F, 0x15, 0x3B, 0x46, 0x50, 0xAC, 0xAC, 0xD7,
+    0xE0, 0xF6, 0xE7, 0xDE, 0x3D, 0xF0, 0x19, 0x77
+  },
+  {
+    0x27, 0xC5, 0x70, 0x2B, 0xE1, 0x04, 0xB3, 0xA9,
+    0x4F, 0xC4, 0x34, 0x23, 0xAE, 0xEE, 0x83, 0xAC,
+    0x3C, 0xA7, 0x3B, 0x7F, 0x87, 0x83, 0x9A, 0x6B,
+    0x2E, 0x29, 0x60, 0x79, 0x03, 0xB7, 0xF2, 0x87
+  },
+  {
+    0x81, 0xD2, 0xE1, 0x2E, 0xB2, 0xF4, 0x27, 0x60,
+    0xC6, 0xE3, 0xBA, 0xA7, 0x8F, 0x84, 0x07, 0x3A,
+    0xE6, 0xF5, 0x61, 0x60, 0x70, 0xFE, 0x25, 0xBE,
+    0xDE, 0x7C, 0x7C, 0x82, 0x48, 0xAB, 0x1F, 0xBA
+  },
+  {
+    0xFA, 0xB2, 0x35, 0xD5, 0x93, 0x48, 0xAB, 0x8C,
+    0xE4, 0x9B, 0xEC, 0x77, 0xC0, 0xF1, 0x93, 0x28,
+    0xFD, 0x04, 0x5D, 0xFD, 0x60, 0x8A, 0x53, 0x03,
+    0x36, 0xDF, 0x4F, 0x94, 0xE1, 0x72, 0xA5, 0xC8
+  },
+  {
+    0x8A, 0xAA, 0x8D, 0x80, 0x5C, 0x58, 0x88, 0x1F,
+    0xF3, 0x79, 0xFB, 0xD4, 0x2C, 0x6B, 0xF6, 0xF1,
+    0x4C, 0x6C, 0x73, 0xDF, 0x80, 0x71, 0xB3, 0xB2,
+    0x28, 0x98, 0x11, 0x09, 0xCC, 0xC0, 0x15, 0xF9
+  },
+  {
+    0x91, 0xFD, 0xD2, 0x62, 0x20, 0x39, 0x16, 0x39,
+    0x47, 0x40, 0x95, 0x2B, 0xCE, 0x72, 0xB6, 0x4B,
+    0xAB, 0xB6, 0xF7, 0x21, 0x34, 0x4D, 0xEE, 0x82,
+    0x50, 0xBF, 0x0E, 0x46, 0xF1, 0xBA, 0x18, 0x8F
+  },
+  {
+    0xF7, 0xE5, 0x7B, 0x8F, 0x85, 0xF4, 0x7D, 0x59,
+    0x03, 0xAD, 0x4C, 0xCB, 0x8A, 0xF6, 0x2A, 0x3E,
+    0x85, 0x8A, 0xAB, 0x2B, 0x8C, 0xC2, 0x26, 0x49,
+    0x4F, 0x7B, 0x00, 0xBE, 0xDB, 0xF5, 0xB0, 0xD0
+  },
+  {
+    0xF7, 0x6F, 0x21, 0xAD, 0xDA, 0xE9, 0x6A, 0x96,
+    0x46, 0xFC, 0x06, 0xF9, 0xBF, 0x52, 0xAE, 0x08,
+    0x48, 0xF1, 0x8C, 0x35, 0x26, 0xB1, 0x29, 0xE1,
+    0x5B, 0x2C, 0x35, 0x5E, 0x2E, 0x79, 0xE5, 0xDA
+  },
+  {
+    0x8A, 0xEB, 0x1C, 0x79, 0x5F, 0x34, 0x90, 0x01,
+    0x5E, 0xF4, 0xCD, 0x61, 0xA2, 0x80, 0x7B, 0x23,
+    0x0E, 0xFD, 0xC8, 0x46, 0x01, 0x73, 0xDA, 0xD0,
+    0x26, 0xA4, 0xA0, 0xFC, 0xC2, 0xFB, 0xF2, 0x2A
+  },
+  {
+    0xC5, 0x64, 0xFF, 0xC6, 0x23, 0x07, 0x77, 0x65,
+    0xBB, 0x97, 0x87, 0x58, 0x56, 0x54, 0xCE, 0x74,
+    0x5D, 0xBD, 0x10, 0x8C, 0xEF, 0x24, 0x8A, 0xB0,
+    0x0A, 0xD1, 0xA2, 0x64, 0x7D, 0x99, 0x03, 0x87
+  },
+  {
+    0xFE, 0x89, 0x42, 0xA3, 0xE5, 0xF5, 0xE8, 0xCD,
+    0x70, 0x51, 0x04, 0xF8, 0x82, 0x10, 0x72, 0x6E,
+    0x53, 0xDD, 0x7E, 0xB3, 0xF9, 0xA2, 0x02, 0xBF,
+    0x93, 0x14, 0xB3, 0xB9, 0x06, 0x5E, 0xB7, 0x12
+  },
+  {
+    0xDC, 0x29, 0x53, 0x59, 0xD4, 0x36, 0xEE, 0xA7,
+    0x80, 0x84, 0xE7, 0xB0, 0x77, 0xFE, 0x09, 0xB1,
+    0x9C, 0x5B, 0xF3, 0xD2, 0xA7, 0x96, 0xDA, 0xB0,
+    0x19, 0xE4, 0x20, 0x05, 0x99, 0xFD, 0x82, 0x02
+  },
+  {
+    0x70, 0xB3, 0xF7, 0x2F, 0x74, 0x90, 0x32, 0xE2,
+    0x5E, 0x38, 0x3B, 0x96, 0x43, 0x78, 0xEA, 0x1C,
+    0x54, 0x3E, 0x9C, 0x15, 0xDE, 0x3A, 0x27, 0xD8,
+    0x6D, 0x2A, 0x9D, 0x22, 0x31, 0xEF, 0xF4, 0x8A
+  },
+  {
+    0x79, 0x82, 0xB5, 0x4C, 0x08, 0xDB, 0x2B, 0xFB,
+    0x6F, 0x45, 0xF3, 0x5B, 0xC3, 0x23, 0xBC, 0x09,
+    0x37, 0x79, 0xB6, 0xBB, 0x0E, 0x3E, 0xEA, 0x3E,
+    0x8C, 0x98, 0xB1, 0xDE, 0x99, 0xD3, 0xC5, 0x5E
+  },
+  {
+    0x75, 0xE4, 0x16, 0x22, 0x57, 0x01, 0x4B, 0xED,
+    0xCC, 0x05, 0xC2, 0x94, 0x4D, 0xCE, 0x0D, 0xF0,
+    0xC3, 0x5E, 0xBA, 0x13, 0x19, 0x54, 0x06, 0x4F,
+    0x6E, 0x4E, 0x09, 0x5F, 0xD0, 0x84, 0x45, 0xEE
+  },
+  {
+    0x4A, 0x12, 0x9E, 0xA6, 0xCD, 0xBA, 0xBC, 0x2D,
+    0x39, 0x24, 0x79, 0x37, 0x2F, 0x97, 0x5B, 0x9C,
+    0xF5, 0xA1, 0xB7, 0xDE, 0xB6, 0x9A, 0x32, 0x66,
+    0xF0, 0x3E, 0xBC, 0x6D, 0x11, 0x13, 0x93, 0xC4
+  },
+  {
+    0x8F, 0xED, 0x70, 0xF2, 0x79, 0x55, 0xDC, 0x8A,
+    0xD9, 0xF1, 0xB7, 0xB3, 0xF6, 0xF5, 0xDF, 0xBD,
+    0x96, 0x2A, 0x33, 0x59, 0x2B, 0x42, 0xDE, 0x85,
+    0x6D, 0x42, 0x1E, 0x29, 0x12, 0xBA, 0xB8, 0x6B
+  },
+  {
+    0xE2, 0xF2, 0x06, 0x60, 0x37, 0x6F, 0x2B, 0x18,
+    0x39, 0x66, 0x7C, 0xBF, 0xE5, 0xE1, 0x6E, 0xF0,
+    0x75, 0xAC, 0x39, 0x43, 0x64, 0x4F, 0x35, 0x32,
+    0x28, 0x2F, 0x8B, 0xB0, 0x72, 0x3B, 0x99, 0x86
+  },
+  {
+    0xAB, 0xF8, 0x4C, 0x91, 0x3A, 0x83, 0xDF, 0x98,
+    0xC7, 0x00, 0x29, 0x81, 0x9C, 0x06, 0x5F, 0x6D,
+    0x6D, 0xE4, 0xF6, 0xD4, 0x3A, 0xBF, 0x60, 0x0D,
+    0xAD, 0xE0, 0x35, 0xB2, 0x3B, 0xED, 0x7B, 0xAA
+  },
+  {
+    0x45, 0x9C, 0x15, 0xD4, 0x85, 0x6C, 0x7E, 0xCF,
+    0x82, 0x62, 0x03, 0x51, 0xC3, 0xC1, 0xC7, 0x6C,
+    0x40, 0x3F, 0x3E, 0x97, 0x07, 0x74, 0x13, 0x87,
+    0xE2, 0x99, 0x07, 0x3F, 0xB1, 0x70, 0x4B, 0x2B
+  },
+  {
+    0x9A, 0xB9, 0x12, 0xED, 0xA0, 0x76, 0x8A, 0xBD,
+    0xF8, 0x26, 0xB6, 0xE0, 0x5D, 0x0D, 0x73, 0x58,
+    0x39, 0xE6, 0xA5, 0xF0, 0x2E, 0x04, 0xC4, 0xCC,
+    0x75, 0x65, 0x0B, 0x2C, 0x8C, 0xAB, 0x67, 0x49
+  },
+  {
+    0x47, 0x40, 0xEB, 0xEC, 0xAC, 0x90, 0x03, 0x1B,
+    0xB7, 0xE6, 0x8E, 0x51, 0xC5, 0x53, 0x91, 0xAF,
+    0xB1, 0x89, 0xB3, 0x17, 0xF2, 0xDE, 0x55, 0x87,
+    0x66, 0xF7, 0x8F, 0x5C, 0xB7, 0x1F, 0x81, 0xB6
+  },
+  {
+    0x3C, 0xC4, 0x7F, 0x0E, 0xF6, 0x48, 0x21, 0x58,
+    0x7C, 0x93, 0x7C, 0xDD, 0xBA, 0x85, 0xC9, 0x93,
+    0xD3, 0xCE, 0x2D, 0xD0, 0xCE, 0xD4, 0x0D, 0x3B,
+    0xE3, 0x3C, 0xB7, 0xDC, 0x7E, 0xDA, 0xBC, 0xF1
+  },
+  {
+    0x9F, 0x47, 0x6A, 0x22, 0xDB, 0x54, 0xD6, 0xBB,
+    0x9B, 0xEF, 0xDB, 0x26, 0x0C, 0x66, 0x57, 0x8A,
+    0xE1, 0xD8, 0xA5, 0xF8, 0x7D, 0x3D, 0x8C, 0x01,
+    0x7F, 0xDB, 0x74, 0x75, 0x08, 0x0F, 0xA8, 0xE1
+  },
+  {
+    0x8B, 0x68, 0xC6, 0xFB, 0x07, 0x06, 0xA7, 0x95,
+    0xF3, 0xA8, 0x39, 0xD6, 0xFE, 0x25, 0xFD, 0x4A,
+    0xA7, 0xF9, 0x2E, 0x66, 0x4F, 0x76, 0x2D, 0x61,
+    0x53, 0x81, 0xBC, 0x85, 0x9A, 0xFA, 0x29, 0x2C
+  },
+  {
+    0xF6, 0x40, 0xD2, 0x25, 0xA6, 0xBC, 0xD2, 0xFC,
+    0x8A, 0xCC, 0xAF, 0xBE, 0xD5, 0xA8, 0x4B, 0x5B,
+    0xBB, 0x5D, 0x8A, 0xE5, 0xDB, 0x06, 0xA1, 0x0B,
+    0x6D, 0x9D, 0x93, 0x16, 0x0B, 0x39, 0x2E, 0xE0
+  },
+  {
+    0x70, 0x48, 0x60, 0xA7, 0xF5, 0xBA, 0x68, 0xDB,
+    0x27, 0x03, 0x1C, 0x15, 0xF2, 0x25, 0x50, 0x0D,
+    0x69, 0x2A, 0xB2, 0x47, 0x53, 0x42, 0x81, 0xC4,
+    0xF6, 0x84, 0xF6, 0xC6, 0xC8, 0xCD, 0x88, 0xC7
+  },
+  {
+    0xC1, 0xA7, 0x5B, 0xDD, 0xA1, 0x2B, 0x8B, 0x2A,
+    0xB1, 0xB9, 0x24, 0x84, 0x38, 0x58, 0x18, 0x3A,
+    0x09, 0xD2, 0x02, 0x42, 0x1F, 0xDB, 0xCD, 0xF0,
+    0xE6, 0x3E, 0xAE, 0x46, 0xF3, 0x7D, 0x91, 0xED
+  },
+  {
+    0x9A, 0x8C, 0xAB, 0x7A, 0x5F, 0x2E, 0x57, 0x62,
+    0x21, 0xA6, 0xA8, 0x5E, 0x5F, 0xDD, 0xEE, 0x75,
+    0x67, 0x8E, 0x06, 0x53, 0x24, 0xA6, 0x1D, 0xB0,
+    0x3A, 0x39, 0x26, 0x1D, 0xDF, 0x75, 0xE3, 0xF4
+  },
+  {
+    0x05, 0xC2, 0xB2, 0x6B, 0x03, 0xCE, 0x6C, 0xA5,
+    0x87, 0x1B, 0xE0, 0xDE, 0x84, 0xEE, 0x27, 0x86,
+    0xA7, 0x9B, 0xCD, 0x9F, 0x30, 0x03, 0x3E, 0x81,
+    0x9B, 0x4A, 0x87, 0xCC, 0xA2, 0x7A, 0xFC, 0x6A
+  },
+  {
+    0xB0, 0xB0, 0x99, 0x3C, 0x6D, 0x0C, 0x6E, 0xD5,
+    0xC3, 0x59, 0x04, 0x80, 0xF8, 0x65, 0xF4, 0x67,
+    0xF4, 0x33, 0x1A, 0x58, 0xDD, 0x8E, 0x47, 0xBD,
+    0x98, 0xEB, 0xBC, 0xDB, 0x8E, 0xB4, 0xF9, 0x4D
+  },
+  {
+    0xE5, 0x7C, 0x10, 0x3C, 0xF7, 0xB6, 0xBB, 0xEB,
+    0x8A, 0x0D, 0xC8, 0xF0, 0x48, 0x62, 0x5C, 0x3F,
+    0x4C, 0xE4, 0xF1, 0xA5, 0xAD, 0x4D, 0x07, 0x9C,
+    0x11, 0x87, 0xBF, 0xE9, 0xEE, 0x3B, 0x8A, 0x5F
+  },
+  {
+    0xF1, 0x00, 0x23, 0xE1, 0x5F, 0x3B, 0x72, 0xB7,
+    0x38, 0xAD, 0x61, 0xAE, 0x65, 0xAB, 0x9A, 0x07,
+    0xE7, 0x77, 0x4E, 0x2D, 0x7A, 0xB0, 0x2D, 0xBA,
+    0x4E, 0x0C, 0xAF, 0x56, 0x02, 0xC8, 0x01, 0x78
+  },
+  {
+    0x9A, 0x8F, 0xB3, 0xB5, 0x38, 0xC1, 0xD6, 0xC4,
+    0x50, 0x51, 0xFA, 0x9E, 0xD9, 0xB0, 0x7D, 0x3E,
+    0x89, 0xB4, 0x43, 0x03, 0x30, 0x01, 0x4A, 0x1E,
+    0xFA, 0x28, 0x23, 0xC0, 0x82, 0x3C, 0xF2, 0x37
+  },
+  {
+    0x30, 0x75, 0xC5, 0xBC, 0x7C, 0x3A, 0xD7, 0xE3,
+    0x92, 0x01, 0x01, 0xBC, 0x68, 0x99, 0xC5, 0x8E,
+    0xA7, 0x01, 0x67, 0xA7, 0x77, 0x2C, 0xA2, 0x8E,
+    0x38, 0xE2, 0xC1, 0xB0, 0xD3, 0x25, 0xE5, 0xA0
+  },
+  {
+    0xE8, 0x55, 0x94, 0x70, 0x0E, 0x39, 0x22, 0xA1,
+    0xE8, 0xE4, 0x1E, 0xB8, 0xB0, 0x64, 0xE7, 0xAC,
+    0x6D, 0x94, 0x9D, 0x13, 0xB5, 0xA3, 0x45, 0x23,
+    0xE5, 0xA6, 0xBE, 0xAC, 0x03, 0xC8, 0xAB, 0x29
+  },
+  {
+    0x1D, 0x37, 0x01, 0xA5, 0x66, 0x1B, 0xD3, 0x1A,
+    0xB2, 0x05, 0x62, 0xBD, 0x07, 0xB7, 0x4D, 0xD1,
+    0x9A, 0xC8, 0xF3, 0x52, 0x4B, 0x73, 0xCE, 0x7B,
+    0xC9, 0x96, 0xB7, 0x88, 0xAF, 0xD2, 0xF3, 0x17
+  },
+  {
+    0x87, 0x4E, 0x19, 0x38, 0x03, 0x3D, 0x7D, 0x38,
+    0x35, 0x97, 0xA2, 0xA6, 0x5F, 0x58, 0xB5, 0x54,
+    0xE4, 0x11, 0x06, 0xF6, 0xD1, 0xD5, 0x0E, 0x9B,
+    0xA0, 0xEB, 0x68, 0x5F, 0x6B, 0x6D, 0xA0, 0x71
+  },
+  {
+    0x93, 0xF2, 0xF3, 0xD6, 0x9B, 0x2D, 0x36, 0x52,
+    0x95, 0x56, 0xEC, 0xCA, 0xF9, 0xF9, 0x9A, 0xDB,
+    0xE8, 0x95, 0xE1, 0x57, 0x22, 0x31, 0xE6, 0x49,
+    0xB5, 0x05, 0x84, 0xB5, 0xD7, 0xD0, 0x8A, 0xF8
+  },
+  {
+    0x06, 0xE0, 0x6D, 0x61, 0x0F, 0x2E, 0xEB, 0xBA,
+    0x36, 0x76, 0x82, 0x3E, 0x77, 0x44, 0xD7, 0x51,
+    0xAF, 0xF7, 0x30, 0x76, 0xED, 0x65, 0xF3, 0xCF,
+    0xF5, 0xE7, 0x2F, 0xD2, 0x27, 0x99, 0x9C, 0x77
+  },
+  {
+    0x8D, 0xF7, 0x57, 0xB3, 0xA1, 0xE0, 0xF4, 0x80,
+    0xFA, 0x76, 0xC7, 0xF3, 0x58, 0xED, 0x03, 0x98,
+    0xBE, 0x3F, 0x2A, 0x8F, 0x7B, 0x90, 0xEA, 0x8C,
+    0x80, 0x75, 0x99, 0xDE, 0xDA, 0x1D, 0x05, 0x34
+  },
+  {
+    0xEE, 0xC9, 0xC5, 0xC6, 0x3C, 0xC5, 0x16, 0x9D,
+    0x96, 0x7B, 0xB1, 0x62, 0x4E, 0x9E, 0xE5, 0xCE,
+    0xD9, 0x28, 0x97, 0x73, 0x6E, 0xFB, 0xD1, 0x57,
+    0x54, 0x8D, 0x82, 0xE8, 0x7C, 0xC7, 0x2F, 0x25
+  },
+  {
+    0xCC, 0x2B, 0x58, 0x32, 0xAD, 0x27, 0x2C, 0xC5,
+    0x5C, 0x10, 0xD4, 0xF8, 0xC7, 0xF8, 0xBB, 0x38,
+    0xE6, 0xE4, 0xEB, 0x92, 0x2F, 0x93, 0x86, 0x83,
+    0x0F, 0x90, 0xB1, 0xE3, 0xDA, 0x39, 0x37, 0xD5
+  },
+  {
+    0x36, 0x89, 0x85, 0xD5, 0x38, 0x7C, 0x0B, 0xFC,
+    0x92, 0x8A, 0xC2, 0x54, 0xFA, 0x6D, 0x16, 0x67,
+    0x3E, 0x70, 0x94, 0x75, 0x66, 0x96, 0x1B, 0x5F,
+    0xB3, 0x32, 0x5A, 0x58, 0x8A, 0xB3, 0x17, 0x3A
+  },
+  {
+    0xF1, 0xE4, 0x42, 0xAF, 0xB8, 0x72, 0x15, 0x1F,
+    0x81, 0x34, 0x95, 0x6C, 0x54, 0x8A, 0xE3, 0x24,
+    0x0D, 0x07, 0xE6, 0xE3, 0x38, 0xD4, 0xA7, 0xA6,
+    0xAF, 0x8D, 0xA4, 0x11, 0x9A, 0xB0, 0xE2, 0xB0
+  },
+  {
+    0xB0, 0x12, 0xC7, 0x54, 0x6A, 0x39, 0xC4, 0x0C,
+    0xAD, 0xEC, 0xE4, 0xE0, 0x4E, 0x7F, 0x33, 0xC5,
+    0x93, 0xAD, 0x18, 0x2E, 0xBC, 0x5A, 0x46, 0xD2,
+    0xDB, 0xF4, 0xAD, 0x1A, 0x92, 0xF5, 0x9E, 0x7B
+  },
+  {
+    0x6C, 0x60, 0x97, 0xCD, 0x20, 0x33, 0x09, 0x6B,
+    0x4D, 0xF3, 0x17, 0xDE, 0x8A, 0x90, 0x8B, 0x7D,
+    0x0C, 0x72, 0x94, 0x39, 0x0C, 0x5A, 0x39, 0x9C,
+    0x30, 0x1B, 0xF2, 0xA2, 0x65, 0x2E, 0x82, 0x62
+  },
+  {
+    0xBA, 0x83, 0xFE, 0xB5, 0x10, 0xB4, 0x9A, 0xDE,
+    0x4F, 0xAE, 0xFB, 0xE9, 0x42, 0x78, 0x1E, 0xAF,
+    0xD4, 0x1A, 0xD5, 0xD4, 0x36, 0x88, 0x85, 0x31,
+    0xB6, 0x88, 0x59, 0xF2, 0x2C, 0x2D, 0x16, 0x4A
+  },
+  {
+    0x5A, 0x06, 0x9E, 0x43, 0x92, 0x19, 0x5A, 0xC9,
+    0xD2, 0x84, 0xA4, 0x7F, 0x3B, 0xD8, 0x54, 0xAF,
+    0x8F, 0xD0, 0xD7, 0xFD, 0xC3, 0x48, 0x3D, 0x2C,
+    0x5F, 0x34, 0x24, 0xCC, 0xFD, 0xA1, 0x5C, 0x8E
+  },
+  {
+    0x7E, 0x88, 0xD6, 0x4B, 0xBB, 0xE2, 0x02, 0x4F,
+    0x44, 0x54, 0xBA, 0x13, 0x98, 0xB3, 0xD8, 0x65,
+    0x2D, 0xCE, 0xC8, 0x20, 0xB1, 0x4C, 0x3B, 0x0A,
+    0xBF, 0xBF, 0x0F, 0x4F, 0x33, 0x06, 0xBB, 0x5E
+  },
+  {
+    0xF8, 0x74, 0x2F, 0xF4, 0x6D, 0xFD, 0xF3, 0xEC,
+    0x82, 0x64, 0xF9, 0x94, 0x5B, 0x20, 0x41, 0x94,
+    0x62, 0xF0, 0x69, 0xE8, 0x33, 0xC5, 0x94, 0xEC,
+    0x80, 0xFF, 0xAC, 0x5E, 0x7E, 0x51, 0x34, 0xF9
+  },
+  {
+    0xD3, 0xE0, 0xB7, 0x38, 0xD2, 0xE9, 0x2F, 0x3C,
+    0x47, 0xC7, 0x94, 0x66, 0x66, 0x09, 0xC0, 0xF5,
+    0x50, 0x4F, 0x67, 0xEC, 0x4E, 0x76, 0x0E, 0xEE,
+    0xCC, 0xF8, 0x64, 0x4E, 0x68, 0x33, 0x34, 0x11
+  },
+  {
+    0x0C, 0x90, 0xCE, 0x10, 0xED, 0xF0, 0xCE, 0x1D,
+    0x47, 0xEE, 0xB5, 0x0B, 0x5B, 0x7A, 0xFF, 0x8E,
+    0xE8, 0xA4, 0x3B, 0x64, 0xA8, 0x89, 0xC1, 0xC6,
+    0xC6, 0xB8, 0xE3, 0x1A, 0x3C, 0xFC, 0x45, 0xEE
+  },
+  {
+    0x83, 0x91, 0x7A, 0xC1, 0xCD, 0xAD, 0xE8, 0xF0,
+    0xE3, 0xBF, 0x42, 0x6F, 0xEA, 0xC1, 0x38, 0x8B,
+    0x3F, 0xCB, 0xE3, 0xE1, 0xBF, 0x98, 0x79, 0x8C,
+    0x81, 0x58, 0xBF, 0x75, 0x8E, 0x8D, 0x5D, 0x4E
+  },
+  {
+    0xDC, 0x8E, 0xB0, 0xC0, 0x13, 0xFA, 0x9D, 0x06,
+    0x4E, 0xE3, 0x76, 0x23, 0x36, 0x9F, 0xB3, 0x94,
+    0xAF, 0x97, 0x4B, 0x1A, 0xAC, 0x82, 0x40, 0x5B,
+    0x88, 0x97, 0x6C, 0xD8, 0xFC, 0xA1, 0x25, 0x30
+  },
+  {
+    0x9A, 0xF4, 0xFC, 0x92, 0xEA, 0x8D, 0x6B, 0x5F,
+    0xE7, 0x99, 0x0E, 0x3A, 0x02, 0x70, 0x1E, 0xC2,
+    0x2B, 0x2D, 0xFD, 0x71, 0x00, 0xB9, 0x0D, 0x05,
+    0x51, 0x86, 0x94, 0x17, 0x95, 0x5E, 0x44, 0xC8
+  },
+  {
+    0xC7, 0x22, 0xCE, 0xC1, 0x31, 0xBA, 0xA1, 0x63,
+    0xF4, 0x7E, 0x4B, 0x33, 0x9E, 0x1F, 0xB9, 0xB4,
+    0xAC, 0xA2, 0x48, 0xC4, 0x75, 0x93, 0x45, 0xEA,
+    0xDB, 0xD6, 0xC6, 0xA7, 0xDD, 0xB5, 0x04, 0x77
+  },
+  {
+    0x18, 0x37, 0xB1, 0x20, 0xD4, 0xE4, 0x04, 0x6C,
+    0x6D, 0xE8, 0xCC, 0xAF, 0x09, 0xF1, 0xCA, 0xF3,
+    0x02, 0xAD, 0x56, 0x23, 0x4E, 0x6B, 0x42, 0x2C,
+    0xE9, 0x0A, 0x61, 0xBF, 0x06, 0xAE, 0xE4, 0x3D
+  },
+  {
+    0x87, 0xAC, 0x9D, 0x0F, 0x8A, 0x0B, 0x11, 0xBF,
+    0xED, 0xD6, 0x99, 0x1A, 0x6D, 0xAF, 0x34, 0xC8,
+    0xAA, 0x5D, 0x7E, 0x8A, 0xE1, 0xB9, 0xDF, 0x4A,
+    0xF7, 0x38, 0x00, 0x5F, 0xE7, 0x8C, 0xE9, 0x3C
+  },
+  {
+    0xE2, 0x1F, 0xB6, 0x68, 0xEB, 0xB8, 0xBF, 0x2D,
+    0x82, 0x08, 0x6D, 0xED, 0xCB, 0x3A, 0x53, 0x71,
+    0xC2, 0xC4, 0x6F, 0xA1, 0xAC, 0x11, 0xD2, 0xE2,
+    0xC5, 0x66, 0xD1, 0x4A, 0xD3, 0xC3, 0x65, 0x3F
+  },
+  {
+    0x5A, 0x9A, 0x69, 0x81, 0x5E, 0x4D, 0x3E, 0xB7,
+    0x72, 0xED, 0x90, 0x8F, 0xE6, 0x58, 0xCE, 0x50,
+    0x87, 0x31, 0x0E, 0xC1, 0xD5, 0x0C, 0xB9, 0x4F,
+    0x56, 0x28, 0x33, 0x9A, 0x61, 0xDC, 0xD9, 0xEE
+  },
+  {
+    0xAA, 0xC2, 0x85, 0xF1, 0x20, 0x8F, 0x70, 0xA6,
+    0x47, 0x97, 0xD0, 0xA9, 0x40, 0x0D, 0xA6, 0x46,
+    0x53, 0x30, 0x18, 0x38, 0xFE, 0xF6, 0x69, 0x0B,
+    0x87, 0xCD, 0xA9, 0x15, 0x9E, 0xE0, 0x7E, 0xF4
+  },
+  {
+    0x05, 0x64, 0x3C, 0x1C, 0x6F, 0x26, 0x59, 0x25,
+    0xA6, 0x50, 0x93, 0xF9, 0xDE, 0x8A, 0x19, 0x1C,
+    0x4F, 0x6F, 0xD1, 0x41, 0x8F, 0xBF, 0x66, 0xBE,
+    0x80, 0x59, 0xA9, 0x1B, 0xA8, 0xDC, 0xDA, 0x61
+  },
+  {
+    0x1C, 0x6C, 0xDE, 0x5B, 0x78, 0x10, 0x3C, 0x9E,
+    0x6F, 0x04, 0x6D, 0xFE, 0x30, 0xF5, 0x12, 0x1C,
+    0xF9, 0xD4, 0x03, 0x9E, 0xFE, 0x22, 0x25, 0x40,
+    0xA4, 0x1B, 0xBC, 0x06, 0xE4, 0x69, 0xFE, 0xB6
+  },
+  {
+    0xB4, 0x9B, 0xB4, 0x6D, 0x1B, 0x19, 0x3B, 0x04,
+    0x5E, 0x74, 0x12, 0x05, 0x9F, 0xE7, 0x2D, 0x55,
+    0x25, 0x52, 0xA8, 0xFB, 0x6C, 0x36, 0x41, 0x07,
+    0x23, 0xDC, 0x7D, 0x05, 0xFC, 0xCE, 0xDE, 0xD3
+  },
+  {
+    0xB6, 0x12, 0xD3, 0xD2, 0x1F, 0xC4, 0xDE, 0x3C,
+    0x79, 0x1A, 0xF7, 0x35, 0xE5, 0x9F, 0xB7, 0x17,
+    0xD8, 0x39, 0x72, 0x3B, 0x42, 0x50, 0x8E, 0x9E,
+    0xBF, 0x78, 0x06, 0xD9, 0x3E, 0x9C, 0x83, 0x7F
+  },
+  {
+    0x7C, 0x33, 0x90, 0xA3, 0xE5, 0xCB, 0x27, 0xD1,
+    0x86, 0x8B, 0xA4, 0x55, 0xCF, 0xEB, 0x32, 0x22,
+    0xFD, 0xE2, 0x7B, 0xCD, 0xA4, 0xBF, 0x24, 0x8E,
+    0x3D, 0x29, 0xCF, 0x1F, 0x34, 0x32, 0x9F, 0x25
+  },
+  {
+    0xBD, 0x42, 0xEE, 0xA7, 0xB3, 0x54, 0x86, 0xCD,
+    0xD0, 0x90, 0x7C, 0xB4, 0x71, 0x2E, 0xDE, 0x2F,
+    0x4D, 0xEE, 0xCC, 0xBC, 0xA1, 0x91, 0x60, 0x38,
+    0x65, 0xA1, 0xCC, 0x80, 0x9F, 0x12, 0xB4, 0x46
+  },
+  {
+    0xD1, 0xDD, 0x62, 0x01, 0x74, 0x0C, 0xFA, 0xAD,
+    0x53, 0xCE, 0xCC, 0xB7, 0x56, 0xB1, 0x10, 0xF3,
+    0xD5, 0x0F, 0x81, 0x7B, 0x43, 0xD7, 0x55, 0x95,
+    0x57, 0xE5, 0x7A, 0xAD, 0x14, 0x3A, 0x85, 0xD9
+  },
+  {
+    0x58, 0x29, 0x64, 0x3C, 0x1B, 0x10, 0xE1, 0xC8,
+    0xCC, 0xF2, 0x0C, 0x9B, 0x4A, 0xF8, 0x21, 0xEA,
+    0x05, 0x2D, 0x7F, 0x0F, 0x7C, 0x22, 0xF7, 0x38,
+    0x0B, 0xBB, 0xCF, 0xAF, 0xB9, 0x77, 0xE2, 0x1F
+  },
+  {
+    0xFC, 0x4C, 0xF2, 0xA7, 0xFB, 0xE0, 0xB1, 0xE8,
+    0xAE, 0xFB, 0xE4, 0xB4, 0xB7, 0x9E, 0xD8, 0x4E,
+    0xC9, 0x7B, 0x03, 0x4F, 0x51, 0xB4, 0xE9, 0x7F,
+    0x76, 0x0B, 0x20, 0x63, 0x97, 0x65, 0xB9, 0x33
+  },
+  {
+    0x4D, 0x7C, 0x3B, 0x34, 0x38, 0xA0, 0xBD, 0xA2,
+    0x8E, 0x7A, 0x96, 0xE4, 0x20, 0x27, 0xD8, 0x13,
+    0xE8, 0x8A, 0xE6, 0x28, 0x85, 0x49, 0x98, 0x33,
+    0xD3, 0xC5, 0xF6, 0x35, 0x9E, 0xF7, 0xED, 0xBC
+  },
+  {
+    0x34, 0xCB, 0xD3, 0x20, 0x68, 0xEF, 0x7E, 0x82,
+    0x09, 0x9E, 0x58, 0x0B, 0xF9, 0xE2, 0x64, 0x23,
+    0xE9, 0x81, 0xE3, 0x1B, 0x1B, 0xBC, 0xE6, 0x1A,
+    0xEA, 0xB1, 0x4C, 0x32, 0xA2, 0x73, 0xE4, 0xCB
+  },
+  {
+    0xA0, 0x5D, 0xDA, 0x7D, 0x0D, 0xA9, 0xE0, 0x94,
+    0xAE, 0x22, 0x53, 0x3F, 0x79, 0xE7, 0xDC, 0xCD,
+    0x26, 0xB1, 0x75, 0x7C, 0xEF, 0xB9, 0x5B, 0xCF,
+    0x62, 0xC4, 0xFF, 0x9C, 0x26, 0x92, 0xE1, 0xC0
+  },
+  {
+    0x22, 0x4C, 0xCF, 0xFA, 0x7C, 0xCA, 0x4C, 0xE3,
+    0x4A, 0xFD, 0x47, 0xF6, 0x2A, 0xDE, 0x53, 0xC5,
+    0xE8, 0x48, 0x9B, 0x04, 0xAC, 0x9C, 0x41, 0xF7,
+    0xFA, 0xD0, 0xC8, 0xED, 0xEB, 0x89, 0xE9, 0x41
+  },
+  {
+    0x6B, 0xC6, 0x07, 0x64, 0x83, 0xAA, 0x11, 0xC0,
+    0x7F, 0xBA, 0x55, 0xC0, 0xF9, 0xA1, 0xB5, 0xDA,
+    0x87, 0xEC, 0xBF, 0xFE, 0xA7, 0x55, 0x98, 0xCC,
+    0x31, 0x8A, 0x51, 0x4C, 0xEC, 0x7B, 0x3B, 0x6A
+  },
+  {
+    0x9A, 0x03, 0x60, 0xE2, 0x3A, 0x22, 0xF4, 0xF7,
+    0x6C, 0x0E, 0x95, 0x28, 0xDA, 0xFD, 0x12, 0x9B,
+    0xB4, 0x67, 0x5F, 0xB8, 0x8D, 0x44, 0xEA, 0xF8,
+    0x57, 0x77, 0x30, 0x0C, 0xEC, 0x9B, 0xCC, 0x79
+  },
+  {
+    0x79, 0x01, 0x99, 0xB4, 0xCA, 0x90, 0xDE, 0xDC,
+    0xCF, 0xE3, 0x24, 0x74, 0xE8, 0x5B, 0x17, 0x4F,
+    0x06, 0x9E, 0x35, 0x42, 0xBE, 0x31, 0x04, 0xC1,
+    0x12, 0x5C, 0x2F, 0xDB, 0xD6, 0x9D, 0x32, 0xC7
+  },
+  {
+    0x55, 0x83, 0x99, 0x25, 0x83, 0x4C, 0xA3, 0xE8,
+    0x25, 0xE9, 0x92, 0x41, 0x87, 0x4D, 0x16, 0xD6,
+    0xC2, 0x62, 0x36, 0x29, 0xC4, 0xC2, 0xAD, 0xDD,
+    0xF0, 0xDB, 0xA0, 0x1E, 0x6C, 0xE8, 0xA0, 0xDC
+  },
+  {
+    0x61, 0x5F, 0xF8, 0x46, 0xD9, 0x93, 0x00, 0x7D,
+    0x38, 0xDE, 0x1A, 0xEC, 0xB3, 0x17, 0x82, 0x89,
+    0xDE, 0xD0, 0x9E, 0x6B, 0xB5, 0xCB, 0xD6, 0x0F,
+    0x69, 0xC6, 0xAA, 0x36, 0x38, 0x30, 0x20, 0xF7
+  },
+  {
+    0xF0, 0xE4, 0x0B, 0x4E, 0xD4, 0x0D, 0x34, 0x85,
+    0x1E, 0x72, 0xB4, 0xEE, 0x4D, 0x00, 0xEA, 0x6A,
+    0x40, 0xEA, 0x1C, 0x1B, 0xF9, 0xE5, 0xC2, 0x69,
+    0x71, 0x0C, 0x9D, 0x51, 0xCB, 0xB8, 0xA3, 0xC9
+  },
+  {
+    0x0B, 0x07, 0xB2, 0x33, 0x3B, 0x08, 0xD0, 0x8C,
+    0x11, 0xCA, 0x34, 0xAB, 0x44, 0x9B, 0x71, 0xD2,
+    0x9A, 0x0F, 0x43, 0xE1, 0xF7, 0x78, 0xE0, 0x73,
+    0xE7, 0x90, 0x06, 0xCC, 0xB7, 0x30, 0xED, 0x62
+  },
+  {
+    0xD1, 0xF4, 0xC2, 0x9D, 0x9F, 0x23, 0xEA, 0x35,
+    0xEC, 0x40, 0x35, 0xB3, 0x77, 0xD5, 0x06, 0x53,
+    0x8E, 0x72, 0x8B, 0xC7, 0x39, 0xC1, 0x45, 0x96,
+    0x80, 0xCF, 0x1C, 0xC6, 0x94, 0x24, 0x92, 0x4D
+  },
+  {
+    0x12, 0x79, 0xCF, 0x6F, 0x66, 0x9F, 0x92, 0xF6,
+    0xBF, 0xC2, 0x5D, 0x60, 0x5B, 0x94, 0x40, 0xC7,
+    0xDC, 0xCB, 0xD2, 0x5D, 0xF2, 0x8D, 0xC7, 0x35,
+    0x3A, 0xBC, 0x1C, 0x05, 0x30, 0x40, 0x5D, 0xC4
+  },
+  {
+    0x1F, 0xA0, 0xAF, 0x00, 0x77, 0x5D, 0xC2, 0xCE,
+    0x76, 0x50, 0x6D, 0x32, 0x80, 0xF4, 0x72, 0xD2,
+    0xF6, 0xFF, 0x97, 0xA2, 0x15, 0x1F, 0xAA, 0x82,
+    0x79, 0x42, 0xFE, 0xA4, 0x4A, 0xD0, 0xBA, 0x1F
+  },
+  {
+    0x3E, 0x1A, 0xD5, 0x4A, 0x5F, 0x83, 0x5B, 0x98,
+    0x3B, 0xD2, 0xAA, 0xB0, 0xED, 0x2A, 0x4C, 0x0B,
+    0xDD, 0x72, 0x16, 0x20, 0x9C, 0x36, 0xA7, 0x9E,
+    0x9E, 0x2A, 0xAB, 0xB9, 0x9F, 0xAF, 0x35, 0x12
+  },
+  {
+    0xC6, 0xED, 0x39, 0xE2, 0xD8, 0xB6, 0x36, 0xEC,
+    0xCB, 0xA2, 0x45, 0xEF, 0x4E, 0x88, 0x64, 0xF4,
+    0xCD, 0x94, 0x6B, 0xE2, 0x16, 0xB9, 0xBE, 0x48,
+    0x30, 0x3E, 0x08, 0xB9, 0x2D, 0xD0, 0x94, 0x34
+  },
+  {
+    0xE2, 0x47, 0x36, 0xC1, 0x3E, 0xCB, 0x9F, 0x36,
+    0xA0, 0xD8, 0x29, 0xD4, 0x79, 0x8D, 0x76, 0x99,
+    0xC1, 0x4C, 0xC6, 0x5B, 0x6D, 0xC4, 0x4E, 0xD6,
+    0xF1, 0x0C, 0xD4, 0x85, 0x3D, 0x6E, 0x07, 0x57
+  },
+  {
+    0x38, 0x9B, 0xE8, 0x80, 0x52, 0xA3, 0x81, 0x27,
+    0x2C, 0x6D, 0xF7, 0x41, 0xA8, 0x8A, 0xD3, 0x49,
+    0xB7, 0x12, 0x71, 0x84, 0x35, 0x48, 0x0A, 0x81,
+    0x90, 0xB7, 0x04, 0x77, 0x1D, 0x2D, 0xE6, 0x37
+  },
+  {
+    0x88, 0x9F, 0x2D, 0x57, 0x8A, 0x5D, 0xAE, 0xFD,
+    0x34, 0x1C, 0x21, 0x09, 0x84, 0xE1, 0x26, 0xD1,
+    0xD9, 0x6D, 0xA2, 0xDE, 0xE3, 0xC8, 0x1F, 0x7A,
+    0x60, 0x80, 0xBF, 0x84, 0x56, 0x9B, 0x31, 0x14
+  },
+  {
+    0xE9, 0x36, 0x09, 0x5B, 0x9B, 0x98, 0x2F, 0xFC,
+    0x85, 0x6D, 0x2F, 0x52, 0x76, 0xA4, 0xE5, 0x29,
+    0xEC, 0x73, 0x95, 0xDA, 0x31, 0x6D, 0x62, 0x87,
+    0x02, 0xFB, 0x28, 0x1A, 0xDA, 0x6F, 0x38, 0x99
+  },
+  {
+    0xEF, 0x89, 0xCE, 0x1D, 0x6F, 0x8B, 0x48, 0xEA,
+    0x5C, 0xD6, 0xAE, 0xAB, 0x6A, 0x83, 0xD0, 0xCC,
+    0x98, 0xC9, 0xA3, 0xA2, 0x07, 0xA1, 0x08, 0x57,
+    0x32, 0xF0, 0x47, 0xD9, 0x40, 0x38, 0xC2, 0x88
+  },
+  {
+    0xF9, 0x25, 0x01, 0x6D, 0x79, 0xF2, 0xAC, 0xA8,
+    0xC4, 0x9E, 0xDF, 0xCD, 0x66, 0x21, 0xD5, 0xBE,
+    0x3C, 0x8C, 0xEC, 0x61, 0xBD, 0x58, 0x71, 0xD8,
+    0xC1, 0xD3, 0xA5, 0x65, 0xF3, 0x5E, 0x0C, 0x9F
+  },
+  {
+    0x63, 0xE8, 0x63, 0x4B, 0x75, 0x7A, 0x38, 0xF9,
+    0x2B, 0x92, 0xFD, 0x23, 0x89, 0x3B, 0xA2, 0x99,
+    0x85, 0x3A, 0x86, 0x13, 0x67, 0x9F, 0xDF, 0x7E,
+    0x05, 0x11, 0x09, 0x5C, 0x0F, 0x04, 0x7B, 0xCA
+  },
+  {
+    0xCF, 0x2C, 0xCA, 0x07, 0x72, 0xB7, 0x05, 0xEB,
+    0x57, 0xD2, 0x89, 0x43, 0xF8, 0x3D, 0x35, 0x3F,
+    0xE2, 0x91, 0xE5, 0xB3, 0x77, 0x78, 0x0B, 0x37,
+    0x4C, 0x8B, 0xA4, 0x66, 0x58, 0x30, 0xBE, 0x87
+  },
+  {
+    0x46, 0xDF, 0x5B, 0x87, 0xC8, 0x0E, 0x7E, 0x40,
+    0x74, 0xAE, 0xE6, 0x85, 0x59, 0x42, 0x47, 0x42,
+    0x84, 0x5B, 0x9B, 0x35, 0x0F, 0x51, 0xBA, 0x55,
+    0xB0, 0x74, 0xBB, 0xAE, 0x4C, 0x62, 0x6A, 0xAB
+  },
+  {
+    0x65, 0x8A, 0xA4, 0xF9, 0xD2, 0xBC, 0xBD, 0x4F,
+    0x7F, 0x8E, 0xB6, 0x3E, 0x68, 0xF5, 0x36, 0x7E,
+    0xDB, 0xC5, 0x00, 0xA0, 0xB1, 0xFB, 0xB4, 0x1E,
+    0x9D, 0xF1, 0x41, 0xBC, 0xBA, 0x8F, 0xCD, 0x53
+  },
+  {
+    0xEE, 0x80, 0x55, 0x50, 0x08, 0xA7, 0x16, 0x55,
+    0xE0, 0x81, 0x09, 0x2B, 0xBA, 0x6F, 0x67, 0x0E,
+    0xD9, 0x8A, 0xF9, 0xA0, 0x9F, 0xB5, 0xAF, 0xB9,
+    0x4C, 0xBC, 0x5C, 0x75, 0x48, 0x14, 0xDB, 0x4F
+  },
+  {
+    0x2C, 0x5F, 0x9D, 0x04, 0x82, 0x20, 0xB0, 0x41,
+    0xB6, 0xD4, 0x52, 0x4B, 0x44, 0x90, 0xCF, 0x8C,
+    0x66, 0xFC, 0xB8, 0xE1, 0x4B, 0x0D, 0x64, 0x88,
+    0x7A, 0xA1, 0xE4, 0x76, 0x1A, 0x60, 0x2B, 0x39
+  },
+  {
+    0x44, 0xCB, 0x63, 0x11, 0xD0, 0x75, 0x0B, 0x7E,
+    0x33, 0xF7, 0x33, 0x3A, 0xA7, 0x8A, 0xAC, 0xA9,
+    0xC3, 0x4A, 0xD5, 0xF7, 0x9C, 0x1B, 0x15, 0x91,
+    0xEC, 0x33, 0x95, 0x1E, 0x69, 0xC4, 0xC4, 0x61
+  },
+  {
+    0x0C, 0x6C, 0xE3, 0x2A, 0x3E, 0xA0, 0x56, 0x12,
+    0xC5, 0xF8, 0x09, 0x0F, 0x6A, 0x7E, 0x87, 0xF5,
+    0xAB, 0x30, 0xE4, 0x1B, 0x70, 0x7D, 0xCB, 0xE5,
+    0x41, 0x55, 0x62, 0x0A, 0xD7, 0x70, 0xA3, 0x40
+  },
+  {
+    0xC6, 0x59, 0x38, 0xDD, 0x3A, 0x05, 0x3C, 0x72,
+    0x9C, 0xF5, 0xB7, 0xC8, 0x9F, 0x39, 0x0B, 0xFE,
+    0xBB, 0x51, 0x12, 0x76, 0x6B, 0xB0, 0x0A, 0xA5,
+    0xFA, 0x31, 0x64, 0xDF, 0xDF, 0x3B, 0x56, 0x47
+  },
+  {
+    0x7D, 0xE7, 0xF0, 0xD5, 0x9A, 0x90, 0x39, 0xAF,
+    0xF3, 0xAA, 0xF3, 0x2C, 0x3E, 0xE5, 0x2E, 0x79,
+    0x17, 0x53, 0x57, 0x29, 0x06, 0x21, 0x68, 0xD2,
+    0x49, 0x0B, 0x6B, 0x6C, 0xE2, 0x44, 0xB3, 0x80
+  },
+  {
+    0x89, 0x58, 0x98, 0xF5, 0x3A, 0x8F, 0x39, 0xE4,
+    0x24, 0x10, 0xDA, 0x77, 0xB6, 0xC4, 0x81, 0x5B,
+    0x0B, 0xB2, 0x39, 0x5E, 0x39, 0x22, 0xF5, 0xBE,
+    0xD0, 0xE1, 0xFB, 0xF2, 0xA4, 0xC6, 0xDF, 0xEB
+  },
+  {
+    0xC9, 0x05, 0xA8, 0x49, 0x84, 0x34, 0x8A, 0x64,
+    0xDB, 0x1F, 0x54, 0x20, 0x83, 0x74, 0x8A, 0xD9,
+    0x0A, 0x4B, 0xAD, 0x98, 0x33, 0xCB, 0x6D, 0xA3,
+    0x87, 0x29, 0x34, 0x31, 0xF1, 0x9E, 0x7C, 0x9C
+  },
+  {
+    0xED, 0x37, 0xD1, 0xA4, 0xD0, 0x6C, 0x90, 0xD1,
+    0x95, 0x78, 0x48, 0x66, 0x7E, 0x95, 0x48, 0xFE,
+    0xBB, 0x5D, 0x42, 0x3E, 0xAB, 0x4F, 0x56, 0x78,
+    0x5C, 0xC4, 0xB5, 0x41, 0x6B, 0x78, 0x00, 0x08
+  },
+  {
+    0x0B, 0xC6, 0x5D, 0x99, 0x97, 0xFB, 0x73, 0x4A,
+    0x56, 0x1F, 0xB1, 0xE9, 0xF8, 0xC0, 0x95, 0x8A,
+    0x02, 0xC7, 0xA4, 0xDB, 0xD0, 0x96, 0xEB, 0xEF,
+    0x1A, 0x17, 0x51, 0xAE, 0xD9, 0x59, 0xEE, 0xD7
+  },
+  {
+    0x7C, 0x5F, 0x43, 0x2E, 0xB8, 0xB7, 0x35, 0x2A,
+    0x94, 0x94, 0xDE, 0xA4, 0xD5, 0x3C, 0x21, 0x38,
+    0x70, 0x31, 0xCE, 0x70, 0xE8, 0x5D, 0x94, 0x08,
+    0xFC, 0x6F, 0x8C, 0xD9, 0x8A, 0x6A, 0xAA, 0x1E
+  },
+  {
+    0xB8, 0xBF, 0x8E, 0x2C, 0x34, 0xE0, 0x33, 0x98,
+    0x36, 0x39, 0x90, 0x9E, 0xAA, 0x37, 0x64, 0x0D,
+    0x87, 0x7B, 0x04, 0x8F, 0xE2, 0x99, 0xB4, 0x70,
+    0xAF, 0x2D, 0x0B, 0xA8, 0x2A, 0x5F, 0x14, 0xC0
+  },
+  {
+    0x88, 0xA9, 0xDD, 0x13, 0xD5, 0xDA, 0xDB, 0xDE,
+    0xE6, 0xBF, 0xF7, 0xEE, 0x1E, 0xF8, 0xC7, 0x1C,
+    0xC1, 0x93, 0xAA, 0x4B, 0xF3, 0xE8, 0x4F, 0x8F,
+    0xE8, 0x0C, 0xB0, 0x75, 0x68, 0x3C, 0x07, 0x79
+  },
+  {
+    0x9A, 0xED, 0xB8, 0x87, 0x6D, 0xD2, 0x1C, 0x8C,
+    0x84, 0xD2, 0xE7, 0x02, 0xA1, 0x36, 0x25, 0x98,
+    0x04, 0x62, 0xF6, 0x8B, 0xF0, 0xA1, 0xB7, 0x25,
+    0x4A, 0xD8, 0x06, 0xC3, 0x84, 0x03, 0xC9, 0xDE
+  },
+  {
+    0xD0, 0x97, 0x57, 0x3D, 0xF2, 0xD6, 0xB2, 0x48,
+    0x9A, 0x47, 0x94, 0x84, 0x86, 0x98, 0x00, 0xA1,
+    0xF8, 0x33, 0xEA, 0x16, 0x9E, 0xFF, 0x32, 0xAE,
+    0x3C, 0xE6, 0x3A, 0x20, 0x79, 0x54, 0x8D, 0x78
+  },
+  {
+    0xD1, 0x8F, 0x27, 0xA3, 0xE5, 0x55, 0xD7, 0xF9,
+    0x1A, 0x00, 0x7C, 0x67, 0xAC, 0xEE, 0xDE, 0x39,
+    0x1F, 0x75, 0xA6, 0x1F, 0xA4, 0x2A, 0x0B, 0x45,
+    0x66, 0xEB, 0x58, 0x2C, 0xA0, 0x5E, 0xBC, 0xE7
+  },
+  {
+    0xDF, 0x1D, 0xAA, 0x90, 0xB1, 0x70, 0x23, 0x13,
+    0xE6, 0xA5, 0x90, 0x1C, 0x7A, 0xFC, 0x5E, 0xD9,
+    0x65, 0x77, 0x17, 0xA7, 0x15, 0xFA, 0x53, 0xA4,
+    0x18, 0x9E, 0xC1, 0xE5, 0xDF, 0x29, 0x3A, 0x68
+  },
+  {
+    0x04, 0xE3, 0xA4, 0x96, 0xB6, 0x69, 0x96, 0xC6,
+    0x6E, 0x32, 0x91, 0x9E, 0xD1, 0xF9, 0x4C, 0x36,
+    0xEE, 0xBB, 0xF2, 0x40, 0x63, 0x3A, 0x2F, 0x73,
+    0x98, 0x45, 0xF0, 0x29, 0x5D, 0x34, 0xAF, 0xBA
+  },
+  {
+    0x8C, 0x45, 0xD8, 0x8C, 0x4E, 0x9C, 0x9D, 0x0C,
+    0x8C, 0x67, 0x7F, 0xE4, 0x8F, 0xA5, 0x44, 0x9B,
+    0xA3, 0x01, 0x78, 0xD4, 0x0A, 0xF0, 0xF0, 0x21,
+    0x79, 0x21, 0xC6, 0x2E, 0x4B, 0x60, 0xCD, 0xD3
+  },
+  {
+    0xE1, 0x49, 0xA6, 0xB1, 0x3B, 0xDE, 0xDE, 0xA2,
+    0xEE, 0xEE, 0x00, 0x9C, 0xE9, 0x44, 0x5E, 0x8D,
+    0xCF, 0x76, 0xB7, 0x6E, 0x55, 0xA5, 0x01, 0xD8,
+    0xF5, 0xB4, 0x3F, 0xF8, 0x96, 0x79, 0x6A, 0xD1
+  },
+  {
+    0xA8, 0x37, 0xC4, 0xC7, 0xC6, 0xF5, 0xCF, 0xB9,
+    0x9E, 0x10, 0x85, 0xFD, 0x43, 0x28, 0x7A, 0x41,
+    0x05, 0xCB, 0x28, 0xB7, 0x6F, 0xC3, 0x8B, 0x60,
+    0x55, 0xC5, 0xDC, 0xFF, 0x78, 0xB8, 0x25, 0x65
+  },
+  {
+    0x42, 0x41, 0x1F, 0x28, 0x78, 0x0B, 0x4F, 0x16,
+    0x38, 0x54, 0x0B, 0x87, 0x05, 0x21, 0xEC, 0x45,
+    0xBC, 0xEB, 0x1E, 0x0C, 0x71, 0x31, 0xF7, 0xE1,
+    0xC4, 0x67, 0x2E, 0x43, 0x6C, 0x88, 0xC8, 0xE9
+  },
+  {
+    0x34, 0xB4, 0xE8, 0x76, 0x76, 0x94, 0x71, 0xDF,
+    0x55, 0x2E, 0x55, 0x22, 0xCE, 0xA7, 0x84, 0xFA,
+    0x53, 0xAC, 0x61, 0xBE, 0xDE, 0x8C, 0xFE, 0x29,
+    0x14, 0x09, 0xE6, 0x8B, 0x69, 0xE8, 0x77, 0x6F
+  },
+  {
+    0x8F, 0x31, 0xD6, 0x37, 0xA9, 0x1D, 0xBD, 0x0E,
+    0xCB, 0x0B, 0xA0, 0xE6, 0x94, 0xBE, 0xC1, 0x44,
+    0x76, 0x58, 0xCE, 0x6C, 0x27, 0xEA, 0x9B, 0x95,
+    0xFF, 0x36, 0x70, 0x1C, 0xAF, 0x36, 0xF0, 0x01
+  },
+  {
+    0xB5, 0xC8, 0x95, 0xEB, 0x07, 0x1E, 0x3D, 0x38,
+    0x52, 0x8D, 0x47, 0x5D, 0x3B, 0xB0, 0xBA, 0x88,
+    0xB7, 0x17, 0x95, 0xE4, 0x0A, 0x98, 0x2E, 0x2A,
+    0xC2, 0xD8, 0x44, 0x22, 0xA0, 0xF2, 0x68, 0x5D
+  },
+  {
+    0xE9, 0x06, 0x25, 0x7C, 0x41, 0x9D, 0x94, 0x1E,
+    0xD2, 0xB8, 0xA9, 0xC1, 0x27, 0x81, 0xDB, 0x97,
+    0x59, 0xA3, 0xFC, 0xF3, 0xDC, 0x7C, 0xDB, 0x03,
+    0x15, 0x99, 0xE1, 0x08, 0x6B, 0x67, 0x2F, 0x10
+  },
+  {
+    0x98, 0xAD, 0x24, 0x39, 0x7C, 0x6E, 0xAE, 0x4C,
+    0xF7, 0x3E, 0xA8, 0xBB, 0xEF, 0x5A, 0x0B, 0x74,
+    0xD2, 0x1A, 0xD1, 0x5F, 0x33, 0x92, 0x0F, 0x44,
+    0x07, 0x0A, 0x98, 0xBD, 0xF5, 0x3D, 0x0B, 0x3A
+  },
+  {
+    0xDD, 0x51, 0x0C, 0xA5, 0x5B, 0x11, 0x70, 0xF9,
+    0xCE, 0xFD, 0xBB, 0x16, 0xFC, 0x14, 0x52, 0x62,
+    0xAA, 0x36, 0x3A, 0x87, 0x0A, 0x01, 0xE1, 0xBC,
+    0x4F, 0xBE, 0x40, 0x23, 0x4B, 0x4B, 0x6F, 0x2F
+  },
+  {
+    0xF2, 0xD8, 0xD9, 0x31, 0xB9, 0x2E, 0x1C, 0xB6,
+    0x98, 0xE5, 0x6E, 0xD0, 0x28, 0x19, 0xEA, 0x11,
+    0xD2, 0x66, 0x19, 0xB8, 0x3A, 0x62, 0x09, 0xAD,
+    0x67, 0x22, 0x53, 0x68, 0xFE, 0x11, 0x95, 0x71
+  },
+  {
+    0xE4, 0x63, 0x70, 0x55, 0xDB, 0x91, 0xF9, 0x43,
+    0x7C, 0xF4, 0x60, 0xEF, 0x40, 0xB5, 0x14, 0x5F,
+    0x69, 0x98, 0x26, 0x6A, 0x5E, 0x74, 0xE9, 0x6A,
+    0x00, 0x78, 0x2C, 0x62, 0xCF, 0x30, 0xCF, 0x1C
+  },
+  {
+    0x35, 0x63, 0x53, 0x0A, 0x89, 0xD3, 0x2B, 0x75,
+    0xF7, 0x8D, 0x83, 0xE9, 0x87, 0x2A, 0xD4, 0xC5,
+    0x75, 0xF5, 0x20, 0x39, 0x9D, 0x65, 0x03, 0x5D,
+    0xED, 0x99, 0xE5, 0xEE, 0xC5, 0x80, 0x71, 0x50
+  },
+  {
+    0x8E, 0x79, 0xF9, 0x2C, 0x86, 0x5B, 0xEB, 0x3E,
+    0x1C, 0xDB, 0xF0, 0x8F, 0x75, 0x4A, 0x26, 0x06,
+    0xE8, 0x53, 0x49, 0x05, 0x3D, 0x66, 0xD6, 0x16,
+    0x02, 0x4A, 0x81, 0x3F, 0xCA, 0x54, 0x1A, 0x4D
+  },
+  {
+    0x86, 0x42, 0x26, 0xF2, 0x83, 0x9C, 0x76, 0xB1,
+    0xD5, 0xF7, 0xC1, 0x3D, 0x98, 0xC2, 0xA5, 0x15,
+    0x8C, 0x2A, 0xBB, 0x71, 0xD9, 0xD8, 0xF0, 0xFA,
+    0x1F, 0x7C, 0x3F, 0x74, 0x68, 0x00, 0x16, 0x03
+  },
+  {
+    0xD3, 0xE3, 0xF5, 0xB8, 0xCE, 0xEB, 0xB1, 0x11,
+    0x84, 0x80, 0x35, 0x35, 0x90, 0x0B, 0x6E, 0xED,
+    0xDA, 0x60, 0x6E, 0xEB, 0x36, 0x97, 0x51, 0xA7,
+    0xCD, 0xA3, 0x6C, 0xA3, 0x02, 0x29, 0xFB, 0x02
+  },
+  {
+    0x8C, 0x7D, 0x6B, 0x98, 0x72, 0x69, 0x16, 0x90,
+    0x31, 0xF7, 0x1F, 0xD7, 0xE4, 0xC4, 0x45, 0x01,
+    0x2D, 0x3E, 0x6A, 0x3C, 0x88, 0x09, 0xF6, 0x47,
+    0x9B, 0xD6, 0x67, 0xCF, 0x31, 0x1E, 0x27, 0x6E
+  },
+  {
+    0xB9, 0x04, 0xB5, 0x71, 0x1B, 0xF1, 0x9E, 0x85,
+    0x32, 0xF7, 0xAD, 0x64, 0x27, 0x41, 0x0A, 0x62,
+    0xA1, 0xF7, 0x7F, 0x77, 0xB9, 0xB6, 0xD7, 0x1D,
+    0x2F, 0xC4, 0x3B, 0xC9, 0x0F, 0x73, 0x23, 0x5A
+  },
+  {
+    0x45, 0x36, 0x63, 0x43, 0x15, 0xC8, 0x67, 0x28,
+    0xF5, 0xAB, 0x74, 0x49, 0xEB, 0x2D, 0x04, 0x02,
+    0x0E, 0x9E, 0xAE, 0x8D, 0xD6, 0x79, 0x55, 0x00,
+    0xE9, 0xEC, 0x9A, 0x00, 0x66, 0x38, 0x6E, 0x69
+  },
+  {
+    0xFD, 0x5E, 0x49, 0xFE, 0xD4, 0x9D, 0xC4, 0x4B,
+    0xDE, 0x89, 0xF4, 0x60, 0xA9, 0x50, 0x19, 0x1E,
+    0xBB, 0x06, 0x7C, 0x69, 0x8A, 0x3F, 0x21, 0xEA,
+    0x14, 0x30, 0x8C, 0x74, 0x13, 0xB9, 0x16, 0x81
+  },
+  {
+    0x31, 0xF0, 0x1D, 0x03, 0x0B, 0x9B, 0x22, 0xD0,
+    0x0A, 0x0F, 0x71, 0xED, 0x2C, 0xEB, 0x5D, 0x2D,
+    0xC8, 0x1A, 0xF2, 0xC2, 0x4B, 0xF5, 0x67, 0x0F,
+    0xDE, 0x19, 0xA6, 0x85, 0xE8, 0xD1, 0x39, 0x2E
+  },
+  {
+    0x5F, 0x84, 0xD9, 0xDE, 0x28, 0x4B, 0x1E, 0x4F,
+    0x67, 0x8E, 0x31, 0xAB, 0x6A, 0x76, 0xF5, 0x66,
+    0x1B, 0x5A, 0xEA, 0xA7, 0x68, 0x53, 0x93, 0x84,
+    0xAA, 0x38, 0xF9, 0xE4, 0x9C, 0xCE, 0x6E, 0x6E
+  },
+  {
+    0xB2, 0x07, 0x9E, 0x59, 0x97, 0xA4, 0xEA, 0xD3,
+    0xA7, 0x1F, 0xEF, 0xC0, 0x2F, 0x90, 0xA7, 0x48,
+    0x3A, 0x10, 0xFD, 0x2E, 0x6F, 0x31, 0xBD, 0xA9,
+    0xD2, 0x08, 0x44, 0x85, 0xCC, 0x01, 0x6B, 0xBD
+  },
+  {
+    0xE0, 0xF8, 0x4D, 0x7F, 0x52, 0x5B, 0x6F, 0xED,
+    0x79, 0x1F, 0x77, 0x28, 0x9A, 0xE5, 0x8F, 0x7D,
+    0x50, 0xA2, 0x94, 0x32, 0xD4, 0x2C, 0x25, 0xC1,
+    0xE8, 0x39, 0x29, 0xB8, 0x38, 0x89, 0x1D, 0x79
+  },
+  {
+    0x70, 0x46, 0x96, 0x90, 0x95, 0x6D, 0x79, 0x18,
+    0xAC, 0xE7, 0xBA, 0x5F, 0x41, 0x30, 0x2D, 0xA1,
+    0x38, 0xC9, 0xB5, 0x6E, 0xCD, 0x41, 0x55, 0x44,
+    0xFA, 0xCE, 0x8D, 0x99, 0x8C, 0x21, 0xAB, 0xEB
+  },
+  {
+    0x45, 0xC9, 0x1A, 0x62, 0x24, 0x9B, 0x39, 0xCD,
+    0xA9, 0x4E, 0x50, 0x82, 0x95, 0xBE, 0xC7, 0x66,
+    0x71, 0x19, 0x44, 0x77, 0x65, 0xEF, 0x80, 0xEF,
+    0xA8, 0x2D, 0x1E, 0x92, 0xD5, 0x70, 0x67, 0xD8
+  },
+  {
+    0x1D, 0x9E, 0x00, 0x73, 0xEE, 0xD0, 0x73, 0x15,
+    0x54, 0xC3, 0xBE, 0xAA, 0x47, 0x46, 0x0D, 0x51,
+    0x1A, 0xD2, 0x61, 0xDD, 0x4D, 0x4A, 0x3B, 0xED,
+    0x9D, 0x8D, 0x20, 0x2F, 0x22, 0xF2, 0x15, 0x89
+  },
+  {
+    0x40, 0x82, 0x62, 0x73, 0x6D, 0x8A, 0xEC, 0x0B,
+    0x84, 0x7D, 0xBA, 0x25, 0x02, 0x58, 0x60, 0x8A,
+    0x43, 0x45, 0xA6, 0x3A, 0x1E, 0xB1, 0x95, 0xE5,
+    0xC7, 0xAE, 0x2E, 0xE8, 0x74, 0xC3, 0x4D, 0xA8
+  },
+  {
+    0x23, 0xD2, 0xB7, 0x04, 0x39, 0x46, 0x99, 0x49,
+    0x98, 0x23, 0x90, 0x53, 0x8D, 0x7E, 0x5A, 0xDE,
+    0x9F, 0x18, 0xC8, 0xE3, 0xBB, 0xF6, 0x60, 0x5A,
+    0xFC, 0xF4, 0x9B, 0x00, 0xC0, 0x61, 0xE8, 0x37
+  },
+  {
+    0x23, 0x2F, 0xB1, 0x87, 0xD2, 0x71, 0xBE, 0xA9,
+    0x12, 0xEF, 0xD4, 0x07, 0xFF, 0xE0, 0x80, 0x56,
+    0xD6, 0xA4, 0x2E, 0x53, 0x21, 0xEC, 0x79, 0x2D,
+    0xF3, 0xD5, 0x84, 0xA9, 0x4F, 0x63, 0x0A, 0xB2
+  },
+  {
+    0x13, 0x8E, 0x19, 0x44, 0xE4, 0xB5, 0x4D, 0xE8,
+    0x68, 0x1D, 0x7E, 0x48, 0xC4, 0xF0, 0x81, 0x48,
+    0xE4, 0x0A, 0x56, 0x7E, 0x5C, 0xAD, 0x94, 0x6A,
+    0x6A, 0xF4, 0xE8, 0xD5, 0xD2, 0x6F, 0x75, 0xC7
+  },
+  {
+    0x80, 0xC1, 0x51, 0x32, 0x5F, 0xBF, 0xC6, 0x78,
+    0xB7, 0xBE, 0x4E, 0x40, 0xB3, 0x0F, 0x29, 0xFE,
+    0x31, 0xCD, 0xBE, 0x1C, 0x84, 0x12, 0x6E, 0x00,
+    0x6D, 0xF3, 0xC1, 0x85, 0x24, 0xBD, 0x2D, 0x6C
+  },
+  {
+    0xA6, 0x42, 0x26, 0x73, 0x01, 0x66, 0x9D, 0xF2,
+    0x61, 0xB8, 0x39, 0xF8, 0x73, 0x65, 0x76, 0x29,
+    0x05, 0xFF, 0x32, 0x0A, 0x0A, 0x2F, 0xC4, 0xBD,
+    0xC4, 0x8E, 0x5A, 0x8E, 0x15, 0xD1, 0x32, 0x33
+  },
+  {
+    0x0F, 0x8B, 0x10, 0x99, 0x38, 0x60, 0x93, 0x7A,
+    0x74, 0xCC, 0x2D, 0xE4, 0x0A, 0x27, 0x31, 0xDD,
+    0x99, 0x54, 0xB6, 0x54, 0xBB, 0x94, 0xC3, 0x4E,
+    0x87, 0x66, 0x52, 0xE9, 0x8D, 0x4B, 0xBD, 0x16
+  },
+  {
+    0xE6, 0x34, 0xA5, 0x85, 0x12, 0x49, 0x32, 0x73,
+    0x26, 0x0F, 0x10, 0xD4, 0x49, 0x53, 0xCD, 0x99,
+    0x8E, 0x34, 0xCB, 0x82, 0x81, 0xC4, 0x1B, 0xF4,
+    0x2E, 0x0A, 0xE2, 0xF2, 0x5C, 0xBD, 0x1F, 0x75
+  },
+  {
+    0xBD, 0xE6, 0xAF, 0x9B, 0xAF, 0x3C, 0x07, 0xE9,
+    0x54, 0x23, 0xCA, 0xB5, 0x04, 0xDE, 0xE7, 0x0E,
+    0xDC, 0xC3, 0x31, 0x8B, 0x22, 0xDD, 0x1E, 0xB6,
+    0xFD, 0x85, 0xBE, 0x44, 0x7A, 0xC9, 0xF2, 0x09
+  },
+  {
+    0x91, 0x4B, 0x37, 0xAB, 0x5B, 0x8C, 0xFD, 0xE6,
+    0xA4, 0x80, 0x46, 0x6A, 0x0D, 0x82, 0x43, 0x2C,
+    0x7D, 0x76, 0x32, 0x8E, 0x9A, 0x88, 0xEF, 0x5B,
+    0x4F, 0x52, 0x42, 0x9F, 0x7A, 0x3F, 0xFC, 0x7D
+  },
+  {
+    0x55, 0xBE, 0x66, 0xE9, 0xA5, 0xAA, 0x67, 0x1A,
+    0x23, 0x88, 0x2E, 0xF3, 0xE7, 0xD9, 0xD3, 0x6E,
+    0xA9, 0x54, 0x87, 0xDC, 0x71, 0xB7, 0x25, 0xA5,
+    0xAD, 0x4B, 0x79, 0x8A, 0x87, 0x91, 0x43, 0xD0
+  },
+  {
+    0x3F, 0xD0, 0x45, 0x89, 0x4B, 0x83, 0x6E, 0x44,
+    0xE9, 0xCA, 0x75, 0xFB, 0xE3, 0xEA, 0xDC, 0x48,
+    0x6C, 0xBB, 0xD0, 0xD8, 0xCE, 0xE1, 0xB3, 0xCF,
+    0x14, 0xF7, 0x6E, 0x7F, 0x1E, 0x77, 0xAE, 0xF3
+  },
+  {
+    0xCE, 0x60, 0x34, 0x3D, 0xC4, 0x87, 0x4B, 0x66,
+    0x04, 0xE1, 0xFB, 0x23, 0x1E, 0x37, 0xEC, 0x1E,
+    0xEC, 0x3F, 0x06, 0x56, 0x6E, 0x42, 0x8A, 0xE7,
+    0x64, 0xEF, 0xFF, 0xA2, 0x30, 0xAD, 0xD4, 0x85
+  },
+  {
+    0xE3, 0x8C, 0x9D, 0xF0, 0x24, 0xDE, 0x21, 0x53,
+    0xD2, 0x26, 0x73, 0x8A, 0x0E, 0x5B, 0xA9, 0xB8,
+    0xC6, 0x78, 0x4D, 0xAC, 0xA6, 0x5C, 0x22, 0xA7,
+    0x62, 0x8E, 0xB5, 0x8E, 0xA0, 0xD4, 0x95, 0xA7
+  },
+  {
+    0x8D, 0xFE, 0xC0, 0xD4, 0xF3, 0x65, 0x8A, 0x20,
+    0xA0, 0xBA, 0xD6, 0x6F, 0x21, 0x60, 0x83, 0x2B,
+    0x16, 0x4E, 0x70, 0x0A, 0x21, 0xEC, 0x5A, 0x01,
+    0x65, 0xC3, 0x67, 0x72, 0xB2, 0x08, 0x61, 0x11
+  },
+  {
+    0x44, 0x01, 0xB5, 0x0E, 0x09, 0x86, 0x5F, 0x42,
+    0x38, 0x24, 0x3B, 0x82, 0x25, 0xCA, 0x40, 0xA0,
+    0x8D, 0xBB, 0x46, 0x85, 0xF5, 0xF8, 0x62, 0xFB,
+    0xDD, 0x72, 0x98, 0x04, 0x31, 0xA8, 0x5D, 0x3F
+  },
+  {
+    0x86, 0x68, 0x94, 0x27, 0x88, 0xC4, 0xCE, 0x8A,
+    0x33, 0x19, 0x0F, 0xFC, 0xFA, 0xD1, 0xC6, 0x78,
+    0xC4, 0xFA, 0x41, 0xE9, 0x94, 0x17, 0x09, 0x4E,
+    0x24, 0x0F, 0x4A, 0x43, 0xF3, 0x87, 0xA3, 0xB6
+  },
+  {
+    0xA7, 0x28, 0x8D, 0x5E, 0x09, 0x80, 0x9B, 0x69,
+    0x69, 0x84, 0xEC, 0xD5, 0x32, 0x6C, 0xDD, 0x84,
+    0xFB, 0xE3, 0x5F, 0xCF, 0x67, 0x23, 0x5D, 0x81,
+    0x1C, 0x82, 0x00, 0x25, 0x36, 0xA3, 0xC5, 0xE1
+  },
+  {
+    0x8E, 0x92, 0x5C, 0x3C, 0x14, 0x6B, 0xAC, 0xF3,
+    0x35, 0x1E, 0xC5, 0x32, 0x41, 0xAC, 0xE5, 0xF7,
+    0x3E, 0x8F, 0xC9, 0xBD, 0x8C, 0x61, 0xCA, 0xD9,
+    0x7F, 0xD7, 0x72, 0xB0, 0x7E, 0x1B, 0x83, 0x73
+  },
+  {
+    0xC7, 0xEB, 0x9E, 0x6D, 0xED, 0x2F, 0x99, 0x3D,
+    0x48, 0xB0, 0x17, 0x0D, 0xA2, 0x7C, 0x5B, 0x75,
+    0x3B, 0x12, 0x17, 0x6B, 0xE1, 0x26, 0xC7, 0xBA,
+    0x2D, 0x6A, 0xF8, 0x5F, 0x85, 0x93, 0xB7, 0x52
+  },
+  {
+    0xCA, 0x27, 0xF1, 0x6F, 0x94, 0xE4, 0xEC, 0x0E,
+    0x62, 0x8E, 0x7F, 0x8A, 0xEF, 0xC6, 0x65, 0x7B,
+    0xED, 0xC9, 0x37, 0x42, 0x96, 0x59, 0x40, 0xAE,
+    0x78, 0x6A, 0x73, 0xB5, 0xFD, 0x59, 0x3B, 0x97
+  },
+  {
+    0x8C, 0x21, 0xE6, 0x56, 0x8B, 0xC6, 0xDC, 0x00,
+    0xE3, 0xD6, 0xEB, 0xC0, 0x9E, 0xA9, 0xC2, 0xCE,
+    0x00, 0x6C, 0xD3, 0x11, 0xD3, 0xB3, 0xE9, 0xCC,
+    0x9D, 0x8D, 0xDB, 0xFB, 0x3C, 0x5A, 0x77, 0x76
+  },
+  {
+    0x52, 0x56, 0x66, 0x96, 0x8B, 0x3B, 0x7D, 0x00,
+    0x7B, 0xB9, 0x26, 0xB6, 0xEF, 0xDC, 0x7E, 0x21,
+    0x2A, 0x31, 0x15, 0x4C, 0x9A, 0xE1, 0x8D, 0x43,
+    0xEE, 0x0E, 0xB7, 0xE6, 0xB1, 0xA9, 0x38, 0xD3
+  },
+  {
+    0xE0, 0x9A, 0x4F, 0xA5, 0xC2, 0x8B, 0xDC, 0xD7,
+    0xC8, 0x39, 0x84, 0x0E, 0x0A, 0x38, 0x3E, 0x4F,
+    0x7A, 0x10, 0x2D, 0x0B, 0x1B, 0xC8, 0x49, 0xC9,
+    0x49, 0x62, 0x7C, 0x41, 0x00, 0xC1, 0x7D, 0xD3
+  },
+  {
+    0xC1, 0x9F, 0x3E, 0x29, 0x5D, 0xB2, 0xFC, 0x0E,
+    0x74, 0x81, 0xC4, 0xF1, 0x6A, 0xF0, 0x11, 0x55,
+    0xDD, 0xB0, 0xD7, 0xD1, 0x38, 0x3D, 0x4A, 0x1F,
+    0xF1, 0x69, 0x9D, 0xB7, 0x11, 0x77, 0x34, 0x0C
+  },
+  {
+    0x76, 0x9E, 0x67, 0x8C, 0x0A, 0x09, 0x09, 0xA2,
+    0x02, 0x1C, 0x4D, 0xC2, 0x6B, 0x1A, 0x3C, 0x9B,
+    0xC5, 0x57, 0xAD, 0xB2, 0x1A, 0x50, 0x83, 0x4C,
+    0xDC, 0x5C, 0x92, 0x93, 0xF7, 0x53, 0x65, 0xF8
+  },
+  {
+    0xB6, 0x48, 0x74, 0xAD, 0xAB, 0x6B, 0xCB, 0x85,
+    0xB9, 0x4B, 0xD9, 0xA6, 0xC5, 0x65, 0xD0, 0xD2,
+    0xBC, 0x35, 0x44, 0x5D, 0x75, 0x28, 0xBC, 0x85,
+    0xB4, 0x1F, 0xDC, 0x79, 0xDC, 0x76, 0xE3, 0x4F
+  },
+  {
+    0xFA, 0xF2, 0x50, 0xDE, 0x15, 0x82, 0x0F, 0x7F,
+    0xC6, 0x10, 0xDD, 0x53, 0xEE, 0xAE, 0x44, 0x60,
+    0x1C, 0x3E, 0xFF, 0xA3, 0xAC, 0xCD, 0x08, 0x8E,
+    0xB6, 0x69, 0x05, 0xBB, 0x26, 0x53, 0xBE, 0x8C
+  },
+  {
+    0x1E, 0x20, 0x38, 0x73, 0x9B, 0x2C, 0x01, 0x8B,
+    0x0E, 0x9E, 0x0E, 0x1E, 0x52, 0x2F, 0xD9, 0x65,
+    0x12, 0x87, 0xEE, 0x6E, 0x36, 0x65, 0x91, 0x9B,
+    0x24, 0xC2, 0x12, 0x4F, 0x0C, 0x1A, 0x3F, 0x3A
+  },
+  {
+    0x5F, 0xEC, 0x3A, 0xA0, 0x08, 0x61, 0xDE, 0x1A,
+    0xC5, 0xDA, 0xB3, 0xC1, 0x37, 0x06, 0x5D, 0x1E,
+    0x01, 0xBB, 0x03, 0xF6, 0x9D, 0xCC, 0x7D, 0x1C,
+    0xF7, 0xCA, 0x4F, 0x43, 0x56, 0xAE, 0xC9, 0xA3
+  },
+  {
+    0x44, 0x51, 0xFE, 0x6B, 0xBE, 0xF3, 0x93, 0x43,
+    0x91, 0x92, 0x44, 0xC5, 0x1D, 0xAE, 0x1E, 0xA9,
+    0xA9, 0x54, 0xCF, 0x2C, 0x09, 0x66, 0xAB, 0x04,
+    0x5B, 0x15, 0x52, 0x1E, 0xCF, 0x35, 0x00, 0x81
+  },
+  {
+    0x8C, 0x62, 0x2F, 0xA2, 0x16, 0x0E, 0x8E, 0x99,
+    0x18, 0x13, 0xF1, 0x80, 0xBF, 0xEC, 0x0B, 0x43,
+    0x1C, 0x6D, 0xBF, 0xA2, 0x95, 0x6D, 0x91, 0x75,
+    0x81, 0x6A, 0x23, 0xC3, 0x82, 0xC4, 0xF2, 0x00
+  },
+  {
+    0x81, 0x7D, 0x5C, 0x8F, 0x92, 0xE7, 0xB5, 0xCA,
+    0x57, 0xF5, 0xE1, 0x63, 0x90, 0x16, 0xAD, 0x57,
+    0x60, 0xE4, 0x46, 0xD6, 0xE9, 0xCA, 0xA7, 0x49,
+    0x84, 0x14, 0xAC, 0xE8, 0x22, 0x80, 0xB5, 0xCD
+  },
+  {
+    0xA6, 0xA1, 0xAD, 0x58, 0xCE, 0xE5, 0x4E, 0x69,
+    0xCB, 0xBC, 0xAA, 0x87, 0xDF, 0x07, 0xA6, 0x70,
+    0x7E, 0xB2, 0x24, 0x73, 0x9C, 0x21, 0x76, 0x13,
+    0x46, 0x0A, 0xB4, 0x54, 0xB4, 0x59, 0xCA, 0x9C
+  },
+  {
+    0x63, 0xB8, 0x47, 0x27, 0x52, 0x26, 0x60, 0x5B,
+    0xE6, 0x76, 0x81, 0x25, 0x8F, 0x7D, 0x00, 0xBB,
+    0xB3, 0x07, 0xC6, 0x6F, 0x19, 0x59, 0xBF, 0x2E,
+    0x46, 0x7A, 0x41, 0xAE, 0xE7, 0x14, 0xE5, 0x5C
+  },
+  {
+    0xFE, 0x52, 0xEB, 0xE5, 0xCF, 0xCF, 0xE6, 0xA2,
+    0x29, 0x7B, 0x53, 0x9F, 0xA3, 0xDA, 0xDB, 0xD6,
+    0xEB, 0xD2, 0x01, 0xAA, 0x2C, 0xA1, 0x35, 0x63,
+    0xE3, 0xD7, 0xF1, 0x4D, 0x15, 0xAB, 0xFF, 0x63
+  },
+  {
+    0xB7, 0xBE, 0xF9, 0xFA, 0x5A, 0x3D, 0x10, 0x42,
+    0x62, 0x46, 0xB5, 0xF6, 0x58, 0xC0, 0x8F, 0xDF,
+    0x80, 0x66, 0xEA, 0xA3, 0xE5, 0x5A, 0x2F, 0x7D,
+    0xA1, 0x59, 0x1E, 0x05, 0xC8, 0x7D, 0xF8, 0xC7
+  },
+  {
+    0xDE, 0xD1, 0xD6, 0xCA, 0xA9, 0xF8, 0xF3, 0xBD,
+    0xA9, 0x2C, 0xEA, 0x7F, 0x65, 0x49, 0xB1, 0xFB,
+    0x86, 0xA2, 0x21, 0x14, 0x78, 0xC4, 0xEC, 0x28,
+    0x9B, 0x83, 0x7E, 0xFC, 0x2B, 0x5C, 0x27, 0xD7
+  },
+  {
+    0x9F, 0x30, 0x00, 0x8A, 0x2E, 0xB0, 0x50, 0xF1,
+    0x8E, 0x56, 0xA7, 0x6B, 0xE9, 0x20, 0x91, 0xB2,
+    0xFD, 0xC1, 0x64, 0xD5, 0x6E, 0x32, 0xC8, 0x7D,
+    0xD6, 0x4C, 0x9E, 0x3A, 0x61, 0x10, 0x41, 0xB1
+  },
+  {
+    0x01, 0x0B, 0x6A, 0x3B, 0x11, 0x86, 0x00, 0x88,
+    0xF0, 0xAB, 0xC8, 0x0A, 0x89, 0x72, 0xCB, 0xBC,
+    0x32, 0x9D, 0x52, 0x75, 0x34, 0x29, 0x50, 0xEB,
+    0x9A, 0x04, 0x5A, 0xFD, 0xC8, 0xBB, 0xED, 0x24
+  },
+  {
+    0x0C, 0xD2, 0x10, 0xAA, 0xC1, 0x1F, 0x1C, 0x1C,
+    0xED, 0x49, 0x7F, 0x67, 0x3E, 0x53, 0xDB, 0x68,
+    0xC3, 0xEC, 0x36, 0x07, 0xF0, 0xC5, 0x78, 0x7D,
+    0xDC, 0x60, 0xA3, 0x55, 0xDF, 0xE5, 0x6C, 0x25
+  },
+  {
+    0x0E, 0x56, 0xFD, 0x01, 0xDA, 0x3B, 0x4F, 0x8B,
+    0xE2, 0xC9, 0x90, 0x55, 0x2A, 0xAC, 0x8D, 0x1E,
+    0x8D, 0xA2, 0x09, 0xBC, 0xF4, 0xAA, 0xD4, 0xFF,
+    0xB5, 0x42, 0x7F, 0xD6, 0x31, 0x72, 0x46, 0x3E
+  },
+  {
+    0xD6, 0xD5, 0xCD, 0xB1, 0x14, 0x40, 0xE3, 0x4A,
+    0xCA, 0x3A, 0x2F, 0xCF, 0x30, 0xF5, 0x9E, 0x08,
+    0xB1, 0x1A, 0x2A, 0x3D, 0xE5, 0x39, 0xE3, 0xE6,
+    0x51, 0x3E, 0xD7, 0x8A, 0x4F, 0xEE, 0x51, 0x3B
+  },
+  {
+    0xAA, 0x35, 0xAC, 0x90, 0x68, 0x06, 0x70, 0xC7,
+    0x32, 0xED, 0x1E, 0xF3, 0x7E, 0x8C, 0xBA, 0xAE,
+    0x49, 0xA4, 0xD8, 0x8E, 0xCF, 0x4D, 0xF2, 0xB6,
+    0x89, 0xA0, 0xF1, 0x01, 0xB7, 0x56, 0xAE, 0x47
+  },
+  {
+    0x27, 0x8E, 0x56, 0x12, 0x88, 0x72, 0x26, 0x30,
+    0xE2, 0x6A, 0x5F, 0xC9, 0x54, 0xBF, 0x2D, 0xCD,
+    0x6A, 0x65, 0x81, 0x67, 0x39, 0xAB, 0xEE, 0x7B,
+    0xE1, 0x43, 0x07, 0xA9, 0x61, 0x74, 0xE5, 0xB0
+  },
+  {
+    0xAB, 0x4B, 0x2C, 0xA1, 0xA2, 0xB3, 0x49, 0x98,
+    0x15, 0x24, 0xB6, 0x15, 0x54, 0x62, 0xF0, 0xFF,
+    0x10, 0x60, 0xBF, 0x9B, 0xFA, 0x07, 0xFB, 0x9E,
+    0xC6, 0x9C, 0xA4, 0x71, 0x64, 0x5B, 0x6A, 0x18
+  },
+  {
+    0x18, 0xA9, 0xBB, 0xEC, 0x3C, 0x8E, 0x1F, 0x8E,
+    0xE9, 0x57, 0x12, 0x97, 0xA9, 0x34, 0x36, 0xDE,
+    0x42, 0x7C, 0xD2, 0x70, 0xEC, 0x69, 0xDF, 0xE8,
+    0x88, 0xDB, 0x7D, 0xBF, 0x10, 0xB6, 0x49, 0x93
+  },
+  {
+    0xBA, 0xFC, 0x7E, 0x43, 0xD2, 0x65, 0xA1, 0x73,
+    0x02, 0x1A, 0x9D, 0x9E, 0x58, 0x3D, 0x60, 0xED,
+    0x42, 0xA8, 0x03, 0xFA, 0xCD, 0x6B, 0x83, 0x60,
+    0xDE, 0x1F, 0x91, 0x68, 0x35, 0x38, 0x9B, 0xF0
+  },
+  {
+    0xA5, 0xB6, 0x7B, 0xE9, 0x50, 0xFB, 0xC2, 0xF0,
+    0xDD, 0x32, 0x3A, 0x79, 0xA1, 0x9E, 0x3E, 0xD1,
+    0xF4, 0xAE, 0x4B, 0xA7, 0x89, 0x4F, 0x93, 0x0E,
+    0xA5, 0xEF, 0x73, 0x4D, 0xE7, 0xDB, 0x83, 0xAE
+  },
+  {
+    0xBF, 0x1E, 0x65, 0xF3, 0xCD, 0x84, 0x98, 0x88,
+    0x4D, 0x9D, 0x5C, 0x19, 0xEB, 0xF7, 0xB9, 0x16,
+    0x06, 0x76, 0x37, 0x60, 0x4E, 0x26, 0xDB, 0xE2,
+    0xB7, 0x28, 0x8E, 0xCB, 0x11, 0x42, 0x60, 0x68
+  },
+  {
+    0xC3, 0x34, 0x2C, 0xF9, 0xCB, 0xBF, 0x29, 0xD4,
+    0x06, 0xD7, 0x89, 0x5D, 0xD4, 0xD9, 0x54, 0x8D,
+    0x4A, 0xC7, 0x8B, 0x4D, 0x00, 0xE9, 0xB6, 0x3E,
+    0x20, 0x3E, 0x5E, 0x19, 0xE9, 0x97, 0x46, 0x20
+  },
+  {
+    0x1C, 0x0B, 0xE6, 0x02, 0x77, 0x43, 0x4B, 0x0E,
+    0x00, 0x4B, 0x7B, 0x38, 0x8A, 0x37, 0x55, 0x9F,
+    0x84, 0xB3, 0x0C, 0x6C, 0xF8, 0x60, 0x0F, 0x52,
+    0x8B, 0xFC, 0xD3, 0x3C, 0xAF, 0x52, 0xCB, 0x1E
+  },
+  {
+    0x73, 0x95, 0x45, 0x30, 0xD0, 0x3F, 0x10, 0xBE,
+    0xF5, 0x2A, 0xD5, 0xBC, 0x7F, 0xB4, 0xC0, 0x76,
+    0xF8, 0x3F, 0x63, 0x31, 0xC8, 0xBD, 0x1E, 0xEE,
+    0xC3, 0x88, 0x7F, 0x4A, 0xA2, 0x06, 0x92, 0x40
+  },
+  {
+    0x69, 0xC1, 0x1E, 0xE0, 0x49, 0x44, 0xDE, 0xA9,
+    0x85, 0xAC, 0x9F, 0x13, 0x96, 0x0E, 0x73, 0x98,
+    0x0E, 0x1B, 0xB0, 0xE3, 0x09, 0xF4, 0x38, 0x4A,
+    0x16, 0x76, 0xF8, 0xEF, 0xAB, 0x38, 0x42, 0x88
+  },
+  {
+    0x36, 0xFB, 0x8F, 0xDE, 0x0E, 0xC2, 0x8C, 0xE8,
+    0x53, 0xFB, 0x71, 0x75, 0xC1, 0xB7, 0x9D, 0xA3,
+    0xB5, 0xE8, 0xC3, 0x91, 0x86, 0xE7, 0x8A, 0xAE,
+    0xCE, 0x54, 0x64, 0xDB, 0xD9, 0xFE, 0x2A, 0xA2
+  },
+  {
+    0x6B, 0xB2, 0xA0, 0x9D, 0xFC, 0xAF, 0x96, 0x96,
+    0x2D, 0xE0, 0x0C, 0x8A, 0x08, 0x2D, 0x6D, 0xF9,
+    0x32, 0x2B, 0x49, 0x66, 0xAE, 0x8D, 0x2E, 0xCF,
+    0x73, 0x24, 0x11, 0xA7, 0x6A, 0x1A, 0x0E, 0xE6
+  },
+  {
+    0x74, 0x12, 0xE7, 0xDD, 0x1B, 0xF1, 0xAA, 0x93,
+    0x97, 0x41, 0x1B, 0xBA, 0x4D, 0x3E, 0x02, 0x76,
+    0xD2, 0xE7, 0xA1, 0xA2, 0x9A, 0x24, 0x77, 0x15,
+    0x7A, 0xD6, 0x03, 0x60, 0xD3, 0x3D, 0x4E, 0x76
+  },
+  {
+    0xDD, 0xDE, 0xAF, 0xCF, 0xC7, 0x23, 0x21, 0xC8,
+    0x49, 0xFB, 0x25, 0x94, 0x7A, 0xB4, 0x2C, 0x1A,
+    0xF2, 0xA5, 0xE4, 0x3F, 0xEF, 0x68, 0x1B, 0xE4,
+    0x2C, 0x7E, 0xAF, 0x36, 0x60, 0x08, 0x0A, 0xD3
+  },
+  {
+    0x9D, 0xEF, 0xEB, 0xAD, 0xBD, 0xCB, 0x0A, 0x0E,
+    0x7F, 0xF9, 0x92, 0xF9, 0x47, 0xCE, 0xD3, 0xD0,
+    0xA4, 0xC8, 0x99, 0xE6, 0x4F, 0xE7, 0x73, 0x60,
+    0xE8, 0x1E, 0x1F, 0x0E, 0x97, 0xF8, 0xC1, 0xA2
+  },
+  {
+    0x84, 0x4C, 0x59, 0xFB, 0xE6, 0x47, 0x6F, 0xD1,
+    0x89, 0x23, 0x99, 0x54, 0xF1, 0x7E, 0x36, 0xE1,
+    0xF6, 0x9E, 0x24, 0xAA, 0xED, 0x5D, 0x5C, 0x8B,
+    0x84, 0x05, 0xEF, 0x2A, 0x83, 0x0C, 0xC2, 0xA0
+  },
+  {
+    0xFF, 0x3F, 0xAF, 0xB6, 0x77, 0x86, 0xE0, 0x1A,
+    0x0C, 0x38, 0xEA, 0xDF, 0x99, 0xC4, 0xCA, 0xE8,
+    0x02, 0x9D, 0xA8, 0xCF, 0x29, 0x87, 0x5F, 0xC4,
+    0x19, 0xBF, 0x68, 0x00, 0x09, 0xB3, 0xBD, 0xB3
+  },
+  {
+    0xCA, 0x67, 0x60, 0xF3, 0x45, 0x67, 0x8F, 0x30,
+    0xA2, 0x8D, 0x62, 0x82, 0x94, 0x27, 0x2A, 0x19,
+    0xE3, 0x07, 0x2E, 0xBC, 0x61, 0xB1, 0x9F, 0xF1,
+    0x3B, 0x31, 0x89, 0x73, 0xE9, 0x7C, 0x27, 0x38
+  },
+  {
+    0xC0, 0x8E, 0x1A, 0x90, 0x47, 0xC5, 0x05, 0x26,
+    0x4A, 0x16, 0x44, 0x7C, 0x9E, 0xD9, 0x81, 0xA7,
+    0x19, 0xD3, 0x81, 0xF2, 0x8E, 0x60, 0x5F, 0xD7,
+    0xCA, 0xA9, 0xE8, 0xBD, 0xBB, 0x42, 0x99, 0x6A
+  },
+  {
+    0xF1, 0x73, 0xBA, 0x9D, 0x45, 0x84, 0xCD, 0x12,
+    0x60, 0x50, 0xC6, 0x9F, 0xC2, 0x19, 0xA9, 0x19,
+    0x0A, 0x0B, 0xF0, 0xAE, 0xCE, 0xCB, 0xE6, 0x11,
+    0xBE, 0xED, 0x19, 0x3D, 0xA6, 0xCA, 0x4D, 0xE7
+  },
+  {
+    0xB1, 0x84, 0x87, 0x65, 0x20, 0xDE, 0xD8, 0xBD,
+    0x7D, 0xE2, 0x5E, 0xAE, 0xFB, 0xD3, 0xE0, 0x36,
+    0x88, 0xC3, 0xBE, 0x39, 0xC1, 0x9F, 0xB7, 0x3E,
+    0x1F, 0x0E, 0xCC, 0xAC, 0x7C, 0xC0, 0xF0, 0x14
+  },
+  {
+    0x90, 0x25, 0xDB, 0x07, 0x58, 0xBD, 0xFB, 0x48,
+    0xF0, 0x66, 0x7E, 0xBD, 0x7E, 0x12, 0x02, 0x46,
+    0x59, 0x8F, 0xED, 0x01, 0xC2, 0x58, 0x76, 0x4F,
+    0xA0, 0xFA, 0xE3, 0x34, 0xA2, 0xA0, 0x0A, 0x97
+  },
+  {
+    0xE8, 0x3D, 0x80, 0x86, 0xFA, 0xBC, 0x46, 0x0D,
+    0x5E, 0xFC, 0x45, 0x9F, 0x95, 0xA2, 0x68, 0xF5,
+    0xDC, 0x4A, 0xC2, 0x84, 0x09, 0x3C, 0x24, 0x7C,
+    0xA6, 0xEC, 0x84, 0x1A, 0xD6, 0x18, 0x3F, 0xE1
+  },
+  {
+    0xCC, 0x9D, 0xF4, 0x1D, 0x35, 0xAA, 0x75, 0x92,
+    0x8C, 0x18, 0x5F, 0x73, 0x93, 0x66, 0x61, 0x10,
+    0xB8, 0x0F, 0x09, 0x86, 0xA2, 0x21, 0xC3, 0x70,
+    0xF4, 0x5C, 0x2E, 0xB9, 0x01, 0x6C, 0x9A, 0x3B
+  },
+  {
+    0x92, 0xF9, 0xA5, 0x94, 0x95, 0x45, 0x90, 0xFA,
+    0x81, 0x98, 0x17, 0xE5, 0xD1, 0xC2, 0x8A, 0xAB,
+    0x2B, 0x1C, 0xC5, 0x04, 0xD8, 0x6D, 0xBA, 0x44,
+    0x36, 0x76, 0xBD, 0xF8, 0x66, 0x79, 0x68, 0x11
+  },
+  {
+    0x72, 0x95, 0x62, 0xA1, 0xE0, 0x7B, 0x0E, 0x26,
+    0x05, 0x49, 0x48, 0x09, 0xBD, 0x48, 0x0F, 0x15,
+    0x37, 0xCE, 0xA1, 0x0D, 0xCA, 0xD4, 0x3E, 0xF9,
+    0xF6, 0x8C, 0x66, 0xE8, 0x25, 0xDC, 0x46, 0xB1
+  },
+  {
+    0x26, 0xF1, 0x60, 0xAB, 0x96, 0xF5, 0x58, 0x20,
+    0x45, 0x14, 0x6E, 0xAF, 0xF2, 0xE2, 0xA8, 0xD4,
+    0xDA, 0xB2, 0x98, 0xB4, 0xC5, 0x7E, 0x11, 0x7C,
+    0xDF, 0xC5, 0xD0, 0x25, 0xC9, 0x2A, 0x22, 0x68
+  },
+  {
+    0x87, 0xEB, 0xE7, 0x21, 0x38, 0x38, 0x73, 0xD2,
+    0x47, 0xF8, 0x61, 0x82, 0xE3, 0xF5, 0x99, 0xA7,
+    0x63, 0x4F, 0xCA, 0xEC, 0x5E, 0x07, 0xB1, 0xE8,
+    0x3E, 0xBB, 0x79, 0x62, 0x5B, 0xA3, 0x54, 0xE6
+  },
+  {
+    0xE0, 0x8D, 0x38, 0x9F, 0x75, 0x69, 0x4A, 0xDC,
+    0x99, 0x6C, 0x22, 0xF5, 0x5D, 0x4F, 0x85, 0x9F,
+    0xFD, 0x0C, 0x13, 0x19, 0xFF, 0x9C, 0xED, 0xF7,
+    0x8C, 0x31, 0xBE, 0x84, 0xB6, 0xF2, 0x1A, 0xBC
+  },
+  {
+    0x13, 0x63, 0xE2, 0x29, 0x13, 0xC6, 0xE1, 0x8E,
+    0x7A, 0xA6, 0x5B, 0x83, 0xE7, 0x51, 0xC8, 0xA2,
+    0xC6, 0x1B, 0x0F, 0x30, 0x71, 0x55, 0x86, 0x5A,
+    0x57, 0xDB, 0xA5, 0x69, 0xA9, 0x9C, 0x7B, 0x0E
+  },
+  {
+    0x88, 0x78, 0x08, 0x8E, 0xB2, 0xD1, 0xF6, 0xD0,
+    0xBB, 0x48, 0x1B, 0x4B, 0xB1, 0x87, 0xDA, 0x04,
+    0xBC, 0xD8, 0xC2, 0xC6, 0x39, 0xF0, 0x05, 0xB0,
+    0x80, 0x54, 0xCC, 0x41, 0x75, 0x39, 0x05, 0xFB
+  },
+  {
+    0x04, 0x18, 0xD6, 0x0D, 0x05, 0xB4, 0xE1, 0x24,
+    0x64, 0x6E, 0xE5, 0x0E, 0x77, 0x49, 0xA1, 0xD2,
+    0x09, 0x45, 0x7B, 0xC5, 0x43, 0xE3, 0xCC, 0x11,
+    0x30, 0x27, 0x4A, 0xEA, 0x0F, 0x7B, 0xF3, 0xC1
+  },
+  {
+    0x7A, 0x39, 0x7E, 0x50, 0x3F, 0x29, 0x3B, 0xC4,
+    0x2D, 0x5F, 0x7E, 0xF5, 0xEC, 0x37, 0x87, 0x24,
+    0x60, 0xA4, 0xF5, 0xB5, 0xCC, 0xDE, 0x77, 0xFB,
+    0x4D, 0x47, 0xAC, 0x06, 0x81, 0xE5, 0xA0, 0x49
+  },
+  {
+    0x5C, 0x0D, 0x29, 0x83, 0xE7, 0x2A, 0x6D, 0xD4,
+    0xE6, 0x52, 0xD7, 0x23, 0xC1, 0xDF, 0xC1, 0x2B,
+    0x41, 0x4C, 0x87, 0x3D, 0x4A, 0xB4, 0xA0, 0xA1,
+    0x50, 0x40, 0x8E, 0xB3, 0x43, 0x47, 0xE9, 0x95
+  },
+  {
+    0x56, 0x23, 0x36, 0x54, 0x53, 0xC0, 0x49, 0x89,
+    0xC7, 0xCF, 0x33, 0x63, 0x5E, 0x0F, 0xC4, 0xCD,
+    0xDD, 0x68, 0x6F, 0xC9, 0x5A, 0x33, 0xDF, 0xED,
+    0xCF, 0x33, 0x35, 0x79, 0x4C, 0x7D, 0xC3, 0x44
+  },
+  {
+    0x11, 0xF6, 0xDA, 0xD1, 0x88, 0x02, 0x8F, 0xDF,
+    0x13, 0x78, 0xA2, 0x56, 0xE4, 0x57, 0x0E, 0x90,
+    0x63, 0x10, 0x7B, 0x8F, 0x79, 0xDC, 0x66, 0x3F,
+    0xA5, 0x55, 0x6F, 0x56, 0xFD, 0x44, 0xA0, 0xF0
+  },
+  {
+    0x0E, 0xD8, 0x16, 0x17, 0x97, 0xEC, 0xEE, 0x88,
+    0x1E, 0x7D, 0x0E, 0x3F, 0x4C, 0x5F, 0xB8, 0x39,
+    0xC8, 0x4E, 0xB7, 0xA9, 0x24, 0x26, 0x57, 0xCC,
+    0x48, 0x30, 0x68, 0x07, 0xB3, 0x2B, 0xEF, 0xDE
+  },
+  {
+    0x73, 0x66, 0x67, 0xC9, 0x36, 0x4C, 0xE1, 0x2D,
+    0xB8, 0xF6, 0xB1, 0x43, 0xC6, 0xC1, 0x78, 0xCD,
+    0xEF, 0x1E, 0x14, 0x45, 0xBC, 0x5A, 0x2F, 0x26,
+    0x34, 0xF0, 0x8E, 0x99, 0x32, 0x27, 0x3C, 0xAA
+  },
+  {
+    0xE1, 0x5F, 0x36, 0x8B, 0x44, 0x06, 0xC1, 0xF6,
+    0x55, 0x57, 0xC8, 0x35, 0x5C, 0xBE, 0x69, 0x4B,
+    0x63, 0x3E, 0x26, 0xF1, 0x55, 0xF5, 0x2B, 0x7D,
+    0xA9, 0x4C, 0xFB, 0x23, 0xFD, 0x4A, 0x5D, 0x96
+  },
+  {
+    0x43, 0x7A, 0xB2, 0xD7, 0x4F, 0x50, 0xCA, 0x86,
+    0xCC, 0x3D, 0xE9, 0xBE, 0x70, 0xE4, 0x55, 0x48,
+    0x25, 0xE3, 0x3D, 0x82, 0x4B, 0x3A, 0x49, 0x23,
+    0x62, 0xE2, 0xE9, 0xD6, 0x11, 0xBC, 0x57, 0x9D
+  },
+  {
+    0x2B, 0x91, 0x58, 0xC7, 0x22, 0x89, 0x8E, 0x52,
+    0x6D, 0x2C, 0xDD, 0x3F, 0xC0, 0x88, 0xE9, 0xFF,
+    0xA7, 0x9A, 0x9B, 0x73, 0xB7, 0xD2, 0xD2, 0x4B,
+    0xC4, 0x78, 0xE2, 0x1C, 0xDB, 0x3B, 0x67, 0x63
+  },
+  {
+    0x0C, 0x8A, 0x36, 0x59, 0x7D, 0x74, 0x61, 0xC6,
+    0x3A, 0x94, 0x73, 0x28, 0x21, 0xC9, 0x41, 0x85,
+    0x6C, 0x66, 0x83, 0x76, 0x60, 0x6C, 0x86, 0xA5,
+    0x2D, 0xE0, 0xEE, 0x41, 0x04, 0xC6, 0x15, 0xDB
+  },
+};
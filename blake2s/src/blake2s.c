@@ -1,9 +1,17 @@
 #include "blake2s.h"
+#include "blake2s_impl.h"
 #include <math.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <pthread.h>
+#endif
+
 
 /**
  * Helper macro to perform rotation in a 32 bit int
@@ -14,26 +22,6 @@
 
 #define ROTR32(w, c) ((w) >> (c)) | ((w) << (32 - (c)))
 
-/**
- * Helper macro to load into src 32 bytes at a time
- *
- * @param[in]  dest  the destination
- * @param[in]  src   the source
- */
-
-#if defined(NATIVE_LITTLE_ENDIAN)
-  #define LOAD32(dest, src) memcpy(&(dest), (src), sizeof (dest))
-#else
-  #define LOAD32(dest, src)                                          \
-    do {                                                             \
-    const uint8_t* load = (const uint8_t*)(src);                     \
-    dest = ((uint64_t)(load[0]) <<  0) |                             \
-           ((uint64_t)(load[1]) <<  8) |                             \
-           ((uint64_t)(load[2]) << 16) |                             \
-           ((uint64_t)(load[3]) << 24);                              \
-    } while(0)
-#endif
-
 /**
  * Stores w into dst
  *
@@ -108,33 +96,80 @@ void blake2s_increment_counter(blake2s_state* state, const uint32_t inc)
   b = ROTR32(b ^ c,  7);          \
   } while(0)
 
+#if defined(BLAKE2S_UNROLL)
 /**
- * The blake2s compress function which takes a full 64-byte chunk of the
- * input message and mixes it into the ongoing state array
+ * Message word k of round r
+ */
+
+#define M(r, k) m[blake2s_sigma[r][k]]
+
+/**
+ * One full round of the compress function. r must be a literal: every
+ * blake2s_sigma lookup then folds to a constant and each message word is a
+ * fixed register or stack slot instead of a dynamically indexed m[s[k]].
  *
- * @param      state  blake2s_state instance
- * @param      block  the input block
+ * @param[in]  r     the round number
  */
 
-static void F(blake2s_state* state, const uint8_t block[BLAKE2S_BLOCKBYTES])
+#define ROUND(r)                                              \
+  do {                                                        \
+  G(v[0], v[4],  v[8], v[12],  M(r, 0),  M(r, 1));            \
+  G(v[1], v[5],  v[9], v[13],  M(r, 2),  M(r, 3));            \
+  G(v[2], v[6], v[10], v[14],  M(r, 4),  M(r, 5));            \
+  G(v[3], v[7], v[11], v[15],  M(r, 6),  M(r, 7));            \
+  G(v[0], v[5], v[10], v[15],  M(r, 8),  M(r, 9));            \
+  G(v[1], v[6], v[11], v[12], M(r, 10), M(r, 11));            \
+  G(v[2], v[7],  v[8], v[13], M(r, 12), M(r, 13));            \
+  G(v[3], v[4],  v[9], v[14], M(r, 14), M(r, 15));            \
+  } while(0)
+#endif
+
+/**
+ * Mixes one full 64-byte block into a chaining value. It works on plain
+ * arrays rather than a blake2s_state so that, inlined into the loop of
+ * F_blocks, h and t stay in registers from one block to the next.
+ *
+ * @param      h      the chaining value
+ * @param[in]  t      the counter, including this block
+ * @param[in]  f      the finalization flags
+ * @param[in]  block  the input block
+ */
+
+BLAKE2S_INLINE void blake2s_block(uint32_t h[8], const uint32_t t[2], const uint32_t f[2], const uint8_t block[BLAKE2S_BLOCKBYTES])
 {
-  size_t i, j;
-  uint32_t v[16], s[16], m[16];
+  size_t i;
+  uint32_t v[16], m[16];
+#if !defined(BLAKE2S_UNROLL)
+  size_t j;
+  uint32_t s[16];
+#endif
 
   for( i = 0; i < 16; ++i ) {
      LOAD32( m[i], block + i * sizeof( m[i] ) );
   }
 
   for (i = 0; i < 8; ++i) {
-    v[i] = state->h[i];
+    v[i] = h[i];
     v[i + 8] = blake2s_IV[i];
   }
 
-  v[12] ^= state->t[0];
-  v[13] ^= state->t[1];
-  v[14] ^= state->f[0];
-  v[15] ^= state->f[1];
-
+  v[12] ^= t[0];
+  v[13] ^= t[1];
+  v[14] ^= f[0];
+  v[15] ^= f[1];
+
+#if defined(BLAKE2S_UNROLL)
+  ROUND(0);
+  ROUND(1);
+  ROUND(2);
+  ROUND(3);
+  ROUND(4);
+  ROUND(5);
+  ROUND(6);
+  ROUND(7);
+  ROUND(8);
+  ROUND(9);
+#else
   for (i = 0; i < 10; i++) {
     for (j = 0; j < 16; j++) {
       s[j] = blake2s_sigma[i][j];
@@ -148,65 +183,341 @@ static void F(blake2s_state* state, const uint8_t block[BLAKE2S_BLOCKBYTES])
     G(v[2], v[7],  v[8], v[13], m[s[12]], m[s[13]]);
     G(v[3], v[4],  v[9], v[14], m[s[14]], m[s[15]]);
   }
+#endif
 
   for (i = 0; i < 8; i++) {
-    state->h[i] = state->h[i] ^ v[i] ^ v[i + 8];
+    h[i] = h[i] ^ v[i] ^ v[i + 8];
   }
 }
 
 /**
- * Initializes blake2s state
+ * The blake2s compress function which takes a full 64-byte chunk of the
+ * input message and mixes it into the ongoing state array
  *
- * @param      state   blake2s_state instance passed by reference
- * @param[in]  outlen  the hash output length
- * @param[in]  key     the key used
- * @param[in]  keylen  the key length
+ * @param      state  blake2s_state instance
+ * @param      block  the input block
  */
 
-void blake2s_init(blake2s_state* state, size_t outlen, const void* key, size_t keylen)
+static void F(blake2s_state* state, const uint8_t block[BLAKE2S_BLOCKBYTES])
 {
-  blake2s_param P = {0};
-  const uint8_t* p;
+  blake2s_block(state->h, state->t, state->f, block);
+}
+
+/**
+ * Compresses consecutive full blocks that are not the last block of the
+ * message, advancing the counter by one block before each of them. The
+ * chaining value and counter are loaded once and stored once, instead of
+ * going through the state in memory for every block.
+ *
+ * @param      state    blake2s_state instance
+ * @param[in]  in       the input blocks
+ * @param[in]  nblocks  the number of blocks
+ */
+
+static void F_blocks(blake2s_state* state, const uint8_t* in, size_t nblocks)
+{
+  uint32_t h[8], t[2];
   size_t i;
-  uint32_t dest;
 
-  /* initialize key */
-  
-  P.digest_length = (uint8_t)outlen;
-  P.key_length = (uint8_t)keylen;
-  P.fanout = 1;
-  P.depth = 1;
-  store32(( uint8_t * )&P.leaf_length, 0);
-  store32(( uint8_t * )&P.node_offset, 0);
-  store16(( uint8_t * )&P.xof_length, 0);
-  P.node_depth = 0;
-  P.inner_length = 0;
-  memset(P.salt, 0, sizeof(P.salt));
-  memset(P.personal, 0, sizeof(P.personal));
+  for (i = 0; i < 8; ++i) {
+    h[i] = state->h[i];
+  }
+  t[0] = state->t[0];
+  t[1] = state->t[1];
+
+  for (; nblocks > 0; --nblocks) {
+    t[0] += BLAKE2S_BLOCKBYTES;
+    t[1] += (t[0] < BLAKE2S_BLOCKBYTES);
+    blake2s_block(h, t, state->f, in);
+    in += BLAKE2S_BLOCKBYTES;
+  }
 
-  /*initialize param*/
+  for (i = 0; i < 8; ++i) {
+    state->h[i] = h[i];
+  }
+  state->t[0] = t[0];
+  state->t[1] = t[1];
+}
 
-  p = (const uint8_t*)(&P); 
-  memset(state, 0, sizeof(blake2s_state));
+/**
+ * The compress functions blake2s can pick from, best first. A kernel is only
+ * used when the CPU has all of its features.
+ */
 
-  for (i = 0; i < 8; ++i){
-    state->h[i] = blake2s_IV[i];
+typedef struct blake2s_kernel
+{
+  const char* name;
+  int features;
+  blake2s_compress_fn compress;
+  blake2s_blocks_fn compress_blocks;
+  blake2s_lanes_fn compress_x8;  /* NULL to compress lanes one by one */
+  blake2s_lanes_fn compress_x16; /* NULL to use compress_x8 */
+} blake2s_kernel;
+
+/* There is no single-stream AVX2 kernel, the "avx2" set only adds lanes */
+
+static const blake2s_kernel blake2s_kernels[] = {
+#if defined(BLAKE2S_X86)
+  /* The avx512 set also runs the AVX2 x8 kernel */
+  { "avx512", BLAKE2S_CPU_AVX512 | BLAKE2S_CPU_AVX2, blake2s_compress_avx512, blake2s_compress_blocks_avx512, blake2s_compress_x8_avx2, blake2s_compress_x16_avx512 },
+  { "avx2", BLAKE2S_CPU_SSE41 | BLAKE2S_CPU_AVX2, blake2s_compress_sse41, blake2s_compress_blocks_sse41, blake2s_compress_x8_avx2, NULL },
+  { "sse41", BLAKE2S_CPU_SSE41, blake2s_compress_sse41, blake2s_compress_blocks_sse41, NULL, NULL },
+#endif
+  { "ref", 0, F, F_blocks, NULL, NULL }
+};
+
+#define BLAKE2S_NKERNELS (sizeof(blake2s_kernels) / sizeof(blake2s_kernels[0]))
+
+/**
+ * Kernel set in use. Nothing reads these before blake2s_kernel_init, which
+ * picks the set exactly once, so threads making their first calls at the
+ * same time neither race on them nor see a half-written set.
+ */
+
+static blake2s_compress_fn blake2s_compress = F;
+static blake2s_blocks_fn blake2s_compress_blocks = F_blocks;
+static blake2s_lanes_fn blake2s_compress_x8 = NULL;
+static blake2s_lanes_fn blake2s_compress_x16 = NULL;
+static const char* blake2s_compress_name = NULL;
+
+/**
+ * Stores the pointers of a kernel set
+ *
+ * @param[in]  name  the name of the set, or NULL for the best one this CPU
+ *                   supports
+ *
+ * @return     0 on success, -1 if the kernel is unknown or unsupported
+ */
+
+static int blake2s_kernel_set(const char* name)
+{
+  int features = blake2s_cpu_features();
+  size_t i;
+
+  for (i = 0; i < BLAKE2S_NKERNELS; ++i) {
+    if ((blake2s_kernels[i].features & features) != blake2s_kernels[i].features) {
+      continue;
+    }
+    if (name == NULL || strcmp(name, blake2s_kernels[i].name) == 0) {
+      blake2s_compress_name = blake2s_kernels[i].name;
+      blake2s_compress = blake2s_kernels[i].compress;
+      blake2s_compress_blocks = blake2s_kernels[i].compress_blocks;
+      blake2s_compress_x8 = blake2s_kernels[i].compress_x8;
+      blake2s_compress_x16 = blake2s_kernels[i].compress_x16;
+      return 0;
+    }
+  }
+  return -1;
+}
+
+/**
+ * Picks the kernel set on first use. The BLAKE2S_KERNEL environment variable
+ * forces a particular kernel, e.g. for benchmarking; unknown or unsupported
+ * names fall back to the best one available.
+ */
+
+static void blake2s_kernel_pick(void)
+{
+  const char* forced = getenv("BLAKE2S_KERNEL");
+
+  if (forced == NULL || blake2s_kernel_set(forced) != 0) {
+    blake2s_kernel_set(NULL);
+  }
+}
+
+#if defined(_WIN32)
+static INIT_ONCE blake2s_kernel_once = INIT_ONCE_STATIC_INIT;
+
+/**
+ * InitOnceExecuteOnce callback around blake2s_kernel_pick
+ */
+
+static BOOL CALLBACK blake2s_kernel_pick_once(PINIT_ONCE once, PVOID arg, PVOID* ctx)
+{
+  (void)once;
+  (void)arg;
+  (void)ctx;
+  blake2s_kernel_pick();
+  return TRUE;
+}
+#else
+static pthread_once_t blake2s_kernel_once = PTHREAD_ONCE_INIT;
+#endif
+
+/**
+ * Picks the kernel set unless that is already done. Every function reading
+ * the kernel pointers calls this first; the once-only initialization also
+ * makes the stores of the thread that picked visible to every other one.
+ */
+
+static void blake2s_kernel_init(void)
+{
+#if defined(_WIN32)
+  InitOnceExecuteOnce(&blake2s_kernel_once, blake2s_kernel_pick_once, NULL, NULL);
+#else
+  pthread_once(&blake2s_kernel_once, blake2s_kernel_pick);
+#endif
+}
+
+/**
+ * Selects the compress function used from now on. Must not be called while
+ * other threads are hashing.
+ *
+ * @param[in]  name  one of "avx512", "avx2", "sse41" or "ref", or NULL for
+ *                   the best kernel this CPU supports
+ *
+ * @return     0 on success, -1 if the kernel is unknown or unsupported
+ */
+
+int blake2s_select_kernel(const char* name)
+{
+  blake2s_kernel_init();
+  return blake2s_kernel_set(name);
+}
+
+/**
+ * Returns the name of the compress function in use, selecting it first if
+ * nothing has been hashed yet
+ */
+
+const char* blake2s_kernel_name(void)
+{
+  blake2s_kernel_init();
+  return blake2s_compress_name;
+}
+
+/**
+ * Compresses one full 64-byte block into each of the lanes 0 .. nlanes-1,
+ * sixteen or eight at a time with the multi-lane kernels of the selected
+ * kernel set and the remaining ones with the single-stream compress function
+ *
+ * @param      lanes   the transposed states
+ * @param[in]  blocks  one input block per lane
+ * @param[in]  nlanes  the number of lanes to compress
+ */
+
+void blake2s_compress_lanes(blake2s_lanes* lanes, const uint8_t* const blocks[], size_t nlanes)
+{
+  blake2s_state state;
+  size_t lane = 0;
+  size_t i;
+
+  blake2s_kernel_init();
+
+  if (blake2s_compress_x16 != NULL) {
+    for (; lane + 16 <= nlanes; lane += 16) {
+      blake2s_compress_x16(lanes, lane, blocks + lane);
+    }
+  }
+  if (blake2s_compress_x8 != NULL) {
+    for (; lane + 8 <= nlanes; lane += 8) {
+      blake2s_compress_x8(lanes, lane, blocks + lane);
+    }
   }
+
+  for (; lane < nlanes; ++lane) {
+    for (i = 0; i < 8; ++i) {
+      state.h[i] = lanes->h[i][lane];
+    }
+    state.t[0] = lanes->t[0][lane];
+    state.t[1] = lanes->t[1][lane];
+    state.f[0] = lanes->f[0][lane];
+    state.f[1] = lanes->f[1][lane];
+    blake2s_compress(&state, blocks[lane]);
+    for (i = 0; i < 8; ++i) {
+      lanes->h[i][lane] = state.h[i];
+    }
+  }
+}
+
+/**
+ * Initializes blake2s state from a full parameter block, for the tree modes
+ * and any other use that needs more than the digest and key length
+ *
+ * @param      state  blake2s_state instance passed by reference
+ * @param[in]  P      the parameter block
+ */
+
+void blake2s_init_param(blake2s_state* state, const blake2s_param* P)
+{
+  const uint8_t* p = (const uint8_t*)P;
+  size_t i;
+  uint32_t dest;
+
+  memset(state, 0, sizeof(blake2s_state));
+
   for (i = 0; i < 8; ++i){
     LOAD32(dest, p + sizeof(state->h[i]) * i);
-    state->h[i] ^= dest;
-   }
-  state->outlen = P.digest_length;
+    state->h[i] = blake2s_IV[i] ^ dest;
+  }
+  state->outlen = P->digest_length;
+}
+
+/**
+ * Initializes blake2s state from a full parameter block and absorbs the key
+ *
+ * @param      state  blake2s_state instance passed by reference
+ * @param[in]  P      the parameter block
+ * @param[in]  key    the key, P->key_length bytes, may be NULL if that is 0
+ */
+
+void blake2s_init_param_key(blake2s_state* state, const blake2s_param* P, const void* key)
+{
+  blake2s_init_param(state, P);
 
-  if (keylen > 0) {
+  if (P->key_length > 0) {
     uint8_t block[BLAKE2S_BLOCKBYTES];
     memset(block, 0, BLAKE2S_BLOCKBYTES);
-    memcpy(block, key, keylen);
+    memcpy(block, key, P->key_length);
     blake2s_update(state, block, BLAKE2S_BLOCKBYTES);
-    
+    memset(block, 0, BLAKE2S_BLOCKBYTES);
   }
 }
 
+/**
+ * Initializes blake2s state with a salt and a personalization string, which
+ * separate the digests of different uses of the same key at no cost
+ *
+ * @param      state     blake2s_state instance passed by reference
+ * @param[in]  outlen    the hash output length
+ * @param[in]  key       the key
+ * @param[in]  keylen    the key length
+ * @param[in]  salt      the 8-byte salt, or NULL for none
+ * @param[in]  personal  the 8-byte personalization string, or NULL for none
+ */
+
+void blake2s_init_salt_personal(blake2s_state* state, size_t outlen, const void* key, size_t keylen,
+        const void* salt, const void* personal)
+{
+  blake2s_param P = {0};
+
+  P.digest_length = (uint8_t)outlen;
+  P.key_length = (uint8_t)keylen;
+  P.fanout = 1;
+  P.depth = 1;
+  if (salt != NULL) {
+    memcpy(P.salt, salt, BLAKE2S_SALTBYTES);
+  }
+  if (personal != NULL) {
+    memcpy(P.personal, personal, BLAKE2S_PERSONALBYTES);
+  }
+  blake2s_init_param_key(state, &P, key);
+}
+
+/**
+ * Initializes blake2s state
+ *
+ * @param      state   blake2s_state instance passed by reference
+ * @param[in]  outlen  the hash output length
+ * @param[in]  key     the key used
+ * @param[in]  keylen  the key length
+ */
+
+void blake2s_init(blake2s_state* state, size_t outlen, const void* key, size_t keylen)
+{
+  blake2s_init_salt_personal(state, outlen, key, keylen, NULL, NULL);
+}
+
 /**
  * Updates blake2s state
  *
@@ -229,25 +540,54 @@ void blake2s_update(blake2s_state* state, const unsigned char* input_buffer, siz
     
     if( inlen > fill )
     {
+      blake2s_kernel_init();
       state->buflen = 0;
       memcpy( state->buf + left, in, fill ); /* Fill buffer */
       blake2s_increment_counter( state, BLAKE2S_BLOCKBYTES );
-      F( state, state->buf ); /* Compress */
+      blake2s_compress( state, state->buf ); /* Compress */
       in += fill; 
       inlen -= fill;
 
-      while (inlen > BLAKE2S_BLOCKBYTES) {
-        blake2s_increment_counter(state, BLAKE2S_BLOCKBYTES);
-        F(state, in);
-        in += BLAKE2S_BLOCKBYTES;
-        inlen -= BLAKE2S_BLOCKBYTES;
-    }
+      /* Every full block but the last one, which may end the message */
+      if (inlen > BLAKE2S_BLOCKBYTES) {
+        size_t nblocks = (inlen - 1) / BLAKE2S_BLOCKBYTES;
+
+        blake2s_compress_blocks(state, in, nblocks);
+        in += nblocks * BLAKE2S_BLOCKBYTES;
+        inlen -= nblocks * BLAKE2S_BLOCKBYTES;
+      }
   }
   memcpy(state->buf + state->buflen, in, inlen);
   state->buflen += inlen;
   }
 }
 
+/**
+ * Copies a state, e.g. to fork the hash of a common prefix into the hashes
+ * of several messages that continue it differently. Only the buffered part
+ * of the input buffer is copied.
+ *
+ * @param[out] dst   the new state
+ * @param[in]  src   the state to copy
+ */
+
+void blake2s_clone(blake2s_state* dst, const blake2s_state* src)
+{
+  size_t i;
+
+  for (i = 0; i < 8; ++i) {
+    dst->h[i] = src->h[i];
+  }
+  dst->t[0] = src->t[0];
+  dst->t[1] = src->t[1];
+  dst->f[0] = src->f[0];
+  dst->f[1] = src->f[1];
+  memcpy(dst->buf, src->buf, src->buflen);
+  dst->buflen = src->buflen;
+  dst->outlen = src->outlen;
+  dst->last_node = src->last_node;
+}
+
 /**
  * Finalizes state, pads final block and stores hash
  *
@@ -264,9 +604,13 @@ void blake2s_final(blake2s_state* state, void* out, size_t outlen)
   blake2s_increment_counter(state, state->buflen);
   
   state->f[0] = UINT32_MAX;
+  if (state->last_node) {
+    state->f[1] = UINT32_MAX;
+  }
   memset(state->buf + state->buflen, 0, BLAKE2S_BLOCKBYTES - state->buflen);
   
-  F(state, state->buf);
+  blake2s_kernel_init();
+  blake2s_compress(state, state->buf);
   for (i = 0; i < 8; ++i){
     store32(buffer + sizeof(state->h[i]) * i, state->h[i]);
   }
@@ -274,6 +618,48 @@ void blake2s_final(blake2s_state* state, void* out, size_t outlen)
   memcpy(out, buffer, state->outlen);
 }
 
+/**
+ * Unkeyed blake2s of a message that fits in one block, which is also the
+ * last block: a single compression. The default parameter block only has the
+ * digest length, fanout and depth in its first word, so the chaining value is
+ * the IV with that word folded in, the counter is the message length and the
+ * padded block is built straight from the input. None of the state set-up,
+ * buffering and padding of init, update and final is needed.
+ *
+ * @param      output  the hash output
+ * @param[in]  outlen  the hash length
+ * @param[in]  input   the message input
+ * @param[in]  inlen   the message length, at most BLAKE2S_BLOCKBYTES
+ */
+
+static void blake2s_short(void* output, size_t outlen, const void* input, size_t inlen)
+{
+  uint8_t block[BLAKE2S_BLOCKBYTES];
+  uint8_t buffer[BLAKE2S_OUTBYTES];
+  blake2s_state state;
+  size_t i;
+
+  /* Digest length, key length 0, fanout 1, depth 1 */
+  state.h[0] = blake2s_IV[0] ^ 0x01010000 ^ (uint32_t)outlen;
+  for (i = 1; i < 8; ++i) {
+    state.h[i] = blake2s_IV[i];
+  }
+  state.t[0] = (uint32_t)inlen;
+  state.t[1] = 0;
+  state.f[0] = UINT32_MAX;
+  state.f[1] = 0;
+
+  memcpy(block, input, inlen);
+  memset(block + inlen, 0, BLAKE2S_BLOCKBYTES - inlen);
+  blake2s_kernel_init();
+  blake2s_compress(&state, block);
+
+  for (i = 0; i < (outlen + 3) / 4; ++i) {
+    store32(buffer + sizeof(state.h[i]) * i, state.h[i]);
+  }
+  memcpy(output, buffer, outlen);
+}
+
 /**
  * The main blake2s function
  *
@@ -288,9 +674,57 @@ void blake2s_final(blake2s_state* state, void* out, size_t outlen)
 void blake2s(void* output, size_t outlen, const void* input, size_t inlen,
         const void* key, size_t keylen)
 {
-  blake2s_state state = {0};
-   
+  blake2s_state state;
+
+  if (keylen == 0 && inlen <= BLAKE2S_BLOCKBYTES) {
+    blake2s_short(output, outlen, input, inlen);
+    return;
+  }
+
   blake2s_init(&state, outlen, key, keylen);
   blake2s_update(&state, (const uint8_t*)input, inlen);
   blake2s_final(&state, output, outlen);
-}
\ No newline at end of file
+}
+
+/**
+ * Hashes a message under a full parameter block: salt, personalization and
+ * tree parameters. The digest is P->digest_length bytes.
+ *
+ * @param      output  the hash output
+ * @param[in]  input   the message input
+ * @param[in]  inlen   the message length
+ * @param[in]  key     the key, P->key_length bytes
+ * @param[in]  P       the parameter block
+ */
+
+void blake2s_param_hash(void* output, const void* input, size_t inlen, const void* key, const blake2s_param* P)
+{
+  blake2s_state state;
+
+  blake2s_init_param_key(&state, P, key);
+  blake2s_update(&state, (const uint8_t*)input, inlen);
+  blake2s_final(&state, output, P->digest_length);
+}
+
+/**
+ * blake2s with a salt and a personalization string
+ *
+ * @param      output    the hash output
+ * @param[in]  outlen    the hash length
+ * @param[in]  input     the message input
+ * @param[in]  inlen     the message length
+ * @param[in]  key       the key
+ * @param[in]  keylen    the key length
+ * @param[in]  salt      the 8-byte salt, or NULL for none
+ * @param[in]  personal  the 8-byte personalization string, or NULL for none
+ */
+
+void blake2s_salt_personal(void* output, size_t outlen, const void* input, size_t inlen,
+        const void* key, size_t keylen, const void* salt, const void* personal)
+{
+  blake2s_state state;
+
+  blake2s_init_salt_personal(&state, outlen, key, keylen, salt, personal);
+  blake2s_update(&state, (const uint8_t*)input, inlen);
+  blake2s_final(&state, output, outlen);
+}
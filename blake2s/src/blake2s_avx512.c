@@ -0,0 +1,193 @@
+#include "blake2s_impl.h"
+#include <stdint.h>
+#include <string.h>
+
+#include <immintrin.h>
+
+/**
+ * AVX-512VL implementation of the blake2s compress function.
+ *
+ * Each row of the work vector v lives in one XMM register:
+ *
+ *   a = v[0],  v[1],  v[2],  v[3]
+ *   b = v[4],  v[5],  v[6],  v[7]
+ *   c = v[8],  v[9],  v[10], v[11]
+ *   d = v[12], v[13], v[14], v[15]
+ *
+ * so one pass of G1/G2 mixes all four columns. For the diagonal step rows b,
+ * c and d are rotated by one, two and three words with pshufd, and rotated
+ * back afterwards. Every rotation is a single vprord and the three-way XORs
+ * of the feed-forward are fused with vpternlogd.
+ */
+
+/**
+ * Helper macro to rotate the four 32-bit words of an XMM register right by c
+ * bits with a native vector rotate
+ *
+ * @param[in]  x     the register to rotate
+ * @param[in]  c     offset to rotate by
+ */
+
+#define ROTR32(x, c) _mm_ror_epi32((x), (c))
+
+/**
+ * Three-way XOR of XMM registers, a single vpternlogd
+ */
+
+#define XOR3(x, y, z) _mm_ternarylogic_epi32((x), (y), (z), 0x96)
+
+/**
+ * Loads the four message words of vector k (0..3) of round r. Both r and k
+ * are literals, so the schedule lookup is resolved at compile time and every
+ * word comes from a fixed slot of m.
+ */
+
+#define LOADMSG(r, k)                                                   \
+  _mm_set_epi32((int32_t)m[blake2s_vec_schedule[r][4 * (k) + 3]],       \
+                (int32_t)m[blake2s_vec_schedule[r][4 * (k) + 2]],       \
+                (int32_t)m[blake2s_vec_schedule[r][4 * (k) + 1]],       \
+                (int32_t)m[blake2s_vec_schedule[r][4 * (k) + 0]])
+
+/**
+ * First and second half of the blake2s mixing function on all four columns
+ * (or diagonals)
+ *
+ * @param  x     the message words to add into row a
+ */
+
+#define G1(x)                                                 \
+  do {                                                        \
+  a = _mm_add_epi32(_mm_add_epi32(a, (x)), b);                \
+  d = ROTR32(_mm_xor_si128(d, a), 16);                        \
+  c = _mm_add_epi32(c, d);                                    \
+  b = ROTR32(_mm_xor_si128(b, c), 12);                        \
+  } while(0)
+
+#define G2(x)                                                 \
+  do {                                                        \
+  a = _mm_add_epi32(_mm_add_epi32(a, (x)), b);                \
+  d = ROTR32(_mm_xor_si128(d, a), 8);                         \
+  c = _mm_add_epi32(c, d);                                    \
+  b = ROTR32(_mm_xor_si128(b, c), 7);                         \
+  } while(0)
+
+/**
+ * Rotates rows b, c and d so the diagonals line up as columns, and back
+ */
+
+#define DIAGONALIZE()                                         \
+  do {                                                        \
+  b = _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 3, 2, 1));          \
+  c = _mm_shuffle_epi32(c, _MM_SHUFFLE(1, 0, 3, 2));          \
+  d = _mm_shuffle_epi32(d, _MM_SHUFFLE(2, 1, 0, 3));          \
+  } while(0)
+
+#define UNDIAGONALIZE()                                       \
+  do {                                                        \
+  b = _mm_shuffle_epi32(b, _MM_SHUFFLE(2, 1, 0, 3));          \
+  c = _mm_shuffle_epi32(c, _MM_SHUFFLE(1, 0, 3, 2));          \
+  d = _mm_shuffle_epi32(d, _MM_SHUFFLE(0, 3, 2, 1));          \
+  } while(0)
+
+/**
+ * One full round
+ *
+ * @param[in]  r     the round number, must be a literal
+ */
+
+#define ROUND(r)                                              \
+  do {                                                        \
+  G1(LOADMSG(r, 0));                                          \
+  G2(LOADMSG(r, 1));                                          \
+  DIAGONALIZE();                                              \
+  G1(LOADMSG(r, 2));                                          \
+  G2(LOADMSG(r, 3));                                          \
+  UNDIAGONALIZE();                                            \
+  } while(0)
+
+/**
+ * Mixes one full 64-byte block into the chaining value h0, h1. Inlined into
+ * the loop of blake2s_compress_blocks_avx512, the chaining value stays in two
+ * XMM registers from one block to the next.
+ *
+ * @param      h0     chaining value words 0..3
+ * @param      h1     chaining value words 4..7
+ * @param[in]  tf     the counter and finalization flags, t[0], t[1], f[0], f[1]
+ * @param[in]  block  the input block
+ */
+
+BLAKE2S_INLINE void blake2s_block_avx512(__m128i* h0, __m128i* h1, __m128i tf, const uint8_t block[BLAKE2S_BLOCKBYTES])
+{
+  __m128i a, b, c, d;
+  uint32_t m[16];
+
+  /* x86 is little endian, the block can be copied as is */
+  memcpy(m, block, sizeof(m));
+
+  a = *h0;
+  b = *h1;
+  c = _mm_loadu_si128((const __m128i*)&blake2s_IV[0]);
+  d = _mm_xor_si128(_mm_loadu_si128((const __m128i*)&blake2s_IV[4]), tf);
+
+  ROUND(0);
+  ROUND(1);
+  ROUND(2);
+  ROUND(3);
+  ROUND(4);
+  ROUND(5);
+  ROUND(6);
+  ROUND(7);
+  ROUND(8);
+  ROUND(9);
+
+  *h0 = XOR3(*h0, a, c);
+  *h1 = XOR3(*h1, b, d);
+}
+
+/**
+ * The blake2s compress function which takes a full 64-byte chunk of the
+ * input message and mixes it into the ongoing state array
+ *
+ * @param      state  blake2s_state instance
+ * @param      block  the input block
+ */
+
+void blake2s_compress_avx512(blake2s_state* state, const uint8_t block[BLAKE2S_BLOCKBYTES])
+{
+  __m128i h0 = _mm_loadu_si128((const __m128i*)&state->h[0]);
+  __m128i h1 = _mm_loadu_si128((const __m128i*)&state->h[4]);
+
+  blake2s_block_avx512(&h0, &h1, _mm_loadu_si128((const __m128i*)&state->t[0]), block);
+
+  _mm_storeu_si128((__m128i*)&state->h[0], h0);
+  _mm_storeu_si128((__m128i*)&state->h[4], h1);
+}
+
+/**
+ * Compresses consecutive full blocks that are not the last block of the
+ * message, advancing the counter by one block before each of them
+ *
+ * @param      state    blake2s_state instance
+ * @param[in]  in       the input blocks
+ * @param[in]  nblocks  the number of blocks
+ */
+
+void blake2s_compress_blocks_avx512(blake2s_state* state, const uint8_t* in, size_t nblocks)
+{
+  __m128i h0 = _mm_loadu_si128((const __m128i*)&state->h[0]);
+  __m128i h1 = _mm_loadu_si128((const __m128i*)&state->h[4]);
+  uint32_t t0 = state->t[0], t1 = state->t[1];
+  uint32_t f0 = state->f[0], f1 = state->f[1];
+
+  for (; nblocks > 0; --nblocks) {
+    t0 += BLAKE2S_BLOCKBYTES;
+    t1 += (t0 < BLAKE2S_BLOCKBYTES);
+    blake2s_block_avx512(&h0, &h1, _mm_setr_epi32((int)t0, (int)t1, (int)f0, (int)f1), in);
+    in += BLAKE2S_BLOCKBYTES;
+  }
+
+  _mm_storeu_si128((__m128i*)&state->h[0], h0);
+  _mm_storeu_si128((__m128i*)&state->h[4], h1);
+  state->t[0] = t0;
+  state->t[1] = t1;
+}
@@ -0,0 +1,228 @@
+#include "blake2s.h"
+#include "blake2s_impl.h"
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Initializes one lane of a blake2s_lanes instance from a parameter block,
+ * like blake2s_init does for a blake2s_state
+ *
+ * @param      lanes  the transposed states
+ * @param[in]  lane   the lane to initialize
+ * @param[in]  P      the parameter block
+ */
+
+void blake2s_lanes_init(blake2s_lanes* lanes, size_t lane, const blake2s_param* P)
+{
+  const uint8_t* p = (const uint8_t*)P;
+  uint32_t dest;
+  size_t i;
+
+  for (i = 0; i < 8; ++i) {
+    LOAD32(dest, p + sizeof(dest) * i);
+    lanes->h[i][lane] = blake2s_IV[i] ^ dest;
+  }
+  lanes->t[0][lane] = 0;
+  lanes->t[1][lane] = 0;
+  lanes->f[0][lane] = 0;
+  lanes->f[1][lane] = 0;
+}
+
+/**
+ * Stores the first outlen bytes of the chained state of one lane, in little
+ * endian, like blake2s_final does
+ *
+ * @param      lanes   the transposed states
+ * @param[in]  lane    the lane to store
+ * @param[out] out     the output buffer
+ * @param[in]  outlen  the digest size
+ */
+
+void blake2s_lanes_store(const blake2s_lanes* lanes, size_t lane, uint8_t* out, size_t outlen)
+{
+  uint8_t buffer[BLAKE2S_OUTBYTES];
+  size_t i;
+
+  for (i = 0; i < 8; ++i) {
+    store32(buffer + sizeof(lanes->h[i][lane]) * i, lanes->h[i][lane]);
+  }
+  memcpy(out, buffer, outlen);
+}
+
+/**
+ * Copies the state of lane src over lane dst
+ *
+ * @param      lanes  the transposed states
+ * @param[in]  dst    the lane to overwrite
+ * @param[in]  src    the lane to copy
+ */
+
+void blake2s_lanes_move(blake2s_lanes* lanes, size_t dst, size_t src)
+{
+  size_t i;
+
+  for (i = 0; i < 8; ++i) {
+    lanes->h[i][dst] = lanes->h[i][src];
+  }
+  for (i = 0; i < 2; ++i) {
+    lanes->t[i][dst] = lanes->t[i][src];
+    lanes->f[i][dst] = lanes->f[i][src];
+  }
+}
+
+/**
+ * Starts hashing a message in one lane: initializes the lane like
+ * blake2s_init and points the cursor at the message
+ *
+ * @param      lanes   the transposed states
+ * @param[in]  lane    the lane to start
+ * @param[out] msg     the cursor of the lane
+ * @param[in]  outlen  the digest size
+ * @param[in]  in      the message
+ * @param[in]  inlen   the message length
+ * @param[in]  key     the key, may be NULL if keylen is 0
+ * @param[in]  keylen  the key length
+ */
+
+void blake2s_lane_msg_start(blake2s_lanes* lanes, size_t lane, blake2s_lane_msg* msg, size_t outlen,
+        const void* in, size_t inlen, const void* key, size_t keylen)
+{
+  size_t i;
+
+  /* Only the first word of a sequential-mode parameter block is non-zero */
+  lanes->h[0][lane] = blake2s_IV[0] ^ 0x01010000 ^ ((uint32_t)keylen << 8) ^ (uint32_t)outlen;
+  for (i = 1; i < 8; ++i) {
+    lanes->h[i][lane] = blake2s_IV[i];
+  }
+  lanes->t[0][lane] = 0;
+  lanes->t[1][lane] = 0;
+  lanes->f[0][lane] = 0;
+  lanes->f[1][lane] = 0;
+
+  msg->in = (const uint8_t*)in;
+  msg->inlen = inlen;
+  msg->key = keylen > 0 ? (const uint8_t*)key : NULL;
+  msg->keylen = keylen;
+  msg->final = 0;
+}
+
+/**
+ * Hands out the next block of the message in one lane and sets the counter
+ * and final flag of the lane for it. The padded key and a partial last block
+ * are copied into msg->buf, full blocks are read in place.
+ *
+ * @param      lanes  the transposed states
+ * @param[in]  lane   the lane of the message
+ * @param      msg    the cursor of the lane, msg->final must be 0
+ *
+ * @return     the block to compress next
+ */
+
+const uint8_t* blake2s_lane_msg_next(blake2s_lanes* lanes, size_t lane, blake2s_lane_msg* msg)
+{
+  const uint8_t* block;
+  size_t n;
+
+  if (msg->key != NULL) {
+    /* The padded key is the first block */
+    memset(msg->buf, 0, BLAKE2S_BLOCKBYTES);
+    memcpy(msg->buf, msg->key, msg->keylen);
+    msg->key = NULL;
+    msg->final = msg->inlen == 0;
+    block = msg->buf;
+    n = BLAKE2S_BLOCKBYTES;
+  } else if (msg->inlen > BLAKE2S_BLOCKBYTES) {
+    block = msg->in;
+    n = BLAKE2S_BLOCKBYTES;
+    msg->in += BLAKE2S_BLOCKBYTES;
+    msg->inlen -= BLAKE2S_BLOCKBYTES;
+  } else {
+    /* Last block, padded with zeros */
+    memset(msg->buf, 0, BLAKE2S_BLOCKBYTES);
+    memcpy(msg->buf, msg->in, msg->inlen);
+    msg->final = 1;
+    block = msg->buf;
+    n = msg->inlen;
+    msg->inlen = 0;
+  }
+
+  lanes->t[0][lane] += (uint32_t)n;
+  lanes->t[1][lane] += (lanes->t[0][lane] < n);
+  lanes->f[0][lane] = msg->final ? UINT32_MAX : 0;
+  return block;
+}
+
+/**
+ * Hashes n independent messages of the same length at once, one per lane
+ *
+ * @param      output  the n hash outputs
+ * @param[in]  outlen  the hash length
+ * @param[in]  input   the n message inputs
+ * @param[in]  inlen   the length of every message
+ * @param[in]  key     the key shared by all messages
+ * @param[in]  keylen  the key length
+ * @param[in]  n       the number of messages, at most BLAKE2S_MAX_LANES
+ */
+
+static void blake2s_lanes_hash(void* const output[], size_t outlen, const void* const input[], size_t inlen,
+        const void* key, size_t keylen, size_t n)
+{
+  blake2s_lanes lanes;
+  blake2s_lane_msg msgs[BLAKE2S_MAX_LANES];
+  const uint8_t* blocks[BLAKE2S_MAX_LANES];
+  size_t j;
+
+  for (j = 0; j < n; ++j) {
+    blake2s_lane_msg_start(&lanes, j, &msgs[j], outlen, input[j], inlen, key, keylen);
+  }
+
+  /* All lanes have the same length and reach their last block together */
+  do {
+    for (j = 0; j < n; ++j) {
+      blocks[j] = blake2s_lane_msg_next(&lanes, j, &msgs[j]);
+    }
+    blake2s_compress_lanes(&lanes, blocks, n);
+  } while (!msgs[0].final);
+
+  for (j = 0; j < n; ++j) {
+    blake2s_lanes_store(&lanes, j, (uint8_t*)output[j], outlen);
+  }
+}
+
+/**
+ * Hashes eight independent messages of the same length at once, one per
+ * 32-bit lane of an AVX2 register. The result is the same as eight blake2s()
+ * calls.
+ *
+ * @param      output  the eight hash outputs
+ * @param[in]  outlen  the hash length
+ * @param[in]  input   the eight message inputs
+ * @param[in]  inlen   the length of every message
+ * @param[in]  key     the key shared by all messages
+ * @param[in]  keylen  the key length
+ */
+
+void blake2s_x8(void* output[8], size_t outlen, const void* const input[8], size_t inlen,
+        const void* key, size_t keylen)
+{
+  blake2s_lanes_hash(output, outlen, input, inlen, key, keylen, 8);
+}
+
+/**
+ * Hashes sixteen independent messages of the same length at once, one per
+ * 32-bit lane of an AVX-512 register. The result is the same as sixteen
+ * blake2s() calls.
+ *
+ * @param      output  the sixteen hash outputs
+ * @param[in]  outlen  the hash length
+ * @param[in]  input   the sixteen message inputs
+ * @param[in]  inlen   the length of every message
+ * @param[in]  key     the key shared by all messages
+ * @param[in]  keylen  the key length
+ */
+
+void blake2s_x16(void* output[16], size_t outlen, const void* const input[16], size_t inlen,
+        const void* key, size_t keylen)
+{
+  blake2s_lanes_hash(output, outlen, input, inlen, key, keylen, 16);
+}
@@ -0,0 +1,109 @@
+#include "blake2s.h"
+#include "blake2s_impl.h"
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Keyed hashing with the key absorbed once. blake2s_init with a key runs a
+ * whole compression over the padded key block before any message byte; the
+ * context keeps the chained state after that compression, so every message
+ * hashed under it only pays for its own blocks.
+ *
+ * The key block is the last block of the empty message and is then
+ * compressed with the final flag set, so the context also keeps the digest of
+ * the empty message.
+ */
+
+/**
+ * Initializes a keyed hashing context
+ *
+ * @param[out] ctx     blake2s_mac_ctx instance passed by reference
+ * @param[in]  outlen  the digest size
+ * @param[in]  key     the key, may be NULL if keylen is 0
+ * @param[in]  keylen  the key length, 0 for unkeyed hashing
+ */
+
+void blake2s_mac_init(blake2s_mac_ctx* ctx, size_t outlen, const void* key, size_t keylen)
+{
+  static const uint8_t zero = 0;
+  blake2s_state state, empty;
+  size_t i;
+
+  blake2s_init(&state, outlen, key, keylen);
+  empty = state;
+  blake2s_final(&empty, ctx->empty, outlen);
+
+  /* One more byte pushes the key block through the compress function */
+  if (keylen > 0) {
+    blake2s_update(&state, &zero, 1);
+  }
+  memset(state.buf, 0, BLAKE2S_BLOCKBYTES);
+  memset(empty.buf, 0, BLAKE2S_BLOCKBYTES);
+
+  for (i = 0; i < 8; ++i) {
+    ctx->h[i] = state.h[i];
+  }
+  ctx->t = state.t[0];
+  ctx->outlen = outlen;
+}
+
+/**
+ * Starts hashing one message under the key of a context. The message is then
+ * fed with blake2s_update and the digest taken with blake2s_mac_final.
+ *
+ * @param[in]  ctx    blake2s_mac_ctx instance, only read
+ * @param[out] state  blake2s_state instance passed by reference
+ */
+
+void blake2s_mac_start(const blake2s_mac_ctx* ctx, blake2s_state* state)
+{
+  size_t i;
+
+  for (i = 0; i < 8; ++i) {
+    state->h[i] = ctx->h[i];
+  }
+  state->t[0] = ctx->t;
+  state->t[1] = 0;
+  state->f[0] = 0;
+  state->f[1] = 0;
+  state->buflen = 0;
+  state->outlen = ctx->outlen;
+  state->last_node = 0;
+}
+
+/**
+ * Finalizes a message started with blake2s_mac_start
+ *
+ * @param[in]  ctx    the blake2s_mac_ctx the message was started with
+ * @param      state  blake2s_state instance
+ * @param[out] out    the digest, ctx->outlen bytes
+ */
+
+void blake2s_mac_final(const blake2s_mac_ctx* ctx, blake2s_state* state, void* out)
+{
+  /* Nothing but the key block went in */
+  if (state->buflen == 0 && state->t[0] == ctx->t && state->t[1] == 0) {
+    memcpy(out, ctx->empty, ctx->outlen);
+    return;
+  }
+  blake2s_final(state, out, ctx->outlen);
+}
+
+/**
+ * Hashes one message under the key of a context. The context is only read,
+ * so any number of threads may share it.
+ *
+ * @param[in]  ctx    blake2s_mac_ctx instance
+ * @param[out] out    the digest, ctx->outlen bytes
+ * @param[in]  in     the message
+ * @param[in]  inlen  the message length
+ */
+
+void blake2s_mac(const blake2s_mac_ctx* ctx, void* out, const void* in, size_t inlen)
+{
+  blake2s_state state;
+
+  blake2s_mac_start(ctx, &state);
+  blake2s_update(&state, (const uint8_t*)in, inlen);
+  blake2s_mac_final(ctx, &state, out);
+}
@@ -0,0 +1,175 @@
+#include "blake2s.h"
+#include "blake2s_impl.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Prefix cache: the chained state after each whole block of a fixed prefix.
+ * The midstate after j blocks may only be resumed by a message longer than
+ * j blocks, since block j - 1 was compressed without the final flag. A
+ * message that is all prefix therefore resumes one block earlier and still
+ * compresses its last block, which is also where the digest differs.
+ */
+
+/**
+ * Resets a state to the midstate after some blocks of the prefix
+ *
+ * @param[in]  cache  blake2s_prefix instance
+ * @param[out] state  blake2s_state instance passed by reference
+ * @param[in]  j      the number of whole prefix blocks
+ */
+
+static void blake2s_prefix_resume(const blake2s_prefix* cache, blake2s_state* state, size_t j)
+{
+  uint32_t t = cache->mac.t + (uint32_t)(j * BLAKE2S_BLOCKBYTES);
+  size_t i;
+
+  blake2s_mac_start(&cache->mac, state);
+  if (j > 0) {
+    for (i = 0; i < 8; ++i) {
+      state->h[i] = cache->h[j][i];
+    }
+    state->t[0] = t;
+    state->t[1] = t < cache->mac.t;
+  }
+}
+
+/**
+ * Builds the prefix cache: compresses the key block and the prefix once and
+ * keeps the chained state at every block boundary
+ *
+ * @param[out] cache      blake2s_prefix instance passed by reference
+ * @param[in]  outlen     the digest size
+ * @param[in]  key        the key, may be NULL if keylen is 0
+ * @param[in]  keylen     the key length
+ * @param[in]  prefix     the prefix, copied into the cache
+ * @param[in]  prefixlen  the prefix length
+ *
+ * @return     0 on success, -1 if out of memory
+ */
+
+int blake2s_prefix_init(blake2s_prefix* cache, size_t outlen, const void* key, size_t keylen, const void* prefix, size_t prefixlen)
+{
+  static const uint8_t zero = 0;
+  blake2s_state state, next;
+  size_t i, j;
+
+  cache->prefixlen = prefixlen;
+  cache->blocks = prefixlen / BLAKE2S_BLOCKBYTES;
+  cache->prefix = (uint8_t*)malloc(prefixlen > 0 ? prefixlen : 1);
+  cache->h = (uint32_t(*)[8])malloc((cache->blocks + 1) * sizeof(*cache->h));
+  if (cache->prefix == NULL || cache->h == NULL) {
+    blake2s_prefix_free(cache);
+    return -1;
+  }
+  if (prefixlen > 0) {
+    memcpy(cache->prefix, prefix, prefixlen);
+  }
+
+  blake2s_mac_init(&cache->mac, outlen, key, keylen);
+  blake2s_mac_start(&cache->mac, &state);
+  for (i = 0; i < 8; ++i) {
+    cache->h[0][i] = state.h[i];
+  }
+
+  /* Block j - 1 is only compressed once the input goes on past it */
+  for (j = 1; j <= cache->blocks; ++j) {
+    blake2s_update(&state, cache->prefix + (j - 1) * BLAKE2S_BLOCKBYTES, BLAKE2S_BLOCKBYTES);
+    blake2s_clone(&next, &state);
+    blake2s_update(&next, &zero, 1);
+    for (i = 0; i < 8; ++i) {
+      cache->h[j][i] = next.h[i];
+    }
+  }
+  return 0;
+}
+
+/**
+ * Frees the memory of a prefix cache
+ *
+ * @param      cache  blake2s_prefix instance
+ */
+
+void blake2s_prefix_free(blake2s_prefix* cache)
+{
+  free(cache->prefix);
+  free(cache->h);
+  cache->prefix = NULL;
+  cache->h = NULL;
+}
+
+/**
+ * Starts hashing a message from the latest cached midstate it can use: the
+ * one after the whole prefix blocks the message starts with. The message is
+ * then fed with blake2s_update from the returned offset on, and the digest
+ * taken with blake2s_mac_final on cache->mac.
+ *
+ * @param[in]  cache  blake2s_prefix instance, only read
+ * @param[out] state  blake2s_state instance passed by reference
+ * @param[in]  in     the whole message
+ * @param[in]  inlen  the message length
+ *
+ * @return     the number of bytes of the message already absorbed
+ */
+
+size_t blake2s_prefix_start(const blake2s_prefix* cache, blake2s_state* state, const void* in, size_t inlen)
+{
+  const uint8_t* p = (const uint8_t*)in;
+  size_t j = 0;
+
+  while (j < cache->blocks && (j + 1) * BLAKE2S_BLOCKBYTES < inlen &&
+         memcmp(p + j * BLAKE2S_BLOCKBYTES, cache->prefix + j * BLAKE2S_BLOCKBYTES, BLAKE2S_BLOCKBYTES) == 0) {
+    ++j;
+  }
+  blake2s_prefix_resume(cache, state, j);
+  return j * BLAKE2S_BLOCKBYTES;
+}
+
+/**
+ * Hashes a message that may start with the prefix, or part of it, reusing
+ * the midstates of the whole prefix blocks it starts with. The digest is the
+ * same as that of blake2s over the message. The cache is only read, so any
+ * number of threads may share it.
+ *
+ * @param[in]  cache  blake2s_prefix instance
+ * @param[out] out    the digest
+ * @param[in]  in     the message
+ * @param[in]  inlen  the message length
+ */
+
+void blake2s_prefix_hash(const blake2s_prefix* cache, void* out, const void* in, size_t inlen)
+{
+  blake2s_state state;
+  size_t done;
+
+  done = blake2s_prefix_start(cache, &state, in, inlen);
+  blake2s_update(&state, (const uint8_t*)in + done, inlen - done);
+  blake2s_mac_final(&cache->mac, &state, out);
+}
+
+/**
+ * Hashes the prefix followed by a tail, without comparing or concatenating
+ * anything: only the tail and the prefix bytes past its last whole block are
+ * compressed.
+ *
+ * @param[in]  cache    blake2s_prefix instance
+ * @param[out] out      the digest
+ * @param[in]  tail     the rest of the message after the prefix
+ * @param[in]  taillen  the tail length
+ */
+
+void blake2s_prefix_tail(const blake2s_prefix* cache, void* out, const void* tail, size_t taillen)
+{
+  blake2s_state state;
+  size_t j = cache->blocks;
+
+  /* The last block of the message has to be compressed as such */
+  if (j > 0 && taillen == 0 && j * BLAKE2S_BLOCKBYTES == cache->prefixlen) {
+    --j;
+  }
+  blake2s_prefix_resume(cache, &state, j);
+  blake2s_update(&state, cache->prefix + j * BLAKE2S_BLOCKBYTES, cache->prefixlen - j * BLAKE2S_BLOCKBYTES);
+  blake2s_update(&state, (const uint8_t*)tail, taillen);
+  blake2s_mac_final(&cache->mac, &state, out);
+}
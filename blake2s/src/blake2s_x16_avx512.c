@@ -0,0 +1,120 @@
+#include "blake2s_impl.h"
+#include "blake2s_transpose.h"
+#include <stdint.h>
+
+#include <immintrin.h>
+
+/**
+ * AVX-512F implementation of the blake2s compress function over sixteen
+ * independent lanes.
+ *
+ * Same transposed layout as the eight-lane AVX2 kernel, with one lane per
+ * 32-bit element of a ZMM register. Every rotation is a single vprord and the
+ * feed-forward three-way XOR a single vpternlogd.
+ */
+
+/**
+ * Helper macro to rotate the sixteen 32-bit words of a ZMM register right by
+ * c bits with a native vector rotate
+ *
+ * @param[in]  x     the register to rotate
+ * @param[in]  c     offset to rotate by
+ */
+
+#define ROTR32(x, c) _mm512_ror_epi32((x), (c))
+
+/**
+ * Three-way XOR of ZMM registers, a single vpternlogd
+ */
+
+#define XOR3(x, y, z) _mm512_ternarylogic_epi32((x), (y), (z), 0x96)
+
+/**
+ * The blake2s mixing function on sixteen lanes at once
+ *
+ * @params  a, b, c, d  work vector entries of all lanes
+ * @params  x, y        message words of all lanes
+ */
+
+#define G(a, b, c, d, x, y)                                   \
+  do {                                                        \
+  a = _mm512_add_epi32(_mm512_add_epi32(a, b), x);            \
+  d = ROTR32(_mm512_xor_si512(d, a), 16);                     \
+  c = _mm512_add_epi32(c, d);                                 \
+  b = ROTR32(_mm512_xor_si512(b, c), 12);                     \
+  a = _mm512_add_epi32(_mm512_add_epi32(a, b), y);            \
+  d = ROTR32(_mm512_xor_si512(d, a), 8);                      \
+  c = _mm512_add_epi32(c, d);                                 \
+  b = ROTR32(_mm512_xor_si512(b, c), 7);                      \
+  } while(0)
+
+/**
+ * Message word k of round r
+ */
+
+#define M(r, k) m[blake2s_sigma[r][k]]
+
+/**
+ * One full round
+ *
+ * @param[in]  r     the round number, must be a literal
+ */
+
+#define ROUND(r)                                              \
+  do {                                                        \
+  G(v[0], v[4],  v[8], v[12],  M(r, 0),  M(r, 1));            \
+  G(v[1], v[5],  v[9], v[13],  M(r, 2),  M(r, 3));            \
+  G(v[2], v[6], v[10], v[14],  M(r, 4),  M(r, 5));            \
+  G(v[3], v[7], v[11], v[15],  M(r, 6),  M(r, 7));            \
+  G(v[0], v[5], v[10], v[15],  M(r, 8),  M(r, 9));            \
+  G(v[1], v[6], v[11], v[12], M(r, 10), M(r, 11));            \
+  G(v[2], v[7],  v[8], v[13], M(r, 12), M(r, 13));            \
+  G(v[3], v[4],  v[9], v[14], M(r, 14), M(r, 15));            \
+  } while(0)
+
+/**
+ * Compresses one full 64-byte block into each of the lanes lane .. lane+15
+ *
+ * @param      lanes   the transposed states
+ * @param[in]  lane    the first lane to compress
+ * @param[in]  blocks  one input block per lane
+ */
+
+void blake2s_compress_x16_avx512(blake2s_lanes* lanes, size_t lane, const uint8_t* const blocks[16])
+{
+  __m512i v[16], m[16];
+  __m256i lo[16], hi[16];
+  size_t i;
+
+  /* x86 is little endian, the blocks can be transposed as they are */
+  blake2s_transpose_x8(lo, blocks);
+  blake2s_transpose_x8(hi, blocks + 8);
+  for (i = 0; i < 16; ++i) {
+    m[i] = _mm512_inserti64x4(_mm512_castsi256_si512(lo[i]), hi[i], 1);
+  }
+
+  for (i = 0; i < 8; ++i) {
+    v[i] = _mm512_loadu_si512((const void*)&lanes->h[i][lane]);
+    v[i + 8] = _mm512_set1_epi32((int32_t)blake2s_IV[i]);
+  }
+  v[12] = _mm512_xor_si512(v[12], _mm512_loadu_si512((const void*)&lanes->t[0][lane]));
+  v[13] = _mm512_xor_si512(v[13], _mm512_loadu_si512((const void*)&lanes->t[1][lane]));
+  v[14] = _mm512_xor_si512(v[14], _mm512_loadu_si512((const void*)&lanes->f[0][lane]));
+  v[15] = _mm512_xor_si512(v[15], _mm512_loadu_si512((const void*)&lanes->f[1][lane]));
+
+  ROUND(0);
+  ROUND(1);
+  ROUND(2);
+  ROUND(3);
+  ROUND(4);
+  ROUND(5);
+  ROUND(6);
+  ROUND(7);
+  ROUND(8);
+  ROUND(9);
+
+  for (i = 0; i < 8; ++i) {
+    __m512i h = _mm512_loadu_si512((const void*)&lanes->h[i][lane]);
+    _mm512_storeu_si512((void*)&lanes->h[i][lane], XOR3(h, v[i], v[i + 8]));
+  }
+}
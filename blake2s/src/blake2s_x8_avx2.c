@@ -0,0 +1,119 @@
+#include "blake2s_impl.h"
+#include "blake2s_transpose.h"
+#include <stdint.h>
+
+#include <immintrin.h>
+
+/**
+ * AVX2 implementation of the blake2s compress function over eight
+ * independent lanes.
+ *
+ * The state is transposed: v[i] holds word i of the work vector of all eight
+ * lanes, one lane per 32-bit element, and m[i] holds message word i of all
+ * eight blocks. Every G therefore works on eight unrelated messages at once
+ * and no diagonalization is needed.
+ */
+
+/**
+ * Helper macros to rotate the eight 32-bit words of a YMM register right by
+ * 16, 12, 8 and 7 bits
+ *
+ * @param[in]  x     the register to rotate
+ */
+
+#define ROTR32_16(x) _mm256_shuffle_epi8((x), r16)
+#define ROTR32_12(x) _mm256_or_si256(_mm256_srli_epi32((x), 12), _mm256_slli_epi32((x), 20))
+#define ROTR32_8(x)  _mm256_shuffle_epi8((x), r8)
+#define ROTR32_7(x)  _mm256_or_si256(_mm256_srli_epi32((x), 7), _mm256_slli_epi32((x), 25))
+
+/**
+ * The blake2s mixing function on eight lanes at once
+ *
+ * @params  a, b, c, d  work vector entries of all lanes
+ * @params  x, y        message words of all lanes
+ */
+
+#define G(a, b, c, d, x, y)                                   \
+  do {                                                        \
+  a = _mm256_add_epi32(_mm256_add_epi32(a, b), x);            \
+  d = ROTR32_16(_mm256_xor_si256(d, a));                      \
+  c = _mm256_add_epi32(c, d);                                 \
+  b = ROTR32_12(_mm256_xor_si256(b, c));                      \
+  a = _mm256_add_epi32(_mm256_add_epi32(a, b), y);            \
+  d = ROTR32_8(_mm256_xor_si256(d, a));                       \
+  c = _mm256_add_epi32(c, d);                                 \
+  b = ROTR32_7(_mm256_xor_si256(b, c));                       \
+  } while(0)
+
+/**
+ * Message word k of round r
+ */
+
+#define M(r, k) m[blake2s_sigma[r][k]]
+
+/**
+ * One full round
+ *
+ * @param[in]  r     the round number, must be a literal
+ */
+
+#define ROUND(r)                                              \
+  do {                                                        \
+  G(v[0], v[4],  v[8], v[12],  M(r, 0),  M(r, 1));            \
+  G(v[1], v[5],  v[9], v[13],  M(r, 2),  M(r, 3));            \
+  G(v[2], v[6], v[10], v[14],  M(r, 4),  M(r, 5));            \
+  G(v[3], v[7], v[11], v[15],  M(r, 6),  M(r, 7));            \
+  G(v[0], v[5], v[10], v[15],  M(r, 8),  M(r, 9));            \
+  G(v[1], v[6], v[11], v[12], M(r, 10), M(r, 11));            \
+  G(v[2], v[7],  v[8], v[13], M(r, 12), M(r, 13));            \
+  G(v[3], v[4],  v[9], v[14], M(r, 14), M(r, 15));            \
+  } while(0)
+
+/**
+ * Compresses one full 64-byte block into each of the lanes lane .. lane+7
+ *
+ * @param      lanes   the transposed states
+ * @param[in]  lane    the first lane to compress
+ * @param[in]  blocks  one input block per lane
+ */
+
+void blake2s_compress_x8_avx2(blake2s_lanes* lanes, size_t lane, const uint8_t* const blocks[8])
+{
+  const __m256i r8 = _mm256_setr_epi8(
+    1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12,
+    1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+  const __m256i r16 = _mm256_setr_epi8(
+    2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+    2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+  __m256i v[16], m[16];
+  size_t i;
+
+  /* x86 is little endian, the blocks can be transposed as they are */
+  blake2s_transpose_x8(m, blocks);
+
+  for (i = 0; i < 8; ++i) {
+    v[i] = _mm256_loadu_si256((const __m256i*)&lanes->h[i][lane]);
+    v[i + 8] = _mm256_set1_epi32((int32_t)blake2s_IV[i]);
+  }
+  v[12] = _mm256_xor_si256(v[12], _mm256_loadu_si256((const __m256i*)&lanes->t[0][lane]));
+  v[13] = _mm256_xor_si256(v[13], _mm256_loadu_si256((const __m256i*)&lanes->t[1][lane]));
+  v[14] = _mm256_xor_si256(v[14], _mm256_loadu_si256((const __m256i*)&lanes->f[0][lane]));
+  v[15] = _mm256_xor_si256(v[15], _mm256_loadu_si256((const __m256i*)&lanes->f[1][lane]));
+
+  ROUND(0);
+  ROUND(1);
+  ROUND(2);
+  ROUND(3);
+  ROUND(4);
+  ROUND(5);
+  ROUND(6);
+  ROUND(7);
+  ROUND(8);
+  ROUND(9);
+
+  for (i = 0; i < 8; ++i) {
+    __m256i h = _mm256_loadu_si256((const __m256i*)&lanes->h[i][lane]);
+    h = _mm256_xor_si256(h, _mm256_xor_si256(v[i], v[i + 8]));
+    _mm256_storeu_si256((__m256i*)&lanes->h[i][lane], h);
+  }
+}
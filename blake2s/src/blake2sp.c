@@ -0,0 +1,205 @@
+#include "blake2s.h"
+#include "blake2s_impl.h"
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * BLAKE2sp: blake2s in a tree of fanout 8 and depth 2. Block i of the input
+ * goes to leaf i mod 8, and the root hashes the eight 32-byte leaf digests.
+ * The leaves are the lanes of a blake2s_lanes instance, so every stripe of
+ * eight consecutive blocks is compressed by one multi-lane kernel call.
+ */
+
+#define BLAKE2SP_STRIPE (BLAKE2SP_LEAVES * BLAKE2S_BLOCKBYTES)
+
+/**
+ * Fills in the parameter block shared by the leaves and the root
+ *
+ * @param[out] P       the parameter block
+ * @param[in]  outlen  the digest size of the whole tree
+ * @param[in]  keylen  the key length
+ */
+
+static void blake2sp_param(blake2s_param* P, size_t outlen, size_t keylen)
+{
+  memset(P, 0, sizeof(*P));
+  P->digest_length = (uint8_t)outlen;
+  P->key_length = (uint8_t)keylen;
+  P->fanout = BLAKE2SP_LEAVES;
+  P->depth = 2;
+  P->inner_length = BLAKE2S_OUTBYTES;
+}
+
+/**
+ * Initializes a BLAKE2sp state
+ *
+ * @param      state   blake2sp_state instance passed by reference
+ * @param[in]  outlen  the hash output length
+ * @param[in]  key     the key, may be NULL if keylen is 0
+ * @param[in]  keylen  the key length
+ */
+
+void blake2sp_init(blake2sp_state* state, size_t outlen, const void* key, size_t keylen)
+{
+  blake2s_param P;
+  size_t i;
+
+  blake2sp_param(&P, outlen, keylen);
+  for (i = 0; i < BLAKE2SP_LEAVES; ++i) {
+    P.node_offset = (uint32_t)i;
+    blake2s_lanes_init(&state->leaves, i, &P);
+  }
+  state->buflen = 0;
+  state->outlen = outlen;
+
+  /* The key block is only absorbed once it is known not to be the last one */
+  memset(state->key, 0, sizeof(state->key));
+  if (keylen > 0) {
+    memcpy(state->key, key, keylen);
+  }
+  state->keylen = keylen;
+  state->key_pending = keylen > 0;
+}
+
+/**
+ * Compresses one stripe of eight blocks, one into each leaf. The caller makes
+ * sure that every leaf gets more input after this stripe, so none of these
+ * blocks is the last one of its leaf.
+ *
+ * @param      state   blake2sp_state instance
+ * @param[in]  stripe  eight consecutive input blocks
+ */
+
+static void blake2sp_stripe(blake2sp_state* state, const uint8_t* stripe)
+{
+  const uint8_t* blocks[BLAKE2SP_LEAVES];
+  uint8_t key_block[BLAKE2S_BLOCKBYTES] = {0};
+  blake2s_lanes* leaves = &state->leaves;
+  size_t i;
+
+  if (state->key_pending) {
+    memcpy(key_block, state->key, state->keylen);
+    for (i = 0; i < BLAKE2SP_LEAVES; ++i) {
+      blocks[i] = key_block;
+      leaves->t[0][i] += BLAKE2S_BLOCKBYTES;
+    }
+    blake2s_compress_lanes(leaves, blocks, BLAKE2SP_LEAVES);
+    memset(key_block, 0, sizeof(key_block));
+    state->key_pending = 0;
+  }
+
+  for (i = 0; i < BLAKE2SP_LEAVES; ++i) {
+    blocks[i] = stripe + i * BLAKE2S_BLOCKBYTES;
+    leaves->t[0][i] += BLAKE2S_BLOCKBYTES;
+    leaves->t[1][i] += (leaves->t[0][i] < BLAKE2S_BLOCKBYTES);
+  }
+  blake2s_compress_lanes(leaves, blocks, BLAKE2SP_LEAVES);
+}
+
+/**
+ * Updates a BLAKE2sp state with more input. A stripe is only compressed once
+ * at least one more stripe of input follows it, which leaves every leaf at
+ * least one block for blake2sp_final.
+ *
+ * @param      state  blake2sp_state instance
+ * @param[in]  input  the input buffer
+ * @param[in]  inlen  the input length
+ */
+
+void blake2sp_update(blake2sp_state* state, const void* input, size_t inlen)
+{
+  const uint8_t* in = (const uint8_t*)input;
+  size_t fill;
+
+  while (state->buflen + inlen >= 2 * BLAKE2SP_STRIPE) {
+    if (state->buflen == 0) {
+      blake2sp_stripe(state, in);
+      in += BLAKE2SP_STRIPE;
+      inlen -= BLAKE2SP_STRIPE;
+    } else if (state->buflen < BLAKE2SP_STRIPE) {
+      fill = BLAKE2SP_STRIPE - state->buflen;
+      memcpy(state->buf + state->buflen, in, fill);
+      blake2sp_stripe(state, state->buf);
+      state->buflen = 0;
+      in += fill;
+      inlen -= fill;
+    } else {
+      blake2sp_stripe(state, state->buf);
+      state->buflen -= BLAKE2SP_STRIPE;
+      memmove(state->buf, state->buf + BLAKE2SP_STRIPE, state->buflen);
+    }
+  }
+  memcpy(state->buf + state->buflen, in, inlen);
+  state->buflen += inlen;
+}
+
+/**
+ * Finishes the leaves with the buffered input, hashes their digests into the
+ * root and writes the BLAKE2sp digest
+ *
+ * @param      state   blake2sp_state instance
+ * @param[out] out     the output buffer
+ * @param[in]  outlen  the digest size
+ */
+
+void blake2sp_final(blake2sp_state* state, void* out, size_t outlen)
+{
+  uint8_t hashes[BLAKE2SP_LEAVES][BLAKE2S_OUTBYTES];
+  uint8_t key_block[BLAKE2S_BLOCKBYTES] = {0};
+  blake2s_state leaf, root;
+  blake2s_param P;
+  size_t i, j, left;
+
+  memcpy(key_block, state->key, state->keylen);
+
+  /* At most two blocks per leaf are left, they go through the scalar path */
+  for (i = 0; i < BLAKE2SP_LEAVES; ++i) {
+    memset(&leaf, 0, sizeof(leaf));
+    for (j = 0; j < 8; ++j) {
+      leaf.h[j] = state->leaves.h[j][i];
+    }
+    leaf.t[0] = state->leaves.t[0][i];
+    leaf.t[1] = state->leaves.t[1][i];
+    leaf.outlen = BLAKE2S_OUTBYTES;
+    leaf.last_node = i == BLAKE2SP_LEAVES - 1;
+
+    if (state->key_pending) {
+      blake2s_update(&leaf, key_block, BLAKE2S_BLOCKBYTES);
+    }
+    for (j = i * BLAKE2S_BLOCKBYTES; j < state->buflen; j += BLAKE2SP_STRIPE) {
+      left = state->buflen - j;
+      blake2s_update(&leaf, state->buf + j, left < BLAKE2S_BLOCKBYTES ? left : BLAKE2S_BLOCKBYTES);
+    }
+    blake2s_final(&leaf, hashes[i], BLAKE2S_OUTBYTES);
+  }
+
+  blake2sp_param(&P, state->outlen, state->keylen);
+  P.node_depth = 1;
+  blake2s_init_param(&root, &P);
+  root.last_node = 1;
+  blake2s_update(&root, &hashes[0][0], sizeof(hashes));
+  blake2s_final(&root, out, outlen);
+
+  memset(key_block, 0, sizeof(key_block));
+  memset(state->key, 0, sizeof(state->key));
+}
+
+/**
+ * Computes the BLAKE2sp digest of a message in one call
+ *
+ * @param      output  the hash output
+ * @param[in]  outlen  the hash length
+ * @param[in]  input   the message
+ * @param[in]  inlen   the message length
+ * @param[in]  key     the key, may be NULL if keylen is 0
+ * @param[in]  keylen  the key length
+ */
+
+void blake2sp(void* output, size_t outlen, const void* input, size_t inlen, const void* key, size_t keylen)
+{
+  blake2sp_state state;
+
+  blake2sp_init(&state, outlen, key, keylen);
+  blake2sp_update(&state, input, inlen);
+  blake2sp_final(&state, output, outlen);
+}
@@ -0,0 +1,369 @@
+#include "blake2s.h"
+#include "blake2s_impl.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+  #include <pthread.h>
+  #define BLAKE2S_THREADS
+#endif
+
+/**
+ * BLAKE2Xs: an extendable-output function on top of blake2s. The input is
+ * absorbed once by a root blake2s instance whose parameter block carries the
+ * requested output length in xof_length. Output block i is then the blake2s
+ * digest of the 32-byte root digest under a parameter block with node_offset
+ * i, so every further 32 bytes of output cost a single compression. As the
+ * blocks only depend on the root digest and their index, runs of whole
+ * blocks are computed one per lane of the multi-lane kernels, and long runs
+ * are split over threads.
+ */
+
+#define BLAKE2XS_MAX_OUTPUT (((uint64_t)1 << 32) * BLAKE2S_OUTBYTES)
+
+/**
+ * Minimum number of blocks worth handing to a thread of its own
+ */
+
+#define BLAKE2XS_THREAD_BLOCKS 512
+
+/**
+ * Fills in the parameter block of one output block
+ *
+ * @param[in]  state  blake2xs_state instance
+ * @param[out] P      the parameter block
+ * @param[in]  i      the index of the block
+ * @param[in]  len    the size of the block, 32 except for the last one
+ */
+
+static void blake2xs_param(const blake2xs_state* state, blake2s_param* P, uint32_t i, size_t len)
+{
+  *P = state->P;
+  P->digest_length = (uint8_t)len;
+  P->key_length = 0;
+  P->fanout = 0;
+  P->depth = 0;
+  P->leaf_length = BLAKE2S_OUTBYTES;
+  P->node_offset = i;
+  P->node_depth = 0;
+  P->inner_length = BLAKE2S_OUTBYTES;
+}
+
+/**
+ * Computes one block of output from the root digest
+ *
+ * @param[in]  state  a finalized blake2xs_state instance
+ * @param[in]  i      the index of the block
+ * @param[out] out    the output block
+ * @param[in]  len    the size of the block, 32 except for the last one
+ */
+
+static void blake2xs_block(const blake2xs_state* state, uint32_t i, uint8_t* out, size_t len)
+{
+  blake2s_param P;
+  blake2s_state C;
+
+  blake2xs_param(state, &P, i, len);
+  blake2s_init_param(&C, &P);
+  blake2s_update(&C, state->root, BLAKE2S_OUTBYTES);
+  blake2s_final(&C, out, len);
+}
+
+/**
+ * Computes the full 32-byte blocks first .. last-1 of the output, one block
+ * per lane. Every lane compresses the same padded root digest and only the
+ * node offset in its chained state differs.
+ *
+ * @param[in]  state  a finalized blake2xs_state instance
+ * @param[in]  first  the index of the first block
+ * @param[in]  last   one past the index of the last block
+ * @param[out] out    the output, (last - first) * 32 bytes
+ */
+
+static void blake2xs_blocks(const blake2xs_state* state, uint64_t first, uint64_t last, uint8_t* out)
+{
+  uint8_t block[BLAKE2S_BLOCKBYTES] = {0};
+  const uint8_t* blocks[BLAKE2S_MAX_LANES];
+  blake2s_lanes lanes;
+  blake2s_param P;
+  size_t i, n;
+
+  memcpy(block, state->root, BLAKE2S_OUTBYTES);
+  for (i = 0; i < BLAKE2S_MAX_LANES; ++i) {
+    blocks[i] = block;
+  }
+  blake2xs_param(state, &P, 0, BLAKE2S_OUTBYTES);
+
+  while (first < last) {
+    n = last - first < BLAKE2S_MAX_LANES ? (size_t)(last - first) : BLAKE2S_MAX_LANES;
+    for (i = 0; i < n; ++i) {
+      P.node_offset = (uint32_t)(first + i);
+      blake2s_lanes_init(&lanes, i, &P);
+      lanes.t[0][i] = BLAKE2S_OUTBYTES;
+      lanes.f[0][i] = UINT32_MAX;
+    }
+    blake2s_compress_lanes(&lanes, blocks, n);
+    for (i = 0; i < n; ++i) {
+      blake2s_lanes_store(&lanes, i, out, BLAKE2S_OUTBYTES);
+      out += BLAKE2S_OUTBYTES;
+    }
+    first += n;
+  }
+}
+
+#if defined(BLAKE2S_THREADS)
+/**
+ * One thread's share of a run of blocks
+ */
+
+typedef struct blake2xs_work
+{
+  const blake2xs_state* state;
+  uint64_t first; /* First block */
+  uint64_t last;  /* One past the last block */
+  uint8_t* out;   /* Where block first goes */
+} blake2xs_work;
+
+/**
+ * Thread body: computes one share of blocks
+ *
+ * @param      arg   the blake2xs_work of the thread
+ */
+
+static void* blake2xs_worker(void* arg)
+{
+  blake2xs_work* W = (blake2xs_work*)arg;
+
+  blake2xs_blocks(W->state, W->first, W->last, W->out);
+  return NULL;
+}
+#endif
+
+/**
+ * Computes the full 32-byte blocks first .. last-1 of the output, split in
+ * contiguous shares over up to threads threads
+ *
+ * @param[in]  state    a finalized blake2xs_state instance
+ * @param[in]  first    the index of the first block
+ * @param[in]  last     one past the index of the last block
+ * @param[out] out      the output, (last - first) * 32 bytes
+ * @param[in]  threads  the number of threads to use, 0 or 1 for none
+ */
+
+static void blake2xs_run(const blake2xs_state* state, uint64_t first, uint64_t last, uint8_t* out, size_t threads)
+{
+#if defined(BLAKE2S_THREADS)
+  blake2xs_work* W = NULL;
+  pthread_t* tids = NULL;
+  uint64_t share;
+  size_t i, started = 0;
+
+  if (threads > (last - first) / BLAKE2XS_THREAD_BLOCKS) {
+    threads = (size_t)((last - first) / BLAKE2XS_THREAD_BLOCKS);
+  }
+  if (threads > 1) {
+    W = (blake2xs_work*)malloc((threads - 1) * sizeof(*W));
+    tids = (pthread_t*)malloc((threads - 1) * sizeof(*tids));
+  }
+  if (W != NULL && tids != NULL) {
+    /* Whole kernel calls per share, the calling thread takes the rest */
+    share = (last - first) / threads / BLAKE2S_MAX_LANES * BLAKE2S_MAX_LANES;
+    for (; started + 1 < threads; ++started) {
+      W[started].state = state;
+      W[started].first = first;
+      W[started].last = first + share;
+      W[started].out = out;
+      if (pthread_create(&tids[started], NULL, blake2xs_worker, &W[started]) != 0) {
+        break;
+      }
+      first += share;
+      out += share * BLAKE2S_OUTBYTES;
+    }
+  }
+  blake2xs_blocks(state, first, last, out);
+  for (i = 0; i < started; ++i) {
+    pthread_join(tids[i], NULL);
+  }
+  free(W);
+  free(tids);
+#else
+  (void)threads;
+  blake2xs_blocks(state, first, last, out);
+#endif
+}
+
+/**
+ * Initializes a BLAKE2Xs state
+ *
+ * @param      state   blake2xs_state instance passed by reference
+ * @param[in]  outlen  the output length, 1 to 65534 bytes, or
+ *                     BLAKE2XS_LENGTH_UNKNOWN to decide at blake2xs_final
+ * @param[in]  key     the key, may be NULL if keylen is 0
+ * @param[in]  keylen  the key length
+ *
+ * @return     0 on success, -1 if outlen or keylen is out of range
+ */
+
+int blake2xs_init(blake2xs_state* state, size_t outlen, const void* key, size_t keylen)
+{
+  if (outlen == 0 || outlen > BLAKE2XS_LENGTH_UNKNOWN || keylen > BLAKE2S_KEYBYTES) {
+    return -1;
+  }
+
+  memset(&state->P, 0, sizeof(state->P));
+  state->P.digest_length = BLAKE2S_OUTBYTES;
+  state->P.key_length = (uint8_t)keylen;
+  state->P.fanout = 1;
+  state->P.depth = 1;
+  state->P.xof_length = (uint16_t)outlen;
+  blake2s_init_param_key(&state->S, &state->P, key);
+  state->finalized = 0;
+  return 0;
+}
+
+/**
+ * Updates a BLAKE2Xs state. Must not be called once it is finalized.
+ *
+ * @param      state  blake2xs_state instance
+ * @param[in]  in     the input
+ * @param[in]  inlen  the input length
+ */
+
+void blake2xs_update(blake2xs_state* state, const void* in, size_t inlen)
+{
+  blake2s_update(&state->S, (const uint8_t*)in, inlen);
+}
+
+/**
+ * Computes the root digest unless that is already done. From then on the
+ * input is closed and blake2xs_read only reads the state, so it may be
+ * shared by any number of threads.
+ *
+ * @param      state  blake2xs_state instance
+ */
+
+void blake2xs_finalize(blake2xs_state* state)
+{
+  if (!state->finalized) {
+    blake2s_final(&state->S, state->root, BLAKE2S_OUTBYTES);
+    state->finalized = 1;
+  }
+}
+
+/**
+ * Finalizes the root hash and expands it into the output
+ *
+ * @param      state   blake2xs_state instance
+ * @param[out] out     the output buffer
+ * @param[in]  outlen  the output length, which must be the one passed to
+ *                     blake2xs_init unless that was BLAKE2XS_LENGTH_UNKNOWN
+ *
+ * @return     0 on success, -1 if outlen does not match
+ */
+
+int blake2xs_final(blake2xs_state* state, void* out, size_t outlen)
+{
+  size_t full = outlen / BLAKE2S_OUTBYTES;
+
+  if (state->P.xof_length == BLAKE2XS_LENGTH_UNKNOWN) {
+    if (outlen == 0 || (uint64_t)outlen > BLAKE2XS_MAX_OUTPUT) {
+      return -1;
+    }
+  } else if (outlen != state->P.xof_length) {
+    return -1;
+  }
+
+  blake2xs_finalize(state);
+  blake2xs_run(state, 0, full, (uint8_t*)out, 1);
+  if (outlen % BLAKE2S_OUTBYTES != 0) {
+    blake2xs_block(state, (uint32_t)full, (uint8_t*)out + full * BLAKE2S_OUTBYTES, outlen % BLAKE2S_OUTBYTES);
+  }
+  return 0;
+}
+
+/**
+ * Produces any part of the output stream without the bytes before it. The
+ * state must have been through blake2xs_finalize and is only read, so any
+ * number of threads may call this on the same state at once. With a known
+ * length the stream is exactly what blake2xs_final returns. With
+ * BLAKE2XS_LENGTH_UNKNOWN every block is a full 32-byte one, so the stream
+ * matches blake2xs_final only up to the last multiple of 32 bytes.
+ *
+ * @param[in]  state    a finalized blake2xs_state instance
+ * @param[in]  offset   the offset of the first byte to produce
+ * @param[out] out      the output buffer
+ * @param[in]  outlen   the number of bytes to produce
+ * @param[in]  threads  the number of threads to use, 0 or 1 for none
+ *
+ * @return     0 on success, -1 if the state is not finalized or that would
+ *             go past the end of the output
+ */
+
+int blake2xs_read(const blake2xs_state* state, uint64_t offset, void* out, size_t outlen, size_t threads)
+{
+  uint64_t end = state->P.xof_length == BLAKE2XS_LENGTH_UNKNOWN ? BLAKE2XS_MAX_OUTPUT : state->P.xof_length;
+  uint8_t block[BLAKE2S_OUTBYTES];
+  uint8_t* p = (uint8_t*)out;
+  uint64_t i = offset / BLAKE2S_OUTBYTES;
+  size_t off = (size_t)(offset % BLAKE2S_OUTBYTES);
+  size_t len, full;
+
+  if (!state->finalized || offset > end || (uint64_t)outlen > end - offset) {
+    return -1;
+  }
+
+  /* The block offset falls in, unless offset is at its start */
+  if (off != 0 && outlen > 0) {
+    len = end - i * BLAKE2S_OUTBYTES < BLAKE2S_OUTBYTES ? (size_t)(end - i * BLAKE2S_OUTBYTES) : BLAKE2S_OUTBYTES;
+    blake2xs_block(state, (uint32_t)i, block, len);
+    len -= off;
+    if (len > outlen) {
+      len = outlen;
+    }
+    memcpy(p, block + off, len);
+    p += len;
+    outlen -= len;
+    ++i;
+  }
+
+  /* Whole blocks, which all have the full length */
+  full = outlen / BLAKE2S_OUTBYTES;
+  blake2xs_run(state, i, i + full, p, threads);
+  p += full * BLAKE2S_OUTBYTES;
+  outlen -= full * BLAKE2S_OUTBYTES;
+  i += full;
+
+  /* The start of one more block, or all of a short last one */
+  if (outlen > 0) {
+    len = end - i * BLAKE2S_OUTBYTES < BLAKE2S_OUTBYTES ? (size_t)(end - i * BLAKE2S_OUTBYTES) : BLAKE2S_OUTBYTES;
+    blake2xs_block(state, (uint32_t)i, block, len);
+    memcpy(p, block, outlen);
+  }
+  return 0;
+}
+
+/**
+ * The one-shot BLAKE2Xs function
+ *
+ * @param      output  the output
+ * @param[in]  outlen  the output length, 1 to 65534 bytes
+ * @param[in]  input   the message input
+ * @param[in]  inlen   the message length
+ * @param[in]  key     the key
+ * @param[in]  keylen  the key length
+ *
+ * @return     0 on success, -1 if outlen or keylen is out of range
+ */
+
+int blake2xs(void* output, size_t outlen, const void* input, size_t inlen, const void* key, size_t keylen)
+{
+  blake2xs_state state;
+
+  if (outlen == BLAKE2XS_LENGTH_UNKNOWN ||
+      blake2xs_init(&state, outlen, key, keylen) != 0) {
+    return -1;
+  }
+  blake2xs_update(&state, input, inlen);
+  return blake2xs_final(&state, output, outlen);
+}
@@ -1,5 +1,7 @@
 #include "blake2s.h"
+#include "blake2s_impl.h"
 #include "blake2s_kat.h"
+#include "blake2sp_kat.h"
 #include <stdio.h>
 #include <string.h>
 #include <time.h>
@@ -15,22 +17,25 @@ void print_hex(const uint8_t* hash, char* string, int len)
   printf("\n");
 }
 
-int main(int argc, char const* argv[])
+/**
+ * Checks the compress function currently selected against the test vectors
+ *
+ * @param[in]  key           the test key
+ * @param[in]  buf           the test input
+ * @param[out] time_unkeyed  time spent on unkeyed hashing
+ * @param[out] time_keyed    time spent on keyed hashing
+ *
+ * @return     0 if every test vector matches, -1 otherwise
+ */
+
+int test_kat(const uint8_t* key, const uint8_t* buf, double* time_unkeyed, double* time_keyed)
 {
-  uint8_t key[BLAKE2S_KEYBYTES];
-  uint8_t buf[BLAKE2_KAT_LENGTH];
   uint8_t hash[BLAKE2S_OUTBYTES];
   size_t i;
   clock_t start, end;
-  double time_unkeyed = 0 , time_keyed = 0; 
-   
-  for (i = 0; i < BLAKE2S_KEYBYTES; ++i){
-    key[i] = (uint8_t)i;
-  }
 
-  for (i = 0; i < BLAKE2_KAT_LENGTH; ++i){
-    buf[i] = (uint8_t)i;
-  }
+  *time_unkeyed = 0;
+  *time_keyed = 0;
 
   for (i = 0; i < BLAKE2_KAT_LENGTH; ++i) {
     
@@ -40,7 +45,7 @@ int main(int argc, char const* argv[])
     blake2s(hash, BLAKE2S_OUTBYTES, buf, i, key, 0);
     end = clock();
 
-    time_unkeyed += ((double) (end - start)) / CLOCKS_PER_SEC;
+    *time_unkeyed += ((double) (end - start)) / CLOCKS_PER_SEC;
 
 
     if (memcmp(hash, blake2s_kat[i], BLAKE2S_OUTBYTES)) {
@@ -60,7 +65,7 @@ int main(int argc, char const* argv[])
     blake2s(hash, BLAKE2S_OUTBYTES, buf, i, key, BLAKE2S_KEYBYTES);
     end = clock();
 
-    time_keyed += ((double) (end - start)) / CLOCKS_PER_SEC;
+    *time_keyed += ((double) (end - start)) / CLOCKS_PER_SEC;
 
     if (memcmp(hash, blake2s_keyed_kat[i], BLAKE2S_OUTBYTES)) {
       printf("Part %d\n", (int)i);
@@ -72,15 +77,667 @@ int main(int argc, char const* argv[])
 
       return -1;
     }
-  } 
+  }
+  return 0;
+}
+
+/**
+ * Checks hashing under a full parameter block against reference digests:
+ * a salt and personalization string through both the one-shot and the
+ * streaming API, and tree parameters through blake2s_param_hash
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every digest matches, -1 otherwise
+ */
+
+int test_param(const uint8_t* key, const uint8_t* buf)
+{
+  /* Keyed, 256-byte input */
+  static const uint8_t salted[BLAKE2S_OUTBYTES] = {
+    0x31, 0x3B, 0x4E, 0xBA, 0x4F, 0x9E, 0xF8, 0xF7,
+    0x01, 0x0F, 0x59, 0x15, 0x46, 0x87, 0x7B, 0x74,
+    0x65, 0x66, 0xAD, 0x3F, 0xBF, 0x97, 0x71, 0xA1,
+    0x1E, 0x4D, 0x58, 0x80, 0xE3, 0xF8, 0x93, 0xC9
+  };
+  /* Node 5 of level 1 of a tree, keyed and salted, 100-byte input */
+  static const uint8_t node[16] = {
+    0x4F, 0x84, 0xF2, 0xB4, 0x87, 0xA0, 0x03, 0xF1,
+    0xE4, 0x1C, 0xE7, 0x7E, 0xA8, 0x94, 0xB8, 0xDB
+  };
+  static const uint8_t personal[BLAKE2S_PERSONALBYTES] = { 'p', 'r', 'o', 't', 'o', 'c', 'o', 'l' };
+  uint8_t salt[BLAKE2S_SALTBYTES];
+  uint8_t hash[BLAKE2S_OUTBYTES];
+  blake2s_state state;
+  blake2s_param P;
+  size_t i;
+
+  for (i = 0; i < BLAKE2S_SALTBYTES; ++i) {
+    salt[i] = (uint8_t)(0x80 + i);
+  }
+  blake2s_salt_personal(hash, BLAKE2S_OUTBYTES, buf, BLAKE2_KAT_LENGTH, key, BLAKE2S_KEYBYTES, salt, personal);
+  if (memcmp(hash, salted, BLAKE2S_OUTBYTES)) {
+    printf("salted and personalized blake2s FAILED\n");
+    return -1;
+  }
+  blake2s_init_salt_personal(&state, BLAKE2S_OUTBYTES, key, BLAKE2S_KEYBYTES, salt, personal);
+  for (i = 0; i < BLAKE2_KAT_LENGTH; i += 100) {
+    blake2s_update(&state, buf + i, BLAKE2_KAT_LENGTH - i < 100 ? BLAKE2_KAT_LENGTH - i : 100);
+  }
+  blake2s_final(&state, hash, BLAKE2S_OUTBYTES);
+  if (memcmp(hash, salted, BLAKE2S_OUTBYTES)) {
+    printf("streaming salted and personalized blake2s FAILED\n");
+    return -1;
+  }
+
+  memset(&P, 0, sizeof(P));
+  P.digest_length = 16;
+  P.key_length = BLAKE2S_KEYBYTES;
+  P.fanout = 4;
+  P.depth = 3;
+  P.leaf_length = 4096;
+  P.node_offset = 5;
+  P.node_depth = 1;
+  P.inner_length = 16;
+  memcpy(P.salt, salt, BLAKE2S_SALTBYTES);
+  memcpy(P.personal, personal, BLAKE2S_PERSONALBYTES);
+  blake2s_param_hash(hash, buf, 100, key, &P);
+  if (memcmp(hash, node, 16)) {
+    printf("blake2s with tree parameters FAILED\n");
+    return -1;
+  }
+  return 0;
+}
+
+/**
+ * Checks that long updates, which compress all but the last block in one
+ * multi-block call, hash the same as byte by byte updates, which compress
+ * every block on its own, also when the counter carries into t[1]
+ *
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if both digests match every time, -1 otherwise
+ */
+
+int test_update(const uint8_t* buf)
+{
+  uint8_t msg[1024], hash[BLAKE2S_OUTBYTES], ref[BLAKE2S_OUTBYTES];
+  blake2s_state bulk, bytes;
+  size_t i, j, k;
+
+  for (i = 0; i < sizeof(msg); ++i) {
+    msg[i] = buf[(i * 3) % BLAKE2_KAT_LENGTH];
+  }
+  for (k = 0; k < 2; ++k) {
+    for (i = 5; i <= sizeof(msg); i += 37) {
+      blake2s_init(&bulk, BLAKE2S_OUTBYTES, NULL, 0);
+      if (k == 1) {
+        bulk.t[0] = (uint32_t)0 - 3 * BLAKE2S_BLOCKBYTES - 5;
+      }
+      bytes = bulk;
+      blake2s_update(&bulk, msg, 5);
+      blake2s_update(&bulk, msg + 5, i - 5);
+      for (j = 0; j < i; ++j) {
+        blake2s_update(&bytes, msg + j, 1);
+      }
+      blake2s_final(&bulk, hash, BLAKE2S_OUTBYTES);
+      blake2s_final(&bytes, ref, BLAKE2S_OUTBYTES);
+      if (memcmp(hash, ref, BLAKE2S_OUTBYTES) || bulk.t[1] != bytes.t[1]) {
+        printf("multi-block blake2s_update FAILED, length %d\n", (int)i);
+        return -1;
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks the single-block path of blake2s() against init, update and final
+ * for every digest length and every message length up to one block, and
+ * that it writes nothing past the digest
+ *
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every digest matches, -1 otherwise
+ */
+
+int test_short(const uint8_t* buf)
+{
+  uint8_t hash[BLAKE2S_OUTBYTES], ref[BLAKE2S_OUTBYTES];
+  blake2s_state state;
+  size_t i, outlen;
+
+  for (outlen = 1; outlen <= BLAKE2S_OUTBYTES; ++outlen) {
+    for (i = 0; i <= BLAKE2S_BLOCKBYTES; ++i) {
+      blake2s_init(&state, outlen, NULL, 0);
+      blake2s_update(&state, buf, i);
+      blake2s_final(&state, ref, outlen);
+      memset(hash, 0, sizeof(hash));
+      blake2s(hash, outlen, buf, i, NULL, 0);
+      if (memcmp(hash, ref, outlen) || (outlen < BLAKE2S_OUTBYTES && hash[outlen] != 0)) {
+        printf("short blake2s FAILED, digest %d, message %d\n", (int)outlen, (int)i);
+        return -1;
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks keyed hashing through a blake2s_mac_ctx against blake2s for every
+ * key length and message lengths around the block boundaries, one-shot and
+ * streamed, including the empty message
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every digest matches, -1 otherwise
+ */
+
+int test_mac(const uint8_t* key, const uint8_t* buf)
+{
+  uint8_t hash[BLAKE2S_OUTBYTES], ref[BLAKE2S_OUTBYTES];
+  blake2s_mac_ctx ctx;
+  blake2s_state state;
+  size_t i, j, k, outlen;
+
+  for (k = 0; k <= BLAKE2S_KEYBYTES; k += 4) {
+    outlen = k == 0 ? BLAKE2S_OUTBYTES : k;
+    blake2s_mac_init(&ctx, outlen, key, k);
+    for (i = 0; i < BLAKE2_KAT_LENGTH; i += i < 130 ? 1 : 31) {
+      blake2s(ref, outlen, buf, i, key, k);
+      blake2s_mac(&ctx, hash, buf, i);
+      if (memcmp(hash, ref, outlen)) {
+        printf("blake2s_mac FAILED, key %d, message %d\n", (int)k, (int)i);
+        return -1;
+      }
+      blake2s_mac_start(&ctx, &state);
+      for (j = 0; j < i; j += 5) {
+        blake2s_update(&state, buf + j, i - j < 5 ? i - j : 5);
+      }
+      blake2s_mac_final(&ctx, &state, hash);
+      if (memcmp(hash, ref, outlen)) {
+        printf("streaming blake2s_mac FAILED, key %d, message %d\n", (int)k, (int)i);
+        return -1;
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks the prefix cache against blake2s() for messages that are the
+ * prefix, start with all or part of it, or leave it mid-block, and checks
+ * that a cloned state hashes on independently of the original
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every digest matches, -1 otherwise
+ */
+
+int test_prefix(const uint8_t* key, const uint8_t* buf)
+{
+  static const size_t prefixlens[] = { 0, 1, 64, 127, 128, 700 };
+  uint8_t msg[1024], alt[1024];
+  uint8_t hash[BLAKE2S_OUTBYTES], ref[BLAKE2S_OUTBYTES];
+  blake2s_prefix cache;
+  blake2s_state state, fork;
+  size_t i, j, k, p, n, done;
+
+  for (i = 0; i < sizeof(msg); ++i) {
+    msg[i] = buf[(i * 7) % BLAKE2_KAT_LENGTH];
+  }
+  for (k = 0; k <= BLAKE2S_KEYBYTES; k += 32) {
+    for (p = 0; p < sizeof(prefixlens) / sizeof(prefixlens[0]); ++p) {
+      n = prefixlens[p];
+      if (blake2s_prefix_init(&cache, BLAKE2S_OUTBYTES, key, k, msg, n)) {
+        printf("blake2s_prefix_init FAILED\n");
+        return -1;
+      }
+      for (i = 0; i <= n + 300; ++i) {
+        blake2s(ref, BLAKE2S_OUTBYTES, msg, i, key, k);
+        blake2s_prefix_hash(&cache, hash, msg, i);
+        if (memcmp(hash, ref, BLAKE2S_OUTBYTES)) {
+          printf("blake2s_prefix_hash FAILED, prefix %d, message %d\n", (int)n, (int)i);
+          return -1;
+        }
+        done = blake2s_prefix_start(&cache, &state, msg, i);
+        for (j = done; j < i; j += 50) {
+          blake2s_update(&state, msg + j, i - j < 50 ? i - j : 50);
+        }
+        blake2s_mac_final(&cache.mac, &state, hash);
+        if (memcmp(hash, ref, BLAKE2S_OUTBYTES)) {
+          printf("streaming blake2s_prefix FAILED, prefix %d, message %d\n", (int)n, (int)i);
+          return -1;
+        }
+        if (i >= n) {
+          blake2s_prefix_tail(&cache, hash, msg + n, i - n);
+          if (memcmp(hash, ref, BLAKE2S_OUTBYTES)) {
+            printf("blake2s_prefix_tail FAILED, prefix %d, message %d\n", (int)n, (int)i);
+            return -1;
+          }
+        }
+      }
+
+      /* A message that leaves the prefix mid-block */
+      if (n > 200) {
+        memcpy(alt, msg, sizeof(alt));
+        alt[150] ^= 1;
+        blake2s(ref, BLAKE2S_OUTBYTES, alt, n + 10, key, k);
+        blake2s_prefix_hash(&cache, hash, alt, n + 10);
+        if (memcmp(hash, ref, BLAKE2S_OUTBYTES)) {
+          printf("diverging blake2s_prefix FAILED, prefix %d\n", (int)n);
+          return -1;
+        }
+      }
+      blake2s_prefix_free(&cache);
+    }
+
+    /* Fork one stream into two messages */
+    blake2s_init(&state, BLAKE2S_OUTBYTES, key, k);
+    blake2s_update(&state, msg, 300);
+    blake2s_clone(&fork, &state);
+    blake2s_update(&state, msg + 300, 100);
+    blake2s_update(&fork, buf, 50);
+    blake2s_final(&state, hash, BLAKE2S_OUTBYTES);
+    blake2s(ref, BLAKE2S_OUTBYTES, msg, 400, key, k);
+    if (memcmp(hash, ref, BLAKE2S_OUTBYTES)) {
+      printf("blake2s_clone FAILED, original\n");
+      return -1;
+    }
+    memcpy(msg + 300, buf, 50);
+    blake2s_final(&fork, hash, BLAKE2S_OUTBYTES);
+    blake2s(ref, BLAKE2S_OUTBYTES, msg, 350, key, k);
+    if (memcmp(hash, ref, BLAKE2S_OUTBYTES)) {
+      printf("blake2s_clone FAILED, clone\n");
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks blake2s_x8 and blake2s_x16 against the test vectors in lane 0 and
+ * against blake2s() for other messages of the same length in the other lanes
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every lane matches, -1 otherwise
+ */
+
+int test_lanes(const uint8_t* key, const uint8_t* buf)
+{
+  uint8_t msgs[16][BLAKE2_KAT_LENGTH];
+  uint8_t hashes[16][BLAKE2S_OUTBYTES];
+  uint8_t expected[BLAKE2S_OUTBYTES];
+  const void* in[16];
+  void* out[16];
+  size_t i, j, n, keylen;
+
+  for (j = 0; j < 16; ++j) {
+    for (i = 0; i < BLAKE2_KAT_LENGTH; ++i) {
+      msgs[j][i] = (uint8_t)(buf[i] * (j + 1));
+    }
+    in[j] = msgs[j];
+    out[j] = hashes[j];
+  }
+
+  for (n = 8; n <= 16; n += 8) {
+    for (keylen = 0; keylen <= BLAKE2S_KEYBYTES; keylen += BLAKE2S_KEYBYTES) {
+      for (i = 0; i < BLAKE2_KAT_LENGTH; ++i) {
+        if (n == 8) {
+          blake2s_x8(out, BLAKE2S_OUTBYTES, in, i, key, keylen);
+        } else {
+          blake2s_x16(out, BLAKE2S_OUTBYTES, in, i, key, keylen);
+        }
+        if (memcmp(hashes[0], keylen ? blake2s_keyed_kat[i] : blake2s_kat[i], BLAKE2S_OUTBYTES)) {
+          printf("x%d lane 0 FAILED at %d\n", (int)n, (int)i);
+          return -1;
+        }
+        for (j = 1; j < n; ++j) {
+          blake2s(expected, BLAKE2S_OUTBYTES, in[j], i, key, keylen);
+          if (memcmp(hashes[j], expected, BLAKE2S_OUTBYTES)) {
+            printf("x%d lane %d FAILED at %d\n", (int)n, (int)j, (int)i);
+            return -1;
+          }
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks blake2s_batch on all test vectors at once, in a scrambled order, and
+ * against blake2s() for a batch mixing key and digest sizes
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every digest matches, -1 otherwise
+ */
+
+int test_batch(const uint8_t* key, const uint8_t* buf)
+{
+  static uint8_t hashes[2 * BLAKE2_KAT_LENGTH][BLAKE2S_OUTBYTES];
+  blake2s_desc descs[2 * BLAKE2_KAT_LENGTH];
+  uint8_t expected[BLAKE2S_OUTBYTES];
+  size_t i, k, n = 2 * BLAKE2_KAT_LENGTH;
+
+  for (i = 0; i < n; ++i) {
+    /* 37 is odd, so k walks over every test vector once */
+    k = (i * 37) % n;
+    descs[i].in = buf;
+    descs[i].inlen = k % BLAKE2_KAT_LENGTH;
+    descs[i].key = k < BLAKE2_KAT_LENGTH ? NULL : key;
+    descs[i].keylen = k < BLAKE2_KAT_LENGTH ? 0 : BLAKE2S_KEYBYTES;
+    descs[i].out = hashes[k];
+    descs[i].outlen = BLAKE2S_OUTBYTES;
+  }
+  blake2s_batch(descs, n);
+  for (i = 0; i < BLAKE2_KAT_LENGTH; ++i) {
+    if (memcmp(hashes[i], blake2s_kat[i], BLAKE2S_OUTBYTES) ||
+        memcmp(hashes[i + BLAKE2_KAT_LENGTH], blake2s_keyed_kat[i], BLAKE2S_OUTBYTES)) {
+      printf("batch FAILED at %d\n", (int)i);
+      return -1;
+    }
+  }
+
+  for (i = 0; i < n; ++i) {
+    descs[i].in = buf;
+    descs[i].inlen = (i * 7) % BLAKE2_KAT_LENGTH;
+    descs[i].key = key;
+    descs[i].keylen = i % (BLAKE2S_KEYBYTES + 1);
+    descs[i].out = hashes[i];
+    descs[i].outlen = 1 + i % BLAKE2S_OUTBYTES;
+  }
+  blake2s_batch(descs, n);
+  for (i = 0; i < n; ++i) {
+    blake2s(expected, descs[i].outlen, descs[i].in, descs[i].inlen, descs[i].key, descs[i].keylen);
+    if (memcmp(hashes[i], expected, descs[i].outlen)) {
+      printf("batch FAILED at %d\n", (int)i);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks BLAKE2sp against the test vectors, and on a 4099-byte message that
+ * spans several stripes, fed in one call and in chunks of various sizes
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every digest matches, -1 otherwise
+ */
+
+int test_sp(const uint8_t* key, const uint8_t* buf)
+{
+  static const uint8_t long_kat[2][BLAKE2S_OUTBYTES] = {
+    {
+      0x21, 0xE4, 0xFF, 0x50, 0x75, 0x08, 0xB2, 0x1D,
+      0x23, 0xFE, 0xDD, 0x92, 0x60, 0x8C, 0xF8, 0x81,
+      0xFF, 0x4E, 0x0C, 0xCE, 0xC4, 0x18, 0x7A, 0x30,
+      0xE5, 0xC0, 0x11, 0x6E, 0xF5, 0x6E, 0xEA, 0xB1
+    },
+    {
+      0x8B, 0x1E, 0x35, 0x1D, 0xDD, 0x68, 0x78, 0x3A,
+      0x97, 0x16, 0xD6, 0x4B, 0x62, 0x63, 0xE3, 0x80,
+      0x66, 0xFC, 0xA9, 0xFE, 0x93, 0x56, 0xBA, 0xDA,
+      0x18, 0xBB, 0x90, 0x3A, 0x44, 0x15, 0x53, 0x3D
+    }
+  };
+  static const size_t chunks[] = { 1, 7, 64, 511, 512, 513, 1000, 4099 };
+  uint8_t msg[4099];
+  uint8_t hash[BLAKE2S_OUTBYTES];
+  blake2sp_state state;
+  size_t i, j, k, n, keylen;
+
+  for (i = 0; i < BLAKE2_KAT_LENGTH; ++i) {
+    blake2sp(hash, BLAKE2S_OUTBYTES, buf, i, key, 0);
+    if (memcmp(hash, blake2sp_kat[i], BLAKE2S_OUTBYTES)) {
+      printf("blake2sp FAILED at %d\n", (int)i);
+      return -1;
+    }
+    blake2sp(hash, BLAKE2S_OUTBYTES, buf, i, key, BLAKE2S_KEYBYTES);
+    if (memcmp(hash, blake2sp_keyed_kat[i], BLAKE2S_OUTBYTES)) {
+      printf("keyed blake2sp FAILED at %d\n", (int)i);
+      return -1;
+    }
+  }
+
+  for (i = 0; i < sizeof(msg); ++i) {
+    msg[i] = (uint8_t)i;
+  }
+  for (k = 0; k < 2; ++k) {
+    keylen = k ? BLAKE2S_KEYBYTES : 0;
+    for (j = 0; j < sizeof(chunks) / sizeof(chunks[0]); ++j) {
+      blake2sp_init(&state, BLAKE2S_OUTBYTES, key, keylen);
+      for (i = 0; i < sizeof(msg); i += n) {
+        n = sizeof(msg) - i < chunks[j] ? sizeof(msg) - i : chunks[j];
+        blake2sp_update(&state, msg + i, n);
+      }
+      blake2sp_final(&state, hash, BLAKE2S_OUTBYTES);
+      if (memcmp(hash, long_kat[k], BLAKE2S_OUTBYTES)) {
+        printf("blake2sp FAILED with %d-byte chunks\n", (int)chunks[j]);
+        return -1;
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks that a 1 MiB BLAKE2Xs output read at once on 1 to 4 threads, and
+ * read from an odd offset, matches the same output read in odd chunks
+ *
+ * @param[in]  key   the test key
+ *
+ * @return     0 if the outputs match, -1 otherwise
+ */
+
+int test_xs_long(const uint8_t* key)
+{
+  static uint8_t ref[1 << 20], out[1 << 20];
+  blake2xs_state state;
+  size_t i, n, threads;
+
+  blake2xs_init(&state, BLAKE2XS_LENGTH_UNKNOWN, key, BLAKE2S_KEYBYTES);
+  blake2xs_update(&state, key, BLAKE2S_KEYBYTES);
+  blake2xs_finalize(&state);
+  for (i = 0; i < sizeof(ref); i += n) {
+    n = sizeof(ref) - i < 1000 ? sizeof(ref) - i : 1000;
+    blake2xs_read(&state, i, ref + i, n, 1);
+  }
+  for (threads = 1; threads <= 4; ++threads) {
+    memset(out, 0, sizeof(out));
+    if (blake2xs_read(&state, 0, out, sizeof(out), threads) != 0 || memcmp(out, ref, sizeof(out)) ||
+        blake2xs_read(&state, 12345, out, sizeof(out) - 23456, threads) != 0 ||
+        memcmp(out, ref + 12345, sizeof(out) - 23456)) {
+      printf("blake2xs read FAILED with %d threads\n", (int)threads);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Checks BLAKE2Xs against reference outputs of known and unknown length, fed
+ * in one piece and in small chunks, and that invalid lengths are rejected
+ *
+ * @param[in]  key   the test key
+ * @param[in]  buf   the test input
+ *
+ * @return     0 if every output matches, -1 otherwise
+ */
+
+int test_xs(const uint8_t* key, const uint8_t* buf)
+{
+  /* keyed, 256-byte input, xof_length 256 */
+  static const uint8_t kat_256[256] = {
+    0x57, 0x84, 0xE6, 0x14, 0xD5, 0x38, 0xF7, 0xF2,
+    0x6C, 0x80, 0x31, 0x91, 0xDE, 0xB4, 0x64, 0xA8,
+    0x84, 0x81, 0x70, 0x02, 0x98, 0x8C, 0x36, 0x44,
+    0x8D, 0xCB, 0xEC, 0xFA, 0xD1, 0x99, 0x7F, 0xE5,
+    0x1A, 0xB0, 0xB3, 0x85, 0x3C, 0x51, 0xED, 0x49,
+    0xCE, 0x9F, 0x4E, 0x47, 0x75, 0x22, 0xFB, 0x3F,
+    0x32, 0xCC, 0x50, 0x51, 0x5B, 0x75, 0x3C, 0x18,
+    0xFB, 0x89, 0xA8, 0xD9, 0x65, 0xAF, 0xCF, 0x1E,
+    0xD5, 0xE0, 0x99, 0xB2, 0x2C, 0x42, 0x25, 0x73,
+    0x2B, 0xAE, 0xB9, 0x86, 0xF5, 0xC5, 0xBC, 0x88,
+    0xE4, 0x58, 0x2D, 0x27, 0x91, 0x5E, 0x2A, 0x19,
+    0x12, 0x6D, 0x3D, 0x45, 0x55, 0xFA, 0xB4, 0xF6,
+    0x51, 0x6A, 0x6A, 0x15, 0x6D, 0xBF, 0xEE, 0xD9,
+    0xE9, 0x82, 0xFC, 0x58, 0x9E, 0x33, 0xCE, 0x2B,
+    0x9E, 0x1B, 0xA2, 0xB4, 0x16, 0xE1, 0x18, 0x52,
+    0xDD, 0xEA, 0xB9, 0x30, 0x25, 0x97, 0x42, 0x67,
+    0xAC, 0x82, 0xC8, 0x4F, 0x07, 0x1C, 0x3D, 0x07,
+    0xF2, 0x15, 0xF4, 0x7E, 0x35, 0x65, 0xFD, 0x1D,
+    0x96, 0x2C, 0x76, 0xE0, 0xD6, 0x35, 0x89, 0x2E,
+    0xA7, 0x14, 0x88, 0x27, 0x37, 0x65, 0x88, 0x7D,
+    0x31, 0xF2, 0x50, 0xA2, 0x6C, 0x4D, 0xDC, 0x37,
+    0x7E, 0xD8, 0x9B, 0x17, 0x32, 0x6E, 0x25, 0x9F,
+    0x6C, 0xC1, 0xDE, 0x0E, 0x63, 0x15, 0x8E, 0x83,
+    0xAE, 0xBB, 0x7F, 0x5A, 0x7C, 0x08, 0xC6, 0x3C,
+    0x76, 0x78, 0x76, 0xC8, 0x20, 0x36, 0x39, 0x95,
+    0x8A, 0x40, 0x7A, 0xCC, 0xA0, 0x96, 0xD1, 0xF6,
+    0x06, 0xC0, 0x4B, 0x4F, 0x4B, 0x3F, 0xD7, 0x71,
+    0x78, 0x1A, 0x59, 0x01, 0xB1, 0xC3, 0xCE, 0xE7,
+    0xC0, 0x4C, 0x3B, 0x68, 0x70, 0x22, 0x6E, 0xEE,
+    0x30, 0x9B, 0x74, 0xF5, 0x1E, 0xDB, 0xF7, 0x0A,
+    0x38, 0x17, 0xCC, 0x8D, 0xA8, 0x78, 0x75, 0x30,
+    0x1E, 0x04, 0xD0, 0x41, 0x6A, 0x65, 0xDC, 0x5D
+  };
+  /* xof_length 33: not a prefix of the above, xof_length is in every block */
+  static const uint8_t kat_33[33] = {
+    0x7D, 0xCE, 0x71, 0x0A, 0x20, 0xF4, 0x2A, 0xB6,
+    0x87, 0xEC, 0x6E, 0xA8, 0x3B, 0x53, 0xFA, 0xAA,
+    0x41, 0x82, 0x29, 0xCE, 0x0D, 0x5A, 0x2F, 0xF2,
+    0xA5, 0xE6, 0x6D, 0xEF, 0xB0, 0xB6, 0x5C, 0x03,
+    0xC9
+  };
+  /* the same with xof_length BLAKE2XS_LENGTH_UNKNOWN and 100 bytes read */
+  static const uint8_t kat_unknown[100] = {
+    0x2A, 0x9A, 0x69, 0x77, 0xD9, 0x15, 0xA2, 0xC4,
+    0xDD, 0x07, 0xDB, 0xCA, 0xFE, 0x19, 0x18, 0xBF,
+    0x16, 0x82, 0xE5, 0x6D, 0x9C, 0x8E, 0x56, 0x7E,
+    0xCD, 0x19, 0xBF, 0xD7, 0xCD, 0x93, 0x52, 0x88,
+    0x33, 0xC7, 0x64, 0xD1, 0x2B, 0x34, 0xA5, 0xE2,
+    0xA2, 0x19, 0xC9, 0xFD, 0x46, 0x3D, 0xAB, 0x45,
+    0xE9, 0x72, 0xC5, 0x57, 0x4D, 0x73, 0xF4, 0x5D,
+    0xE5, 0xB2, 0xE2, 0x3A, 0xF7, 0x25, 0x30, 0xD8,
+    0xE0, 0xCB, 0xE4, 0x17, 0xCF, 0x12, 0x6D, 0xBA,
+    0x7C, 0x59, 0x0E, 0xA8, 0xB8, 0xBC, 0xDB, 0x6E,
+    0xDA, 0x48, 0xD5, 0x86, 0x65, 0xC2, 0xF8, 0x9E,
+    0x13, 0x5B, 0xA2, 0x4E, 0xF1, 0x3D, 0xB6, 0x9A,
+    0x94, 0x4F, 0xF4, 0x5C
+  };
+  uint8_t out[256];
+  blake2xs_state state;
+  size_t i, n;
+
+  if (blake2xs(out, 256, buf, BLAKE2_KAT_LENGTH, key, BLAKE2S_KEYBYTES) != 0 ||
+      memcmp(out, kat_256, 256) ||
+      blake2xs(out, 33, buf, BLAKE2_KAT_LENGTH, key, BLAKE2S_KEYBYTES) != 0 ||
+      memcmp(out, kat_33, 33) ||
+      blake2xs(out, 1, buf, BLAKE2_KAT_LENGTH, key, BLAKE2S_KEYBYTES) != 0 ||
+      out[0] != 0x0E) {
+    printf("blake2xs FAILED\n");
+    return -1;
+  }
+
+  for (n = 1; n <= 65; n += 16) {
+    blake2xs_init(&state, BLAKE2XS_LENGTH_UNKNOWN, key, BLAKE2S_KEYBYTES);
+    for (i = 0; i < BLAKE2_KAT_LENGTH; i += n) {
+      blake2xs_update(&state, buf + i, BLAKE2_KAT_LENGTH - i < n ? BLAKE2_KAT_LENGTH - i : n);
+    }
+    if (blake2xs_final(&state, out, 100) != 0 || memcmp(out, kat_unknown, 100)) {
+      printf("blake2xs FAILED with %d-byte chunks\n", (int)n);
+      return -1;
+    }
+  }
+
+  /* Any window of the output, without the bytes before it */
+  blake2xs_init(&state, 256, key, BLAKE2S_KEYBYTES);
+  blake2xs_update(&state, buf, BLAKE2_KAT_LENGTH);
+  if (blake2xs_read(&state, 0, out, 1, 1) != -1) {
+    printf("blake2xs FAILED to reject a read before finalize\n");
+    return -1;
+  }
+  blake2xs_finalize(&state);
+  for (i = 0; i < 256; i += 13) {
+    for (n = 0; i + n <= 256; n += 29) {
+      if (blake2xs_read(&state, i, out, n, 1) != 0 || memcmp(out, kat_256 + i, n)) {
+        printf("blake2xs read FAILED at %d+%d\n", (int)i, (int)n);
+        return -1;
+      }
+    }
+  }
+  if (blake2xs_read(&state, 200, out, 57, 1) != -1 || blake2xs_read(&state, 257, out, 0, 1) != -1) {
+    printf("blake2xs FAILED to reject a read past the end\n");
+    return -1;
+  }
+
+  /* A long output on several threads matches the same output read in chunks */
+  if (test_xs_long(key) != 0) {
+    return -1;
+  }
+
+  if (blake2xs_init(&state, 0, NULL, 0) != -1 ||
+      blake2xs_init(&state, 16, key, BLAKE2S_KEYBYTES + 1) != -1 ||
+      blake2xs_init(&state, 16, NULL, 0) != 0 ||
+      blake2xs_final(&state, out, 17) != -1 ||
+      blake2xs(out, BLAKE2XS_LENGTH_UNKNOWN, buf, 1, NULL, 0) != -1) {
+    printf("blake2xs FAILED to reject invalid lengths\n");
+    return -1;
+  }
+  return 0;
+}
+
+int main(int argc, char const* argv[])
+{
+  static const char* kernels[] = { "ref", "sse41", "avx2", "avx512" };
+  uint8_t key[BLAKE2S_KEYBYTES];
+  uint8_t buf[BLAKE2_KAT_LENGTH];
+  size_t i;
+  double time_unkeyed = 0 , time_keyed = 0; 
+   
+  for (i = 0; i < BLAKE2S_KEYBYTES; ++i){
+    key[i] = (uint8_t)i;
+  }
+
+  for (i = 0; i < BLAKE2_KAT_LENGTH; ++i){
+    buf[i] = (uint8_t)i;
+  }
+
+  /* Every kernel this CPU can run has to match the test vectors */
+
+  for (i = 0; i < sizeof(kernels) / sizeof(kernels[0]); ++i) {
+    if (blake2s_select_kernel(kernels[i]) != 0) {
+      printf("Skipping %s kernel\n", kernels[i]);
+      continue;
+    }
+    if (test_kat(key, buf, &time_unkeyed, &time_keyed) != 0 || test_short(buf) != 0 || test_update(buf) != 0 || test_param(key, buf) != 0 ||
+        test_mac(key, buf) != 0 || test_prefix(key, buf) != 0 || test_lanes(key, buf) != 0 ||
+        test_batch(key, buf) != 0 || test_sp(key, buf) != 0 ||
+        test_xs(key, buf) != 0) {
+      printf("%s kernel FAILED\n", kernels[i]);
+      return -1;
+    }
+    printf("Kernel : %s\n", kernels[i]);
+    printf("Total time taken for Unkeyed hashing : %f\n" , time_unkeyed);
+    printf("Average time taken per hash : %f\n" , time_unkeyed / 256);
+    printf("Total time taken for Keyed hashing : %f\n" , time_keyed);
+    printf("Average time taken per hash : %f\n" , time_keyed / 256);
+    printf("Total time taken for hashing : %f\n" , time_unkeyed + time_keyed);
+    printf("Average time taken pre hash : %f\n" , (time_unkeyed + time_keyed)/512 );
+  }
   
   printf("SUCCESS\n");
-  printf("Total time taken for Unkeyed hashing : %f\n" , time_unkeyed);
-  printf("Average time taken per hash : %f\n" , time_unkeyed / 256);
-  printf("Total time taken for Keyed hashing : %f\n" , time_keyed);
-  printf("Average time taken per hash : %f\n" , time_keyed / 256);
-  printf("Total time taken for hashing : %f\n" , time_unkeyed + time_keyed);
-  printf("Average time taken pre hash : %f\n" , (time_unkeyed + time_keyed)/512 );
   return 0;
 
 }